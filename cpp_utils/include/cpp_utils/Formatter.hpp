@@ -20,7 +20,10 @@
 
 #pragma once
 
-#include <sstream>
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <sstream> // Kept for the sources that get std::stringstream from this header
 #include <string>
 
 #include <cpp_utils/library/library_dll.h>
@@ -38,11 +41,41 @@ namespace utils {
  * using the << operator for the objects in the block, add them to Formatter() object and they will be
  * concatenated in a single string. For example:
  * Exception(Formatter() << " object1 stream: " << obj1 << " object2 stream: " << obj2);
+ *
+ * Text is concatenated in a buffer inside the object, that only moves to the heap when the text does not fit in it.
+ * Strings, characters and arithmetic values are written directly in the buffer, with the same format that
+ * a default \c std::ostream would give them. Any other object is written with its \c operator<< in a stream
+ * over the same buffer, that is only created the first time it is needed. Once a manipulator (e.g. \c std::setw )
+ * changes the format of that stream, every value is written in it, so the format applies to them too.
  */
 class Formatter
 {
 public:
 
+    //! Size of the text kept inside the object before moving it to the heap.
+    static constexpr std::size_t INLINE_CAPACITY = 256;
+
+    //! Construct an empty formatter. It does not allocate.
+    CPP_UTILS_DllAPI Formatter() noexcept;
+
+    //! Copy the text of \c other . The state of its stream (e.g. manipulators) is not copied.
+    CPP_UTILS_DllAPI Formatter(
+            const Formatter& other);
+
+    //! Move the text of \c other , that is left empty. The state of its stream (e.g. manipulators) is not moved.
+    CPP_UTILS_DllAPI Formatter(
+            Formatter&& other) noexcept;
+
+    //! Copy the text of \c other . The state of its stream (e.g. manipulators) is not copied.
+    CPP_UTILS_DllAPI Formatter& operator =(
+            const Formatter& other);
+
+    //! Move the text of \c other , that is left empty. The state of its stream (e.g. manipulators) is not moved.
+    CPP_UTILS_DllAPI Formatter& operator =(
+            Formatter&& other) noexcept;
+
+    CPP_UTILS_DllAPI ~Formatter();
+
     //! Concatenate stream values to this formatter
     template<class Val>
     Formatter& operator <<(
@@ -54,10 +87,109 @@ public:
     //! Return a string with the concatenation of this object
     CPP_UTILS_DllAPI std::string to_string() const noexcept;
 
+    //! Text concatenated, not null terminated. Valid until something else is concatenated.
+    CPP_UTILS_DllAPI const char* data() const noexcept;
+
+    //! Number of characters concatenated.
+    CPP_UTILS_DllAPI std::size_t size() const noexcept;
+
 protected:
 
-    //! Concatenated stream where the streams are added at the end
-    std::stringstream ss_;
+    //! Stream that writes in the buffer of a \c Formatter , for objects without a direct conversion.
+    class FallbackStream;
+
+    /**
+     * @name Values written directly in the buffer.
+     *
+     * There is an overload for each type, so none of them is converted to another one,
+     * as the template overload for the rest of types would be chosen instead.
+     */
+    ///@{
+    CPP_UTILS_DllAPI void append_value_(
+            const std::string& val);
+    CPP_UTILS_DllAPI void append_value_(
+            const char* val);
+    CPP_UTILS_DllAPI void append_value_(
+            char* val);
+    CPP_UTILS_DllAPI void append_value_(
+            char val);
+    CPP_UTILS_DllAPI void append_value_(
+            signed char val);
+    CPP_UTILS_DllAPI void append_value_(
+            unsigned char val);
+    CPP_UTILS_DllAPI void append_value_(
+            bool val);
+    CPP_UTILS_DllAPI void append_value_(
+            short val);
+    CPP_UTILS_DllAPI void append_value_(
+            unsigned short val);
+    CPP_UTILS_DllAPI void append_value_(
+            int val);
+    CPP_UTILS_DllAPI void append_value_(
+            unsigned int val);
+    CPP_UTILS_DllAPI void append_value_(
+            long val);
+    CPP_UTILS_DllAPI void append_value_(
+            unsigned long val);
+    CPP_UTILS_DllAPI void append_value_(
+            long long val);
+    CPP_UTILS_DllAPI void append_value_(
+            unsigned long long val);
+    CPP_UTILS_DllAPI void append_value_(
+            float val);
+    CPP_UTILS_DllAPI void append_value_(
+            double val);
+    CPP_UTILS_DllAPI void append_value_(
+            long double val);
+    CPP_UTILS_DllAPI void append_value_(
+            const Formatter& val);
+    ///@}
+
+    //! Write any other value with its \c operator<< in the stream.
+    template<class Val>
+    void append_value_(
+            const Val& val);
+
+    //! Append \c size characters from \c data .
+    CPP_UTILS_DllAPI void append_(
+            const char* data,
+            std::size_t size);
+
+    //! Append an integer, with its sign if \c negative .
+    void append_integer_(
+            unsigned long long magnitude,
+            bool negative);
+
+    //! Append a floating point number formatted with \c format .
+    template<class Val>
+    void append_floating_(
+            const char* format,
+            Val val);
+
+    //! Make room for \c extra more characters.
+    void reserve_(
+            std::size_t extra);
+
+    //! Stream that writes in the buffer. It is created the first time it is needed.
+    CPP_UTILS_DllAPI std::ostream& stream_();
+
+    //! Whether values must be written in the stream, because a manipulator changed its format.
+    bool stream_formatted_() const noexcept;
+
+    //! Beginning of the text, either in \c inline_buffer_ or in the heap.
+    char* data_;
+
+    //! Number of characters concatenated.
+    std::size_t size_;
+
+    //! Number of characters that fit in \c data_ .
+    std::size_t capacity_;
+
+    //! Stream for objects written with their \c operator<< . Null until it is needed.
+    std::unique_ptr<FallbackStream> fallback_stream_;
+
+    //! Buffer for texts that fit in the object.
+    char inline_buffer_[INLINE_CAPACITY];
 };
 
 //! \c Formatter to stream serializator
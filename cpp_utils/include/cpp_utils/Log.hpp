@@ -18,11 +18,15 @@
 
 #pragma once
 
+#include <atomic>
 #include <iostream>
 
 // Use FastDDS log
 #include <fastdds/dds/log/Log.hpp>
 
+#include <cpp_utils/logging/CategoryVerbosityRegistry.hpp>
+#include <cpp_utils/logging/LogStaging.hpp>
+#include <cpp_utils/logging/compile_time_log_filter.hpp>
 #include <cpp_utils/macros/macros.hpp>
 
 namespace eprosima {
@@ -35,6 +39,13 @@ using LogConsumer = eprosima::fastdds::dds::LogConsumer;
  * @brief Log level only for debugging purpose (entities creation and destruction, unexpected behaviour, etc.)
  *
  * @note As this level is not implemented, it is used as Info level.
+ *
+ * @note Messages of a category whose verbosity in \c CategoryVerbosityRegistry is lower are skipped
+ * before \c msg is evaluated, and categories disabled in \c compile_time_log_filter.hpp are compiled out.
+ *
+ * @note Messages are staged in the buffer of the thread while \c LogStaging is started.
+ * Messages of the Fast DDS macros ( \c logInfo , \c logWarning , \c logError ) are not, so they may be consumed
+ * before messages of this macro logged earlier.
  */
 #define logDebug(cat, msg) logDebug_(cat, msg)
 
@@ -45,6 +56,13 @@ using LogConsumer = eprosima::fastdds::dds::LogConsumer;
  * message for the user, as it normally refers to an internal bug or malfunction.
  *
  * @note As this level is not implemented, it is used as Info level.
+ *
+ * @note Messages of a category whose verbosity in \c CategoryVerbosityRegistry is lower are skipped
+ * before \c msg is evaluated, and categories disabled in \c compile_time_log_filter.hpp are compiled out.
+ *
+ * @note Messages are staged in the buffer of the thread while \c LogStaging is started.
+ * Messages of the Fast DDS macros ( \c logInfo , \c logWarning , \c logError ) are not, so they may be consumed
+ * before messages of this macro logged earlier.
  */
 #define logDevError(cat, msg) logDevError_(cat, msg)
 
@@ -62,16 +80,24 @@ using LogConsumer = eprosima::fastdds::dds::LogConsumer;
     (defined(FASTDDS_ENFORCE_LOG_INFO) || \
     ((defined(__INTERNALDEBUG) || defined(_INTERNALDEBUG)) && (defined(_DEBUG) || defined(__DEBUG) || \
     !defined(NDEBUG))))
-#define logDebug_(cat, msg)                                                                             \
-    {                                                                                                   \
-        using namespace eprosima::fastdds::dds;                                                         \
-        if (Log::GetVerbosity() >= Log::Kind::Info)                                                     \
-        {                                                                                               \
-            std::stringstream fastdds_log_ss_tmp__;                                                     \
-            fastdds_log_ss_tmp__ << "DEBUG: " << msg;                                                   \
-            Log::QueueLog(fastdds_log_ss_tmp__.str(), Log::Context{__FILE__, __LINE__, __func__, #cat}, \
-                    Log::Kind::Info);                                                                   \
-        }                                                                                               \
+#define logDebug_(cat, msg)                                                                                     \
+    {                                                                                                           \
+        using namespace eprosima::fastdds::dds;                                                                 \
+        eprosima::utils::log_if_compiled(CPP_UTILS_LOG_COMPILED_TAG(cat, Log::Kind::Info), __func__,            \
+                [&](auto cpp_utils_log_function_tmp__)                                                          \
+                {                                                                                               \
+                    static const std::atomic<Log::Kind>& cpp_utils_log_category_tmp__ =                         \
+                            eprosima::utils::CategoryVerbosityRegistry::get_instance().register_category(#cat); \
+                    if (eprosima::utils::CategoryVerbosityRegistry::is_enabled(cpp_utils_log_category_tmp__,    \
+                            Log::Kind::Info) && Log::GetVerbosity() >= Log::Kind::Info)                         \
+                    {                                                                                           \
+                        std::stringstream fastdds_log_ss_tmp__;                                                 \
+                        fastdds_log_ss_tmp__ << "DEBUG: " << msg;                                               \
+                        eprosima::utils::LogStaging::queue_log(fastdds_log_ss_tmp__.str(),                      \
+                                Log::Context{__FILE__, __LINE__, cpp_utils_log_function_tmp__, #cat},           \
+                                Log::Kind::Info);                                                               \
+                    }                                                                                           \
+                });                                                                                             \
     }
 #elif (__INTERNALDEBUG || _INTERNALDEBUG)
 #define logDebug_(cat, msg)                                 \
@@ -92,16 +118,24 @@ using LogConsumer = eprosima::fastdds::dds::LogConsumer;
     (defined(FASTDDS_ENFORCE_LOG_INFO) || \
     ((defined(__INTERNALDEBUG) || defined(_INTERNALDEBUG)) && (defined(_DEBUG) || defined(__DEBUG) || \
     !defined(NDEBUG))))
-#define logDevError_(cat, msg)                                                                        \
-    {                                                                                                   \
-        using namespace eprosima::fastdds::dds;                                                         \
-        if (Log::GetVerbosity() >= Log::Kind::Info)                                                     \
-        {                                                                                               \
-            std::stringstream fastdds_log_ss_tmp__;                                                     \
-            fastdds_log_ss_tmp__ << "DEV_WARNING: " << msg;                                             \
-            Log::QueueLog(fastdds_log_ss_tmp__.str(), Log::Context{__FILE__, __LINE__, __func__, #cat}, \
-                    Log::Kind::Warning);                                                                   \
-        }                                                                                               \
+#define logDevError_(cat, msg)                                                                                  \
+    {                                                                                                           \
+        using namespace eprosima::fastdds::dds;                                                                 \
+        eprosima::utils::log_if_compiled(CPP_UTILS_LOG_COMPILED_TAG(cat, Log::Kind::Warning), __func__,         \
+                [&](auto cpp_utils_log_function_tmp__)                                                          \
+                {                                                                                               \
+                    static const std::atomic<Log::Kind>& cpp_utils_log_category_tmp__ =                         \
+                            eprosima::utils::CategoryVerbosityRegistry::get_instance().register_category(#cat); \
+                    if (eprosima::utils::CategoryVerbosityRegistry::is_enabled(cpp_utils_log_category_tmp__,    \
+                            Log::Kind::Warning) && Log::GetVerbosity() >= Log::Kind::Info)                      \
+                    {                                                                                           \
+                        std::stringstream fastdds_log_ss_tmp__;                                                 \
+                        fastdds_log_ss_tmp__ << "DEV_WARNING: " << msg;                                         \
+                        eprosima::utils::LogStaging::queue_log(fastdds_log_ss_tmp__.str(),                      \
+                                Log::Context{__FILE__, __LINE__, cpp_utils_log_function_tmp__, #cat},           \
+                                Log::Kind::Warning);                                                            \
+                    }                                                                                           \
+                });                                                                                             \
     }
 #elif (__INTERNALDEBUG || _INTERNALDEBUG)
 #define logDevError_(cat, msg)                            \
@@ -0,0 +1,267 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file ShardedSafeDatabase.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+#include <cpp_utils/collection/database/IModificableDatabase.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Shard of a \c ShardedSafeDatabase : a part of its values, with a lock of its own.
+ *
+ * @tparam \c Key key type of the ShardedSafeDatabase.
+ * @tparam \c Value internal value type of the ShardedSafeDatabase.
+ */
+template <typename Key, typename Value>
+struct SafeDatabaseShard
+{
+    //! Values of the keys that belong to this shard.
+    std::map<Key, Value> internal_db;
+
+    /**
+     * @brief Guard access to \c internal_db .
+     *
+     * It shares lock for read methods and iterators, and uses unique lock for write methods.
+     */
+    mutable std::shared_timed_mutex mutex;
+
+    //! Number of keys in \c internal_db , to be read without locking.
+    std::atomic<unsigned int> size{0};
+};
+
+/**
+ * @brief Iterator over \c ShardedSafeDatabase .
+ *
+ * It goes over the values of every shard merged by key, so they are given in the same order as a \c SafeDatabase
+ * with the same values would give them.
+ *
+ * This iterator keeps every shard of the database shared locked until it is destroyed.
+ * Thus, the database cannot change (add, modify, erase) while the iterator exists.
+ * However, other iterators and read methods could still be used while iterator exists.
+ *
+ * @attention this iterator blocks access to database, so keep it alive as less as possible.
+ *
+ * @tparam \c Key key type of the ShardedSafeDatabase.
+ * @tparam \c Value internal value type of the ShardedSafeDatabase.
+ *
+ * @warning while using this iterator the shared mutex of every shard is locked.
+ * As in \c SafeDatabaseIterator , in Windows a unique lock call blocks every other future shared lock, so
+ * if using these iterators in a loop, set end() before the loop and not in every iteration.
+ */
+template <typename Key, typename Value>
+class ShardedSafeDatabaseIterator
+{
+public:
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename std::map<Key, Value>::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+    //! Shards of the database iterated.
+    using Shards = std::vector<std::unique_ptr<SafeDatabaseShard<Key, Value>>>;
+
+    /**
+     * @brief Construct an iterator pointing to the end of the database, with every shard shared locked.
+     *
+     * @param shards shards of the database. They must outlive the iterator.
+     */
+    ShardedSafeDatabaseIterator(
+            const Shards& shards);
+
+    //! Copy the position of \c other , locking the shards again.
+    ShardedSafeDatabaseIterator(
+            const ShardedSafeDatabaseIterator& other);
+
+    ShardedSafeDatabaseIterator& operator =(
+            const ShardedSafeDatabaseIterator& other) = delete;
+
+    ~ShardedSafeDatabaseIterator();
+
+    reference operator *() const;
+
+    pointer operator ->() const;
+
+    //! Go to the next key, among every shard.
+    ShardedSafeDatabaseIterator& operator ++();
+
+    //! Whether both iterators point to the same value, or both point to the end.
+    bool operator ==(
+            const ShardedSafeDatabaseIterator& other) const;
+
+    bool operator !=(
+            const ShardedSafeDatabaseIterator& other) const;
+
+protected:
+
+    //! Point \c current_ to the shard whose position has the lowest key, or to the end if every shard has ended.
+    void select_current_();
+
+    //! Shards iterated.
+    const Shards& shards_;
+
+    //! Position in each shard. Every key before it, in every shard, has already been given.
+    std::vector<typename std::map<Key, Value>::const_iterator> positions_;
+
+    //! Index of the shard of the value pointed. Number of shards if it points to the end.
+    std::size_t current_;
+
+    template <typename K, typename V, typename H>
+    friend class ShardedSafeDatabase;
+};
+
+/**
+ * This class implements the Interface \c IModificableDatabase in a thread safe way, for many concurrent writers.
+ *
+ * It gives the same methods as \c SafeDatabase , but the values are split in shards by the hash of their key,
+ * each stored in its own std::map guarded by its own lock.
+ * Thus, writes of keys in different shards do not block each other, while in \c SafeDatabase every write
+ * takes the only lock.
+ *
+ * Iteration merges the shards by key, and it keeps all of them shared locked while the iterator exists,
+ * so the database could not change its state while there is an alive iterator, as in \c SafeDatabase .
+ *
+ * \c size does not lock: it adds the counters of the shards, updated with every add and erase, so while values are
+ * being added or erased it may not match the number of values an iteration would give.
+ *
+ * @tparam \c Key type to use as key/index of map. It must be hashable by \c Hash .
+ * @tparam \c Value type to use as internal value stored on map.
+ * @tparam \c Hash function object type to hash the keys, that chooses their shard.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class ShardedSafeDatabase : public IModificableDatabase<Key, Value, ShardedSafeDatabaseIterator<Key, Value>>
+{
+public:
+
+    //! Default number of shards.
+    static constexpr unsigned int DEFAULT_SHARDS = 16;
+
+    /**
+     * @brief Construct an empty database split in \c shards shards.
+     *
+     * @param shards number of shards. At least 1. More shards allow more concurrent writers, but make iteration
+     * slower.
+     * @param hash function object to hash the keys.
+     */
+    ShardedSafeDatabase(
+            unsigned int shards = DEFAULT_SHARDS,
+            const Hash& hash = Hash());
+
+    //! Override \c add \c IDatabase method.
+    bool add(
+            Key&& key,
+            Value&& value) override;
+
+    //! Override \c modify \c IModificableDatabase method.
+    bool modify(
+            const Key& key,
+            Value&& value) override;
+
+    //! Override \c add_or_modify \c IModificableDatabase method.
+    bool add_or_modify(
+            Key&& key,
+            Value&& value) override;
+
+    //! Override \c erase \c IModificableDatabase method.
+    bool erase(
+            const Key& key) override;
+
+    //! Override \c is \c IDatabase method.
+    bool is(
+            const Key& key) const override;
+
+    //! Override \c find \c IDatabase method.
+    ShardedSafeDatabaseIterator<Key, Value> find(
+            const Key& key) const override;
+
+    //! Override \c begin \c IDatabase method.
+    ShardedSafeDatabaseIterator<Key, Value> begin() const override;
+
+    //! Override \c end \c IDatabase method.
+    ShardedSafeDatabaseIterator<Key, Value> end() const override;
+
+    //! \c add using copy semantics instead of movement.
+    bool add(
+            const Key& key,
+            const Value& value);
+
+    /**
+     * @brief Return a copy of the value indexed by \c key .
+     *
+     * It only locks the shard of \c key .
+     *
+     * @param key index of the value to look for.
+     *
+     * @return copy of the internal value if exist.
+     * @throw \c std::out_of_range if key not in database.
+     */
+    Value at(
+            const Key& key) const;
+
+    /**
+     * @brief Number of keys stored.
+     *
+     * It does not lock, so it is approximate while other threads add or erase values.
+     * It goes over every shard, so it is slower with more shards.
+     */
+    unsigned int size() const noexcept;
+
+    //! \c add_or_modify using copy semantics instead of movement.
+    bool add_or_modify(
+            const Key& key,
+            const Value& value);
+
+    //! Number of shards.
+    unsigned int shards() const noexcept;
+
+protected:
+
+    //! Index of the shard where \c key belongs.
+    std::size_t shard_index_(
+            const Key& key) const;
+
+    //! Shard where \c key belongs.
+    SafeDatabaseShard<Key, Value>& shard_(
+            const Key& key) const;
+
+    //! Shards, each with the values of the keys whose hash belongs to it.
+    typename ShardedSafeDatabaseIterator<Key, Value>::Shards shards_;
+
+    //! Hash of the keys.
+    Hash hash_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/collection/database/impl/ShardedSafeDatabase.ipp>
@@ -0,0 +1,329 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file ShardedSafeDatabase.ipp
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+namespace eprosima {
+namespace utils {
+
+template <typename Key, typename Value>
+ShardedSafeDatabaseIterator<Key, Value>::ShardedSafeDatabaseIterator(
+        const Shards& shards)
+    : shards_(shards)
+    , current_(shards.size())
+{
+    positions_.reserve(shards_.size());
+    for (const auto& shard : shards_)
+    {
+        shard->mutex.lock_shared();
+        positions_.push_back(shard->internal_db.end());
+    }
+}
+
+template <typename Key, typename Value>
+ShardedSafeDatabaseIterator<Key, Value>::ShardedSafeDatabaseIterator(
+        const ShardedSafeDatabaseIterator& other)
+    : shards_(other.shards_)
+    , positions_(other.positions_)
+    , current_(other.current_)
+{
+    for (const auto& shard : shards_)
+    {
+        shard->mutex.lock_shared();
+    }
+}
+
+template <typename Key, typename Value>
+ShardedSafeDatabaseIterator<Key, Value>::~ShardedSafeDatabaseIterator()
+{
+    for (const auto& shard : shards_)
+    {
+        shard->mutex.unlock_shared();
+    }
+}
+
+template <typename Key, typename Value>
+typename ShardedSafeDatabaseIterator<Key, Value>::reference ShardedSafeDatabaseIterator<Key, Value>::operator *() const
+{
+    return *positions_[current_];
+}
+
+template <typename Key, typename Value>
+typename ShardedSafeDatabaseIterator<Key, Value>::pointer ShardedSafeDatabaseIterator<Key, Value>::operator ->() const
+{
+    return &(*positions_[current_]);
+}
+
+template <typename Key, typename Value>
+ShardedSafeDatabaseIterator<Key, Value>& ShardedSafeDatabaseIterator<Key, Value>::operator ++()
+{
+    ++positions_[current_];
+    select_current_();
+    return *this;
+}
+
+template <typename Key, typename Value>
+bool ShardedSafeDatabaseIterator<Key, Value>::operator ==(
+        const ShardedSafeDatabaseIterator& other) const
+{
+    if (current_ != other.current_)
+    {
+        return false;
+    }
+
+    // Positions in the rest of shards may differ, but they all point to keys after the current one
+    return current_ == positions_.size() || positions_[current_] == other.positions_[current_];
+}
+
+template <typename Key, typename Value>
+bool ShardedSafeDatabaseIterator<Key, Value>::operator !=(
+        const ShardedSafeDatabaseIterator& other) const
+{
+    return !(*this == other);
+}
+
+template <typename Key, typename Value>
+void ShardedSafeDatabaseIterator<Key, Value>::select_current_()
+{
+    const auto key_less = typename std::map<Key, Value>::key_compare();
+
+    current_ = positions_.size();
+    for (std::size_t i = 0; i < positions_.size(); ++i)
+    {
+        if (positions_[i] == shards_[i]->internal_db.end())
+        {
+            continue;
+        }
+
+        if (current_ == positions_.size() || key_less(positions_[i]->first, positions_[current_]->first))
+        {
+            current_ = i;
+        }
+    }
+}
+
+template <typename Key, typename Value, typename Hash>
+constexpr unsigned int ShardedSafeDatabase<Key, Value, Hash>::DEFAULT_SHARDS;
+
+template <typename Key, typename Value, typename Hash>
+ShardedSafeDatabase<Key, Value, Hash>::ShardedSafeDatabase(
+        unsigned int shards /* = DEFAULT_SHARDS */,
+        const Hash& hash /* = Hash() */)
+    : hash_(hash)
+{
+    shards_.reserve(std::max(shards, 1u));
+    for (unsigned int i = 0; i < std::max(shards, 1u); ++i)
+    {
+        shards_.push_back(std::unique_ptr<SafeDatabaseShard<Key, Value>>(new SafeDatabaseShard<Key, Value>()));
+    }
+}
+
+template <typename Key, typename Value, typename Hash>
+bool ShardedSafeDatabase<Key, Value, Hash>::add(
+        Key&& key,
+        Value&& value)
+{
+    SafeDatabaseShard<Key, Value>& shard = shard_(key);
+    std::unique_lock<std::shared_timed_mutex> _(shard.mutex);
+
+    auto res = shard.internal_db.insert(std::pair<Key, Value>(std::move(key), std::move(value)));
+    if (res.second)
+    {
+        shard.size.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return res.second;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool ShardedSafeDatabase<Key, Value, Hash>::modify(
+        const Key& key,
+        Value&& value)
+{
+    SafeDatabaseShard<Key, Value>& shard = shard_(key);
+    std::unique_lock<std::shared_timed_mutex> _(shard.mutex);
+
+    auto it = shard.internal_db.find(key);
+    if (it == shard.internal_db.end())
+    {
+        return false;
+    }
+
+    it->second = std::move(value);
+
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool ShardedSafeDatabase<Key, Value, Hash>::add_or_modify(
+        Key&& key,
+        Value&& value)
+{
+    SafeDatabaseShard<Key, Value>& shard = shard_(key);
+    std::unique_lock<std::shared_timed_mutex> _(shard.mutex);
+
+    auto it = shard.internal_db.find(key);
+    if (it == shard.internal_db.end())
+    {
+        // Add new value
+        shard.internal_db.insert(std::pair<Key, Value>(std::move(key), std::move(value)));
+        shard.size.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    else
+    {
+        // Modify already existent value
+        it->second = std::move(value);
+        return false;
+    }
+}
+
+template <typename Key, typename Value, typename Hash>
+bool ShardedSafeDatabase<Key, Value, Hash>::erase(
+        const Key& key)
+{
+    SafeDatabaseShard<Key, Value>& shard = shard_(key);
+    std::unique_lock<std::shared_timed_mutex> _(shard.mutex);
+
+    if (shard.internal_db.erase(key) == 0)
+    {
+        return false;
+    }
+
+    shard.size.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool ShardedSafeDatabase<Key, Value, Hash>::is(
+        const Key& key) const
+{
+    const SafeDatabaseShard<Key, Value>& shard = shard_(key);
+    std::shared_lock<std::shared_timed_mutex> _(shard.mutex);
+
+    return shard.internal_db.find(key) != shard.internal_db.end();
+}
+
+template <typename Key, typename Value, typename Hash>
+ShardedSafeDatabaseIterator<Key, Value> ShardedSafeDatabase<Key, Value, Hash>::find(
+        const Key& key) const
+{
+    ShardedSafeDatabaseIterator<Key, Value> it(shards_);
+
+    // The key is only in its shard, so the rest start at the first key after it
+    for (std::size_t i = 0; i < shards_.size(); ++i)
+    {
+        it.positions_[i] = shards_[i]->internal_db.lower_bound(key);
+    }
+
+    const std::size_t index = shard_index_(key);
+    const auto key_less = typename std::map<Key, Value>::key_compare();
+    if (it.positions_[index] != shards_[index]->internal_db.end() && !key_less(key, it.positions_[index]->first))
+    {
+        it.current_ = index;
+    }
+
+    return it;
+}
+
+template <typename Key, typename Value, typename Hash>
+ShardedSafeDatabaseIterator<Key, Value> ShardedSafeDatabase<Key, Value, Hash>::begin() const
+{
+    ShardedSafeDatabaseIterator<Key, Value> it(shards_);
+
+    for (std::size_t i = 0; i < shards_.size(); ++i)
+    {
+        it.positions_[i] = shards_[i]->internal_db.begin();
+    }
+    it.select_current_();
+
+    return it;
+}
+
+template <typename Key, typename Value, typename Hash>
+ShardedSafeDatabaseIterator<Key, Value> ShardedSafeDatabase<Key, Value, Hash>::end() const
+{
+    return ShardedSafeDatabaseIterator<Key, Value>(shards_);
+}
+
+template <typename Key, typename Value, typename Hash>
+bool ShardedSafeDatabase<Key, Value, Hash>::add(
+        const Key& key,
+        const Value& value)
+{
+    return add(Key(key), Value(value));
+}
+
+template <typename Key, typename Value, typename Hash>
+Value ShardedSafeDatabase<Key, Value, Hash>::at(
+        const Key& key) const
+{
+    const SafeDatabaseShard<Key, Value>& shard = shard_(key);
+    std::shared_lock<std::shared_timed_mutex> _(shard.mutex);
+
+    return shard.internal_db.at(key);
+}
+
+template <typename Key, typename Value, typename Hash>
+unsigned int ShardedSafeDatabase<Key, Value, Hash>::size() const noexcept
+{
+    unsigned int size = 0;
+    for (const auto& shard : shards_)
+    {
+        size += shard->size.load(std::memory_order_relaxed);
+    }
+    return size;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool ShardedSafeDatabase<Key, Value, Hash>::add_or_modify(
+        const Key& key,
+        const Value& value)
+{
+    return add_or_modify(Key(key), Value(value));
+}
+
+template <typename Key, typename Value, typename Hash>
+unsigned int ShardedSafeDatabase<Key, Value, Hash>::shards() const noexcept
+{
+    return static_cast<unsigned int>(shards_.size());
+}
+
+template <typename Key, typename Value, typename Hash>
+std::size_t ShardedSafeDatabase<Key, Value, Hash>::shard_index_(
+        const Key& key) const
+{
+    // Mix the hash, as hashes of integers are usually the integer itself and keys may share their low bits
+    const uint64_t hash = static_cast<uint64_t>(hash_(key)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<std::size_t>((hash >> 32) % shards_.size());
+}
+
+template <typename Key, typename Value, typename Hash>
+SafeDatabaseShard<Key, Value>& ShardedSafeDatabase<Key, Value, Hash>::shard_(
+        const Key& key) const
+{
+    return *shards_[shard_index_(key)];
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
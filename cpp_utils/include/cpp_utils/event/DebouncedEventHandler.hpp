@@ -0,0 +1,224 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DebouncedEventHandler.hpp
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+
+#include <cpp_utils/event/EventHandler.hpp>
+#include <cpp_utils/time/TimerService.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+/**
+ * @brief Times that decide when a \c DebouncedEventHandler calls its callback.
+ *
+ * Every time is in milliseconds, and 0 disables it.
+ */
+struct DebounceConfiguration
+{
+    //! Trailing edge: the callback is called once no event has arrived during this time.
+    Duration_ms debounce_window {0};
+
+    //! Leading edge: the first event calls the callback at once, and the next ones are held during this time.
+    Duration_ms throttle_window {0};
+
+    //! Maximum time the first event held can wait, even if events keep arriving.
+    Duration_ms max_wait {0};
+};
+
+/**
+ * @brief This class is an \c EventHandler that collapses the bursts of events of another EventHandler.
+ *
+ * Events of the source handler are not forwarded one by one. Instead, the events of a burst are accumulated
+ * and the callback is called once with the last arguments (or with the result of an aggregation function).
+ * When the callback is called is decided by a \c DebounceConfiguration :
+ * - With a \c debounce_window , the callback is called once the source has been quiet during the window.
+ * - With a \c throttle_window , an event outside the window calls the callback at once, and the events inside it
+ *   are held until the window ends.
+ * - With a \c max_wait , events are never held longer than this time, even if the source never gets quiet.
+ *
+ * Held events are released from a \c TimerService , that by default is shared by every handler.
+ * The timer only hands the events released to an emission thread of the handler, that calls the callback,
+ * so a slow callback never delays the timers of other objects sharing the service.
+ * The emission thread is only created if some event can be held (a debounce or throttle window is set).
+ */
+template <typename ... Args>
+class DebouncedEventHandler : public EventHandler<Args...>
+{
+public:
+
+    //! Arguments of an event as stored while it is held.
+    using Arguments = std::tuple<typename std::decay<Args>::type...>;
+
+    /**
+     * @brief Function that merges the arguments of a new event into the ones held.
+     *
+     * @param accumulated arguments held, to be updated.
+     * @param latest arguments of the new event.
+     */
+    using Aggregator = std::function<void(Arguments& accumulated, const Arguments& latest)>;
+
+    /**
+     * @brief Construct a new Debounced Event Handler over the events of \c source .
+     *
+     * @param source handler whose events are debounced. Its callback is set by this object.
+     * @param configuration times of the debouncing.
+     * @param aggregator function to merge events held. If not set, the last event replaces the previous ones.
+     * @param timer_service service that releases held events. It must outlive this object.
+     */
+    DebouncedEventHandler(
+            std::unique_ptr<EventHandler<Args...>> source,
+            const DebounceConfiguration& configuration,
+            Aggregator aggregator = nullptr,
+            TimerService& timer_service = TimerService::shared());
+
+    /**
+     * @brief Construct a new Debounced Event Handler with specific callback
+     *
+     * @param callback : callback to call with the events debounced
+     */
+    DebouncedEventHandler(
+            typename EventHandler<Args...>::Callback callback,
+            std::unique_ptr<EventHandler<Args...>> source,
+            const DebounceConfiguration& configuration,
+            Aggregator aggregator = nullptr,
+            TimerService& timer_service = TimerService::shared());
+
+    /**
+     * @brief Destroy the DebouncedEventHandler object
+     *
+     * Calls \c unset_callback , destroys the source, discards the events held and stops the emission thread.
+     * It must not be destroyed from its own callback.
+     */
+    ~DebouncedEventHandler();
+
+protected:
+
+    //! Callback of the source handler: hold the event or call the callback.
+    void source_event_(
+            EventArgument<Args>... args) noexcept;
+
+    //! Task of the timer: release the events held to the emission thread if their time has come.
+    void timer_expired_() noexcept;
+
+    //! Routine of the emission thread: call the callback with the events released.
+    void emission_routine_() noexcept;
+
+    //! Schedule the timer at \c deadline_ . Must be called with \c debounce_mutex_ locked.
+    void schedule_timer_nts_();
+
+    //! Call the callback with \c arguments .
+    void emit_(
+            const Arguments& arguments) noexcept;
+
+    //! Times of the debouncing.
+    const DebounceConfiguration configuration_;
+
+    //! Function to merge events held. \c nullptr to keep only the last one.
+    const Aggregator aggregator_;
+
+    //! Service that releases held events.
+    TimerService& timer_service_;
+
+    //! Handler whose events are debounced.
+    std::unique_ptr<EventHandler<Args...>> source_;
+
+    /**
+     * @brief Arguments of the events held. \c nullptr if there are none.
+     *
+     * Guarded by \c debounce_mutex_
+     */
+    std::unique_ptr<Arguments> held_arguments_;
+
+    /**
+     * @brief Time of the first event held.
+     *
+     * Guarded by \c debounce_mutex_
+     */
+    TimerService::Clock::time_point burst_start_;
+
+    /**
+     * @brief Time when the events held must be released.
+     *
+     * Guarded by \c debounce_mutex_
+     */
+    TimerService::Clock::time_point deadline_;
+
+    /**
+     * @brief End of the current throttle window.
+     *
+     * Guarded by \c debounce_mutex_
+     */
+    TimerService::Clock::time_point throttle_until_;
+
+    /**
+     * @brief Id of the timer task scheduled. 0 if none.
+     *
+     * There is at most one task scheduled: if the deadline moves while it waits, the task schedules itself again.
+     *
+     * Guarded by \c debounce_mutex_
+     */
+    TimerTaskId timer_id_ {0};
+
+    /**
+     * @brief Id of the last timer task that started running. 0 if none.
+     *
+     * Guarded by \c debounce_mutex_
+     */
+    TimerTaskId running_timer_id_ {0};
+
+    /**
+     * @brief Arguments of the events released by the timer and not emitted yet. \c nullptr if there are none.
+     *
+     * Guarded by \c debounce_mutex_
+     */
+    std::unique_ptr<Arguments> released_arguments_;
+
+    /**
+     * @brief Whether the object is being destroyed, so the timer must not be scheduled again.
+     *
+     * Guarded by \c debounce_mutex_
+     */
+    bool stopped_ {false};
+
+    //! Protects the events held and the timer.
+    std::mutex debounce_mutex_;
+
+    //! Notifies the emission thread when events are released or when stopping.
+    std::condition_variable released_cv_;
+
+    //! Thread that calls the callback with the events released by the timer.
+    std::thread emission_thread_;
+};
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/event/impl/DebouncedEventHandler.ipp>
@@ -0,0 +1,170 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file EventBus.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <cpp_utils/event/EventHandler.hpp>
+#include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
+#include <cpp_utils/thread_pool/strand/Strand.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+//! Token that identifies a subscription to an \c EventBus .
+using SubscriptionId = uint32_t;
+
+/**
+ * @brief This class is an \c EventHandler that forwards every event to any number of subscribers.
+ *
+ * Events are published with \c publish , or by setting \c publisher as the callback of other EventHandlers.
+ * Each subscriber is identified by the token returned by \c subscribe , that is used to \c unsubscribe it.
+ *
+ * The list of subscribers is copy-on-write: subscribing or unsubscribing creates a new list and swaps it
+ * atomically, so publishing only takes a reference to the current list and never waits for a lock.
+ *
+ * By default, subscribers are called in the publishing thread, one after the other.
+ * If constructed with a \c SlotThreadPool , each event is dispatched in the pool instead: every subscriber is called
+ * from a pool thread, subscribers run in parallel, and each of them still receives the events in publishing order.
+ * In this case arguments are copied once per event and shared by every subscriber.
+ */
+template <typename ... Args>
+class EventBus : public EventHandler<Args...>
+{
+public:
+
+    //! Type of the callback of each subscriber.
+    using Callback = typename EventHandler<Args...>::Callback;
+
+    /**
+     * @brief Construct an EventBus that calls subscribers in the publishing thread.
+     */
+    EventBus();
+
+    /**
+     * @brief Construct an EventBus that calls subscribers from the threads of \c thread_pool .
+     *
+     * @param thread_pool pool where subscribers are called. It must outlive this object.
+     */
+    EventBus(
+            SlotThreadPool& thread_pool);
+
+    /**
+     * @brief Destroy the EventBus
+     *
+     * Calls \c unset_callback and waits for every subscriber running.
+     * Events already dispatched in the thread pool are discarded.
+     */
+    ~EventBus();
+
+    /**
+     * @brief Add a new subscriber that will be called with every event published from now on.
+     *
+     * @param callback function to call with each event.
+     * @return token to unsubscribe it.
+     */
+    SubscriptionId subscribe(
+            Callback callback);
+
+    /**
+     * @brief Remove the subscriber identified by \c id .
+     *
+     * Once this method returns, the subscriber is not running and it will not be called again
+     * (unless this is called from the subscriber itself, which finishes normally).
+     *
+     * @return whether \c id was subscribed.
+     */
+    bool unsubscribe(
+            SubscriptionId id);
+
+    //! Publish an event to every subscriber.
+    void publish(
+            EventArgument<Args>... args) noexcept;
+
+    //! Function that publishes its arguments in this bus, to be used as callback of other EventHandlers.
+    Callback publisher() noexcept;
+
+    //! Number of subscribers.
+    std::size_t subscribers() const noexcept;
+
+protected:
+
+    /**
+     * @brief Subscriber registered in the bus.
+     *
+     * It counts the calls of its callback running as a callback snapshot, and it is retired once unsubscribed.
+     */
+    struct Subscriber : public EventHandler<Args...>::CallbackSnapshot
+    {
+        Subscriber(
+                SubscriptionId id,
+                Callback&& callback);
+
+        //! Token of the subscriber.
+        const SubscriptionId id;
+    };
+
+    using SubscriberList = std::vector<std::shared_ptr<Subscriber>>;
+
+    //! Forward an event to every subscriber. This is the callback of this handler.
+    void dispatch_(
+            EventArgument<Args>... args) noexcept;
+
+    //! Call \c subscriber with an event if it is still active.
+    static void call_(
+            Subscriber& subscriber,
+            EventArgument<Args>... args) noexcept;
+
+    //! Retire \c subscriber and wait until it is not running in other threads.
+    static void deactivate_(
+            Subscriber& subscriber) noexcept;
+
+    /**
+     * @brief Current list of subscribers.
+     *
+     * Only accessed with \c std::atomic_load and \c std::atomic_store .
+     */
+    std::shared_ptr<const SubscriberList> subscribers_;
+
+    //! Serializes the modifications of \c subscribers_ .
+    std::mutex subscribers_mutex_;
+
+    //! Token of the next subscriber.
+    std::atomic<SubscriptionId> next_id_;
+
+    /**
+     * @brief Strands where subscribers are called when dispatching in a thread pool. Empty otherwise.
+     *
+     * Each subscriber always uses the same strand, so its events keep their order.
+     */
+    std::vector<std::unique_ptr<Strand>> strands_;
+};
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/event/impl/EventBus.ipp>
@@ -21,7 +21,10 @@
 #include <atomic>
 #include <condition_variable>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <type_traits>
+#include <vector>
 
 namespace eprosima {
 namespace utils {
@@ -48,6 +51,30 @@ public:
 
 };
 
+/**
+ * @brief Whether event arguments of type \c T are passed to callbacks by value instead of by const reference.
+ *
+ * Scalar types (numbers, enumerations and pointers) are passed by value, as copying them is cheaper than
+ * referencing them. Specialize this struct as \c std::true_type to opt-in any other cheap to copy type.
+ */
+template <typename T>
+struct PassEventByValue : public std::is_scalar<T>
+{
+};
+
+/**
+ * @brief Type used to pass an event argument of type \c T through an \c EventHandler .
+ *
+ * Arguments are passed by const reference unless \c PassEventByValue is set for \c T ,
+ * so the payload of an event is not copied on its way from the source of the event to the callback.
+ * Arguments already declared as references are passed as they are.
+ */
+template <typename T>
+using EventArgument = typename std::conditional<
+    std::is_reference<T>::value || PassEventByValue<T>::value,
+    T,
+    const T&>::type;
+
 /**
  * This class is an interface for any class that implements a handler of any kind of event.
  * Consider an event every signal that a process can receive externally.
@@ -64,6 +91,15 @@ public:
  * EventHandler object is disabled.
  *
  * It is a template regarding the arguments that the Event Handler needs in its callback.
+ * Arguments are passed from the event to the callback as \c EventArgument (by const reference for non scalar types),
+ * so they are never copied on the way. A callback that takes an argument by value opts-in to copy it.
+ *
+ * The callback is stored as a reference counted snapshot that is swapped atomically (RCU-style).
+ * Each event takes a reference to the current snapshot and calls it without holding any lock, so events
+ * from different threads run the callback concurrently, and a slow callback does not block \c set_callback .
+ * A snapshot replaced is released once the last event using it finishes.
+ * Each snapshot counts the events running it, so \c unset_callback waits only for the events that took the
+ * callback before it was unset, and never for events arriving later.
  *
  * It inherits from \c IBaseEventHandler so every \c EventHandler specialization has a common interface.
  *
@@ -82,6 +118,9 @@ class EventHandler : public IBaseEventHandler
 {
 public:
 
+    //! Type of the callback of this handler.
+    using Callback = std::function<void(EventArgument<Args>...)>;
+
     /**
      * @brief Default constructor
      *
@@ -98,10 +137,12 @@ public:
      * It calls the internal method \c callback_set_ once the callback is set so
      * child classes can add functionality when a callback is set.
      *
+     * It does not wait for events being processed: they finish with the previous callback.
+     *
      * @param callback : new callback for this Event
      */
     void set_callback(
-            std::function<void(Args...)> callback) noexcept;
+            Callback callback) noexcept;
 
     /**
      * @brief Unset the callback and set this object as disabled
@@ -109,7 +150,9 @@ public:
      * It calls the internal method \c callback_unset_ once the callback is unset so
      * child classes can add functionality when a callback is unset.
      *
-     * It waits in \c event_mutex_ if the callback is being called.
+     * Once this method returns, the callback is not running and it will not be called again.
+     * For that, it waits for every event being processed, except those of the calling thread
+     * (so it can be called from the callback itself).
      */
     void unset_callback() noexcept;
 
@@ -138,7 +181,7 @@ public:
 
     //! Simulate as if the event had occurred
     void simulate_event_occurred(
-            Args... args) noexcept;
+            EventArgument<Args>... args) noexcept;
 
 protected:
 
@@ -150,7 +193,15 @@ protected:
      * @param arg : argument of the callback to call
      */
     void event_occurred_(
-            Args... args) noexcept;
+            EventArgument<Args>... args) noexcept;
+
+    /**
+     * @brief Do not leave this method until every callback running in other threads has finished
+     *
+     * It waits for the snapshots in \c retired_callbacks_ , and it must be called only once the current snapshot
+     * has been removed and retired.
+     */
+    void wait_callbacks_finished_nts_() noexcept;
 
     /**
      * @brief Do not leave this method until every thread waiting in \c wait_for_event has exited
@@ -189,8 +240,58 @@ protected:
      */
     virtual void callback_unset_nts_() noexcept;
 
-    //! Internal callback reference
-    std::function<void(Args...)> callback_;
+    /**
+     * @brief Callback set in the handler, and the number of events calling it.
+     *
+     * An event registers in the snapshot before calling the callback. Once the snapshot is retired (replaced or
+     * unset) no event registers any more, so waiting for the events registered always ends.
+     */
+    struct CallbackSnapshot
+    {
+        CallbackSnapshot(
+                Callback&& callback);
+
+        //! Register an event calling \c callback . Return false if the snapshot is retired.
+        bool enter() noexcept;
+
+        //! Unregister an event registered with \c enter .
+        void exit() noexcept;
+
+        //! Do not register new events.
+        void retire() noexcept;
+
+        //! Wait until at most \c own_calls events are registered. The snapshot must be retired.
+        void wait_calls_finished(
+                uint32_t own_calls) noexcept;
+
+        //! Flag set in \c calls once the snapshot is retired.
+        static constexpr uint32_t RETIRED = 0x80000000u;
+
+        const Callback callback;
+
+        //! Number of events calling \c callback , plus \c RETIRED flag.
+        std::atomic<uint32_t> calls;
+
+        //! Guard access to \c calls_finished_cv
+        std::mutex calls_mutex;
+
+        //! Notifies events unregistered from a retired snapshot.
+        std::condition_variable calls_finished_cv;
+    };
+
+    /**
+     * @brief Snapshot of the current callback. \c nullptr if not set.
+     *
+     * Only accessed with \c std::atomic_load and \c std::atomic_exchange .
+     */
+    std::shared_ptr<CallbackSnapshot> callback_;
+
+    /**
+     * @brief Snapshots replaced or unset that events could still be calling.
+     *
+     * Guard by \c event_mutex_
+     */
+    std::vector<std::shared_ptr<CallbackSnapshot>> retired_callbacks_;
 
     /**
      * @brief Whether the callback of this Handler is set
@@ -201,9 +302,6 @@ protected:
      */
     std::atomic<bool> is_callback_set_;
 
-    //! Mutex to block EventHandler execution while lambda is being set/unset or called
-    mutable std::recursive_mutex internal_callback_mutex_;
-
     //! Mutex to block set and unset callbacks from outside the class
     mutable std::recursive_mutex event_mutex_;
 
@@ -230,14 +328,6 @@ protected:
 
     //! Guard access to \c wait_condition_variable_
     mutable std::mutex wait_mutex_;
-
-    /**
-     * @brief Default callback.
-     *
-     * @note This callback should never be called as the callback is not called
-     * unless \c is_callback_set_ is true. However, it is useful for constructor without callback
-     */
-    static const std::function<void(Args...)> DEFAULT_CALLBACK_;
 };
 
 } /* namespace event */
@@ -0,0 +1,139 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FileContentWatcherHandler.hpp
+ */
+
+#pragma once
+
+#if defined(__linux__)
+
+#include <functional>
+#include <string>
+
+#include <cpp_utils/event/EventHandler.hpp>
+#include <cpp_utils/event/FileWatcherService.hpp>
+#include <cpp_utils/file/file_utils.hpp>
+#include <cpp_utils/library/library_dll.h>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+/**
+ * @brief Change of the content of a file watched by a \c FileContentWatcherHandler .
+ */
+struct FileChange
+{
+    //! Name of the file changed.
+    std::string file_name;
+
+    //! Content hash, size and modification time of the file, so consumers can skip reading it again.
+    FileSnapshot snapshot;
+};
+
+/**
+ * It implements the functionality to watch over a specific file and raise a callback
+ * every time the content of the file has changed.
+ *
+ * Unlike \c FileWatcherHandler , partial writes are not notified: the file is only checked once it has been
+ * closed after being written, or once it has been replaced by a file moved in.
+ * Then the content is hashed, and the callback is only raised if the hash differs from the one of the last
+ * content notified (or the one found when the watch started), so touching or rewriting the same content
+ * does not raise it.
+ *
+ * The file is watched in the \c FileWatcherService , and it is hashed from its dispatcher thread.
+ *
+ * @note Only available in Linux.
+ */
+class FileContentWatcherHandler : public EventHandler<FileChange>
+{
+public:
+
+    /**
+     * @brief Construct a new File Content Watcher for file \c file_path
+     *
+     * If callback is not set, changes of the file will not be watched.
+     *
+     * @param file_path : path for the file to watch
+     */
+    CPP_UTILS_DllAPI FileContentWatcherHandler(
+            std::string file_path);
+
+    /**
+     * @brief Construct a FileContentWatcherHandler with a specific callback.
+     *
+     * @param file_path : path for the file to watch
+     * @param callback : function that will be called when the event raises.
+     */
+    CPP_UTILS_DllAPI FileContentWatcherHandler(
+            const std::function<void(const FileChange&)>& callback,
+            std::string file_path);
+
+    /**
+     * @brief Destroy the File Content Watcher Handler object
+     *
+     * Calls \c unset_callback
+     */
+    CPP_UTILS_DllAPI ~FileContentWatcherHandler();
+
+protected:
+
+    //! Callback of the \c FileWatcherService : hash the file and raise the event if its content changed.
+    void file_closed_() noexcept;
+
+    /**
+     * @brief Override \c callback_set_ from \c EventHandler .
+     *
+     * It hashes the current content of the file and starts watching it.
+     *
+     * It is already guarded by \c event_mutex_ .
+     */
+    virtual void callback_set_nts_() noexcept override;
+
+    /**
+     * @brief Override \c callback_unset_ from \c EventHandler .
+     *
+     * It stops watching the file.
+     *
+     * It is already guarded by \c event_mutex_ .
+     */
+    virtual void callback_unset_nts_() noexcept override;
+
+    //! Path of file to watch
+    std::string file_path_;
+
+    //! Name of the file inside its directory, as given to the callback
+    std::string file_name_;
+
+    //! Identifier of the file in \c FileWatcherService . 0 if not watching.
+    FileWatchId watch_id_;
+
+    /**
+     * @brief Hash of the last content notified, or of the content found when the watch started.
+     *
+     * Only accessed before watching the file, or from the dispatcher thread of the \c FileWatcherService .
+     */
+    uint64_t last_content_hash_;
+
+    //! Whether \c last_content_hash_ holds a hash, as the file may not exist when the watch starts.
+    bool content_known_;
+};
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+#endif // if defined(__linux__)
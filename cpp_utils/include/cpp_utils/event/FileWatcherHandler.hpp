@@ -22,19 +22,25 @@
 #include <string>
 
 #include <cpp_utils/event/EventHandler.hpp>
+#include <cpp_utils/event/FileWatcherService.hpp>
 #include <cpp_utils/library/library_dll.h>
 
 namespace eprosima {
 namespace utils {
 namespace event {
 
+#if !defined(__linux__)
 class FileWatcher;
+#endif // if !defined(__linux__)
 
 /**
  * It implements the functionality to watch over a specific file and raise a callback
  * every time the file has changed.
  *
- * @warning Because of the FileWatcher implementation, each callback is called twice.
+ * In Linux, every handler shares the \c inotify instance and the thread of the \c FileWatcherService ,
+ * and several changes of the file read at once raise a single callback.
+ *
+ * @warning In other platforms, because of the FileWatcher implementation, each callback is called twice.
  */
 class FileWatcherHandler : public EventHandler<std::string>
 {
@@ -58,7 +64,7 @@ public:
      * @param callback : function that will be called when the event raises.
      */
     CPP_UTILS_DllAPI FileWatcherHandler(
-            std::function<void(std::string)> callback,
+            std::function<void(const std::string&)> callback,
             std::string file_path);
 
     /**
@@ -73,7 +79,8 @@ protected:
     /**
      * @brief Start watching file
      *
-     * It uses external library \c filewatch to create a File Watcher
+     * It registers the file in \c FileWatcherService in Linux, and it uses external library \c filewatch
+     * to create a File Watcher in other platforms.
      *
      * @note Method called only from constructor
      */
@@ -107,8 +114,13 @@ protected:
     //! Path of file to watch
     std::string file_path_;
 
+#if defined(__linux__)
+    //! Identifier of the file in \c FileWatcherService
+    FileWatchId watch_id_;
+#else
     //! File Watcher object
     std::unique_ptr<FileWatcher> file_watch_handler_;
+#endif // if defined(__linux__)
 
     //! Whether the file_watcher has already been started
     std::atomic<bool> filewatcher_started_;
@@ -0,0 +1,193 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FileWatcherService.hpp
+ */
+
+#pragma once
+
+#if defined(__linux__)
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <cpp_utils/library/library_dll.h>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+//! Identifier of a file watched in a \c FileWatcherService . 0 is never a valid identifier.
+using FileWatchId = uint64_t;
+
+//! Changes of a file that call the callback of its watch.
+enum class FileWatchTrigger
+{
+    //! Every write of the file, as notified by the file watcher of \c FileWatcherHandler before this service.
+    any_write,
+
+    //! Only completed writes: the file is closed after being written, or it is replaced by a file moved in.
+    complete_write,
+};
+
+/**
+ * This class creates a Singleton object that watches every file of the process with a single \c inotify instance
+ * and calls their callbacks from a single dispatcher thread.
+ *
+ * The directory of each file is watched (so the file can be replaced, as many editors do), and a directory is
+ * watched only once however many files inside it are watched.
+ * The number of threads and descriptors does not grow with the number of files watched.
+ *
+ * Several changes of a file read at once (e.g. a file written in chunks) are notified as a single change.
+ *
+ * @note Only available in Linux.
+ */
+class FileWatcherService
+{
+public:
+
+    //! Function called from the dispatcher thread with the name of the file changed.
+    using FileChangeCallback = std::function<void(const std::string&)>;
+
+    //! Get Singleton object
+    CPP_UTILS_DllAPI static FileWatcherService& get_instance() noexcept;
+
+    /**
+     * @brief Call \c callback every time the file in \c file_path changes.
+     *
+     * The file does not need to exist, but its directory does.
+     *
+     * @param trigger changes that call \c callback .
+     * By default, every time the file is written.
+     *
+     * @return identifier of the watch, to remove it with \c remove_watch .
+     *
+     * @throw \c InitializationException if the directory of \c file_path could not be watched.
+     */
+    CPP_UTILS_DllAPI FileWatchId add_watch(
+            const std::string& file_path,
+            FileChangeCallback callback,
+            FileWatchTrigger trigger = FileWatchTrigger::any_write);
+
+    /**
+     * @brief Stop watching the file of \c id . The directory stops being watched when it has no files left.
+     *
+     * Once this method returns, the callback of \c id is not running and it will not be called again,
+     * unless this is called from the callback itself.
+     * Does nothing if \c id is not registered.
+     */
+    CPP_UTILS_DllAPI void remove_watch(
+            FileWatchId id) noexcept;
+
+    //! Number of files watched.
+    CPP_UTILS_DllAPI std::size_t size() const noexcept;
+
+    //! Number of directories watched, each one with its own watch descriptor.
+    CPP_UTILS_DllAPI std::size_t directories() const noexcept;
+
+    //! Deleted copy method
+    FileWatcherService(
+            FileWatcherService const&) = delete;
+    //! Deleted copy method
+    void operator =(
+            FileWatcherService const&) = delete;
+
+protected:
+
+    //! File watched.
+    struct Watch
+    {
+        //! Watch descriptor of the directory of the file.
+        int watch_descriptor;
+
+        //! Name of the file inside the directory.
+        std::string file_name;
+
+        //! Mask of the \c inotify events that call the callback.
+        uint32_t changes;
+
+        //! Function to call when the file changes.
+        FileChangeCallback callback;
+    };
+
+    /**
+     * @brief Private constructor
+     *
+     * Create the descriptors and the dispatcher thread.
+     */
+    FileWatcherService() noexcept;
+
+    /**
+     * @brief Destroy singleton
+     *
+     * This method would only be called at the end of the process.
+     *
+     * Stop the dispatcher thread and close the \c inotify instance.
+     */
+    ~FileWatcherService() noexcept;
+
+    //! Routine of the dispatcher thread: wait for changes and dispatch them until stopped.
+    void thread_routine_() noexcept;
+
+    //! Read every change available and call the callbacks of the files changed.
+    void dispatch_() noexcept;
+
+    /**
+     * @brief Files watched by identifier.
+     *
+     * Guarded by \c watches_mutex_
+     */
+    std::map<FileWatchId, Watch> watches_;
+
+    /**
+     * @brief Number of files watched in each watch descriptor.
+     *
+     * Guarded by \c watches_mutex_
+     */
+    std::map<int, uint32_t> directories_;
+
+    /**
+     * @brief Protects the files watched, and it is held while calling their callbacks.
+     *
+     * It is recursive so a callback can add or remove watches.
+     */
+    mutable std::recursive_mutex watches_mutex_;
+
+    //! Last identifier given. Guarded by \c watches_mutex_
+    FileWatchId last_id_;
+
+    //! Descriptor of the \c inotify instance.
+    int inotify_fd_;
+
+    //! Descriptor of the \c eventfd written in destruction.
+    int wake_up_fd_;
+
+    //! Whether the dispatcher thread must stop. Only set to true in destruction.
+    std::atomic<bool> stop_;
+
+    //! Dispatcher thread.
+    std::thread thread_;
+};
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+#endif // if defined(__linux__)
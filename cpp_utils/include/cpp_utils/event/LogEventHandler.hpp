@@ -19,10 +19,13 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <mutex>
+#include <vector>
 
 #include <cpp_utils/Log.hpp>
-#include <cpp_utils/types/Atomicable.hpp>
 #include <cpp_utils/event/EventHandler.hpp>
 #include <cpp_utils/memory/owner_ptr.hpp>
 #include <cpp_utils/library/library_dll.h>
@@ -34,6 +37,19 @@ namespace event {
 //! Data Type to be shared between a LogEventHandler and a LogConsumerConnection.
 using LogConsumerConnectionCallbackType = std::function<void (const utils::Log::Entry&)>;
 
+//! Entries that a \c LogEventHandler keeps after raising their event.
+enum class LogRetention
+{
+    //! No entry is kept.
+    none,
+
+    //! Only the last entries are kept, in a ring allocated once that overwrites the oldest entry.
+    last_entries,
+
+    //! Every entry is kept. Memory grows for as long as entries are consumed.
+    unbounded,
+};
+
 /**
  * It implements the functionality to raise callback every time a Log msg is consumed.
  *
@@ -43,17 +59,28 @@ using LogConsumerConnectionCallbackType = std::function<void (const utils::Log::
  * As \c LogConsumerConnection variable will survive this object, an owner/lessee object is shared between
  * both objects, so connection keeps calling this callback as long as this object lives, and after this death
  * it will do nothing.
+ *
+ * The entries consumed are kept depending on its \c LogRetention , and \c retained_entries gives a copy of them.
  */
 class LogEventHandler : public EventHandler<utils::Log::Entry>
 {
 public:
 
+    //! Number of entries kept by default.
+    static constexpr std::size_t DEFAULT_MAX_ENTRIES = 100;
+
     /**
      * Construct without callback.
      *
      * It registers in Log the LogConsumer that will call this object.
+     *
+     * @param retention entries kept.
+     * @param max_entries number of entries kept with \c LogRetention::last_entries .
+     * The memory for them is allocated here. With 0, no entry is kept, as with \c LogRetention::none .
      */
-    CPP_UTILS_DllAPI LogEventHandler();
+    CPP_UTILS_DllAPI LogEventHandler(
+            LogRetention retention = LogRetention::last_entries,
+            std::size_t max_entries = DEFAULT_MAX_ENTRIES);
 
     /**
      * Construct a Log Event Handler with callback and enable it.
@@ -63,9 +90,14 @@ public:
      * Calls \c set_callback .
      *
      * @param callback callback to call every time a log entry is consumed.
+     * @param retention entries kept.
+     * @param max_entries number of entries kept with \c LogRetention::last_entries .
+     * With 0, no entry is kept, as with \c LogRetention::none .
      */
     CPP_UTILS_DllAPI LogEventHandler(
-            std::function<void(utils::Log::Entry)> callback);
+            std::function<void(const utils::Log::Entry&)> callback,
+            LogRetention retention = LogRetention::last_entries,
+            std::size_t max_entries = DEFAULT_MAX_ENTRIES);
 
     /**
      * @brief Destroy the LogEventHandler object
@@ -74,6 +106,16 @@ public:
      */
     CPP_UTILS_DllAPI ~LogEventHandler();
 
+    /**
+     * @brief Copy of the entries kept, from the oldest to the newest.
+     *
+     * The entries are copied while guarded, so the copy can be iterated while new entries are consumed.
+     */
+    CPP_UTILS_DllAPI std::vector<utils::Log::Entry> retained_entries() const;
+
+    //! Number of entries consumed so far, kept or not.
+    CPP_UTILS_DllAPI uint64_t consumed_entries() const noexcept;
+
 protected:
 
     /**
@@ -92,12 +134,24 @@ protected:
      */
     OwnerPtr<LogConsumerConnectionCallbackType> connection_callback_;
 
+    //! Entries kept.
+    const LogRetention retention_;
+
     /**
-     * @brief Vector of Log entries consumed so far.
+     * @brief Log entries kept.
+     *
+     * With \c LogRetention::last_entries it is a ring of fixed size: entries are assigned over the oldest ones,
+     * so the memory of their strings is reused.
      *
-     * Guarded by itself.
+     * Guarded by \c entries_mutex_
      */
-    SharedAtomicable<std::vector<utils::Log::Entry>> entries_consumed_;
+    std::vector<utils::Log::Entry> entries_consumed_;
+
+    //! Number of entries consumed so far. Guarded by \c entries_mutex_
+    uint64_t n_entries_consumed_;
+
+    //! Protects the entries kept.
+    mutable std::mutex entries_mutex_;
 };
 
 } /* namespace event */
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
 
 #include <cpp_utils/event/LogEventHandler.hpp>
@@ -43,10 +44,14 @@ public:
      *
      * @param callback callback to call every time a log entry is consumed.
      * @param threshold minimum log kind that will be consumed.
+     * @param retention entries kept.
+     * @param max_entries number of entries kept with \c LogRetention::last_entries .
      */
     CPP_UTILS_DllAPI LogSevereEventHandler(
-            std::function<void(utils::Log::Entry)> callback,
-            const utils::Log::Kind threshold = utils::Log::Kind::Warning);
+            std::function<void(const utils::Log::Entry&)> callback,
+            const utils::Log::Kind threshold = utils::Log::Kind::Warning,
+            LogRetention retention = LogRetention::last_entries,
+            std::size_t max_entries = DEFAULT_MAX_ENTRIES);
 
 protected:
 
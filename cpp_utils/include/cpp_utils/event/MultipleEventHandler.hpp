@@ -22,6 +22,8 @@
 #include <memory>
 
 #include <cpp_utils/event/EventHandler.hpp>
+#include <cpp_utils/event/reactor/EventReactor.hpp>
+#include <cpp_utils/event/reactor/FdEventSource.hpp>
 #include <cpp_utils/library/library_dll.h>
 
 namespace eprosima {
@@ -42,6 +44,10 @@ namespace event {
  * Recommendation of use:
  * Create every EventHandler using make_unique in the same call of \c register_event_handler . e.g.:
  *  signal_handlers.register_event_handler<EventHandler<int>, int>(make_unique<SignalEventHandler<SIGNAL_SIGINT>>());
+ *
+ * In Linux, sources based on file descriptors (\c IFdEventSource ) can be registered instead with
+ * \c register_fd_event_source . All of them are driven by a single \c EventReactor thread owned by this object,
+ * instead of the one or more threads that each EventHandler runs.
  */
 class MultipleEventHandler : public EventHandler<>
 {
@@ -89,6 +95,22 @@ public:
     void register_event_handler(
             std::unique_ptr<T> handler) noexcept;
 
+#if defined(__linux__)
+    /**
+     * @brief Register a new \c IFdEventSource
+     *
+     * Every event read from the source triggers this object callback, from the reactor thread.
+     * The reactor thread is created with the first source registered.
+     * Sources that finish (e.g. end of stdin) are no longer watched.
+     *
+     * @param source pointer and ownership for the source
+     *
+     * @throw \c InitializationException if the reactor could not be created or could not watch the source.
+     */
+    CPP_UTILS_DllAPI void register_fd_event_source(
+            std::unique_ptr<IFdEventSource> source);
+#endif // if defined(__linux__)
+
 protected:
 
     /**
@@ -101,6 +123,14 @@ protected:
      * and thus there is no common interface to collect them.
      */
     std::list<std::unique_ptr<IBaseEventHandler>> handlers_registered_;
+
+#if defined(__linux__)
+    //! Sources registered inside this, driven by \c reactor_ .
+    std::list<std::unique_ptr<IFdEventSource>> fd_sources_registered_;
+
+    //! Reactor that drives every source in \c fd_sources_registered_ . Created with the first source.
+    std::unique_ptr<EventReactor> reactor_;
+#endif // if defined(__linux__)
 };
 
 } /* namespace event */
@@ -0,0 +1,221 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SignalDispatcher.hpp
+ */
+
+#pragma once
+
+#if defined(__linux__)
+
+#include <signal.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <cpp_utils/event/reactor/IFdEventSource.hpp>
+#include <cpp_utils/library/library_dll.h>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+class EventReactor;
+class SignalFdEventSource;
+
+/**
+ * This class creates a Singleton object that receives every signal managed in the process and calls their handlers
+ * from a single dispatcher thread.
+ *
+ * Signals reach the dispatcher in one of two ways, and neither of them takes a lock in signal context:
+ * - Signals blocked in every thread of the process are queued in a \c SignalFdEventSource , and read from it.
+ *   Call \c block_signals in the main thread before creating any other thread so they inherit the mask.
+ * - Signals delivered to a thread that does not block them (e.g. sent with \c raise ) are caught by a handler
+ *   that only increments a lock-free counter and writes in an \c eventfd , both async-signal-safe operations.
+ *
+ * The dispatcher thread is an \c EventReactor that watches both descriptors.
+ * The dispatcher is itself an \c IFdEventSource over the signal descriptor, so another reactor can also watch it:
+ * \c consume dispatches the signals pending from the thread of that reactor.
+ *
+ * @note Only available in Linux.
+ */
+class SignalDispatcher : public IFdEventSource
+{
+public:
+
+    //! Function called from the dispatcher thread with each signal received.
+    using SignalHandler = std::function<void()>;
+
+    //! Get Singleton object
+    CPP_UTILS_DllAPI static SignalDispatcher& get_instance() noexcept;
+
+    /**
+     * @brief Call \c handler every time \c signal is received.
+     *
+     * If \c signal already had a handler, it is replaced.
+     *
+     * @throw \c InitializationException if the signal could not be handled,
+     * or if the descriptors of the dispatcher could not be created.
+     */
+    CPP_UTILS_DllAPI void add_signal(
+            int signal,
+            SignalHandler handler);
+
+    /**
+     * @brief Stop handling \c signal and restore its default action.
+     *
+     * Once this method returns, the handler of \c signal is not running and it will not be called again,
+     * unless this is called from the handler itself.
+     */
+    CPP_UTILS_DllAPI void remove_signal(
+            int signal) noexcept;
+
+    /**
+     * @brief Block every signal handled in the calling thread.
+     *
+     * Threads created afterwards by the calling thread inherit the mask.
+     * Signals blocked in every thread of the process are read from \c fd .
+     */
+    CPP_UTILS_DllAPI void block_signals() noexcept;
+
+    //! Descriptor of the \c signalfd , readable when a signal blocked in every thread is pending. -1 if not created.
+    CPP_UTILS_DllAPI int fd() const noexcept override;
+
+    /**
+     * @brief Call the handler of every signal received and not dispatched yet.
+     *
+     * It does not block waiting for signals.
+     *
+     * @return number of signals dispatched.
+     */
+    CPP_UTILS_DllAPI uint32_t consume() noexcept override;
+
+    /**
+     * @brief Wait until the dispatcher thread has dispatched every signal received before this call.
+     *
+     * Signals are never dispatched from the calling thread.
+     * It does not wait if called from a signal handler being dispatched, or if the dispatcher thread is not running.
+     */
+    CPP_UTILS_DllAPI void wait_dispatched() noexcept;
+
+    //! Deleted copy method
+    SignalDispatcher(
+            SignalDispatcher const&) = delete;
+    //! Deleted copy method
+    void operator =(
+            SignalDispatcher const&) = delete;
+
+protected:
+
+    /**
+     * @brief Private constructor
+     *
+     * Create the descriptors and start the dispatcher thread.
+     * If they could not be created, the error is logged and \c add_signal fails.
+     */
+    SignalDispatcher() noexcept;
+
+    /**
+     * @brief Destroy singleton
+     *
+     * This method would only be called at the end of the process.
+     *
+     * Stop the dispatcher thread and restore the default action of every signal handled.
+     */
+    ~SignalDispatcher() noexcept;
+
+    //! Routine of the wake up descriptor in the dispatcher thread: dispatch and answer \c wait_dispatched .
+    void wake_up_routine_() noexcept;
+
+    //! Call \c times the handler of \c signal . Must be called with \c handlers_mutex_ locked.
+    uint32_t call_handler_nts_(
+            int signal,
+            uint32_t times) noexcept;
+
+    //! Function set with \c sigaction . It only uses async-signal-safe operations.
+    static void signal_handler_function_(
+            int signal) noexcept;
+
+    /**
+     * @brief Handler of each signal handled.
+     *
+     * Guarded by \c handlers_mutex_
+     */
+    std::map<int, SignalHandler> handlers_;
+
+    /**
+     * @brief Set of signals handled.
+     *
+     * Guarded by \c handlers_mutex_
+     */
+    sigset_t signals_;
+
+    /**
+     * @brief Guards the handlers, and it is held while calling them.
+     *
+     * It is recursive so a handler can remove signals.
+     */
+    std::recursive_mutex handlers_mutex_;
+
+    //! Source of the signals blocked in every thread. \c nullptr if it could not be created.
+    std::unique_ptr<SignalFdEventSource> signal_source_;
+
+    //! Descriptor of the \c eventfd written by the signal handler and by \c wait_dispatched . -1 if not created.
+    int wake_up_fd_;
+
+    //! Reactor whose thread is the dispatcher thread. \c nullptr if it could not be created.
+    std::unique_ptr<EventReactor> reactor_;
+
+    /**
+     * @brief Number of calls to \c wait_dispatched so far.
+     *
+     * Guarded by \c dispatch_mutex_
+     */
+    uint64_t dispatch_requests_;
+
+    /**
+     * @brief Number of calls to \c wait_dispatched answered by the dispatcher thread.
+     *
+     * Guarded by \c dispatch_mutex_
+     */
+    uint64_t dispatched_requests_;
+
+    //! Guards the requests of \c wait_dispatched .
+    std::mutex dispatch_mutex_;
+
+    //! Notifies the requests answered to \c wait_dispatched .
+    std::condition_variable dispatch_cv_;
+
+    /**
+     * @brief Number of times each signal has been caught by \c signal_handler_function_ and not dispatched yet.
+     *
+     * It is static (as \c wake_up_fd_for_handler_ ) so the signal handler does not access the singleton.
+     */
+    static std::atomic<uint32_t> signals_caught_[NSIG];
+
+    //! Copy of \c wake_up_fd_ for \c signal_handler_function_ . -1 if there is no dispatcher.
+    static std::atomic<int> wake_up_fd_for_handler_;
+};
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+#endif // if defined(__linux__)
@@ -27,6 +27,8 @@
 #include <string>
 #include <thread>
 
+#include <cpp_utils/event/SignalDispatcher.hpp>
+
 namespace eprosima {
 namespace utils {
 namespace event {
@@ -51,13 +53,16 @@ using UniqueCallbackId = uint32_t;
 /**
  * This class creates a Singleton object that manages a specific signal given by template specialization \c SigVal .
  *
- * Signals may be captured from any running thread, but handling is performed here in a dedicated thread
- * \c signal_handler_thread_ in order to avoid unexpected behaviors.
+ * Signals may be captured from any running thread, but handling is performed in a dedicated thread
+ * in order to avoid unexpected behaviors.
  *
  * Callbacks could be registered in this object. Which each signal received every callback registered is called.
  *
- * In creation, this object set the \c signal method to handle signal to call an internal method that augments
- * signals arrived and awake the signal thread.
+ * In Linux, the signal is handled by the \c SignalDispatcher , whose single thread receives every signal managed
+ * (from a \c signalfd or from an async-signal-safe handler) and calls \c signal_handler_routine_ .
+ *
+ * In other platforms, this object set the \c signal method to handle signal to call an internal method that
+ * augments signals arrived and awake the signal thread.
  * Signal thread is an internal thread (created in constructor) that is awake every time a signal arrives or in
  * destruction.
  * This thread calls every callback registered in this singleton.
@@ -114,8 +119,9 @@ protected:
     /**
      * @brief Private constructor
      *
-     * Set the \c signal function to awake \c signal_handler_thread_ .
-     * Create the \c signal_handler_thread_  to call callbacks in signal receive.
+     * In Linux, add the signal to the \c SignalDispatcher .
+     * Otherwise, set the \c signal function to awake \c signal_handler_thread_ and
+     * create the \c signal_handler_thread_  to call callbacks in signal receive.
      */
     SignalManager() noexcept;
 
@@ -124,7 +130,8 @@ protected:
      *
      * This method would only be called at the end of the process.
      *
-     * It will awake \c signal_handler_thread_  and wait for it to be joined
+     * In Linux, remove the signal from the \c SignalDispatcher .
+     * Otherwise, it will awake \c signal_handler_thread_  and wait for it to be joined
      */
     ~SignalManager() noexcept;
 
@@ -134,6 +141,7 @@ protected:
     //! function called from \c signal when a signal is handled.
     void signal_handler_routine_() noexcept;
 
+#if !defined(__linux__)
     /**
      * @brief Routine for \c signal_handler_thread_
      *
@@ -153,6 +161,7 @@ protected:
     //! Static function to call from \c signal . It only calls singleton \c signal_received_ .
     static void signal_handler_function_(
             int sigval) noexcept;
+#endif // if !defined(__linux__)
 
     //////
     // Callbacks registered
@@ -166,6 +175,7 @@ protected:
     //! Guards access to read and writer \c active_callbacks_
     std::mutex active_callbacks_mutex_;
 
+#if !defined(__linux__)
     //////
     // Internal signal thread
     /**
@@ -191,6 +201,7 @@ protected:
 
     //! Condition variable to wait in \c signal_handler_thread_ until a signal arrives or signal handler is unset.
     static std::condition_variable signal_received_cv_;
+#endif // if !defined(__linux__)
 
     //////
     // Unique id
@@ -204,7 +215,7 @@ protected:
     static std::recursive_mutex instance_mutex_;
 };
 
-std::ostream& operator <<(
+inline std::ostream& operator <<(
         std::ostream& os,
         const Signal& sigval);
 
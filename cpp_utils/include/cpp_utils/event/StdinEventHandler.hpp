@@ -16,9 +16,11 @@
 
 #include <atomic>
 #include <functional>
+#include <memory>
 #include <thread>
 
 #include <cpp_utils/event/EventHandler.hpp>
+#include <cpp_utils/file/FdLineReader.hpp>
 #include <cpp_utils/library/library_dll.h>
 #include <cpp_utils/time/time_utils.hpp>
 #include <cpp_utils/wait/CounterWaitHandler.hpp>
@@ -56,11 +58,32 @@ public:
      */
     CPP_UTILS_DllAPI
     StdinEventHandler(
-            std::function<void(std::string)> callback,
+            std::function<void(const std::string&)> callback,
             const bool read_lines = true,
             const int lines_to_read = 0,
             std::istream& source = std::cin);
 
+    /**
+     * @brief Construct a new Stdin Event Handler that reads whole lines from a file descriptor.
+     *
+     * Lines are read in big chunks by \c reader instead of one by one from a \c istream ,
+     * so it is much faster with piped input (e.g. a script of commands).
+     * Once the end of the stream is reached, each line allowed to read gives an empty string.
+     *
+     * @param callback : callback to call when there is new data in the descriptor
+     * @param reader : reader of the descriptor (stdin by default in \c FdLineReader ).
+     * @param lines_to_read : number of lines that this EventHandler must expect. Could be incremented by
+     *  \c read_one_more_line .
+     *
+     * @warning Do not mix it with a \c StdinEventHandler that reads from \c std::cin , as data buffered by one
+     * of them is not available for the other.
+     */
+    CPP_UTILS_DllAPI
+    StdinEventHandler(
+            std::function<void(const std::string&)> callback,
+            std::unique_ptr<FdLineReader> reader,
+            const int lines_to_read = 0);
+
     /**
      * @brief Destroy the StdinEventHandler object
      *
@@ -121,13 +144,16 @@ protected:
     CounterWaitHandler activation_times_;
 
     /**
-     * @brief istream source from where to read.
+     * @brief istream source from where to read. \c nullptr if reading from \c reader_ .
      *
      * This is very useful for testing.
      * However it is dangerous to have a reference here to an external object.
      * Commonly this will be std::cin that does not die till the end of process.
      */
-    std::istream& source_;
+    std::istream* source_;
+
+    //! Reader of a file descriptor. \c nullptr if reading from \c source_ .
+    std::unique_ptr<FdLineReader> reader_;
 
     //! Whether to read whole lines or stop reading in a space.
     const bool read_lines_;
@@ -0,0 +1,271 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DebouncedEventHandler.ipp
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <thread>
+#include <utility>
+
+#include <cpp_utils/Log.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+template <typename ... Args>
+DebouncedEventHandler<Args...>::DebouncedEventHandler(
+        std::unique_ptr<EventHandler<Args...>> source,
+        const DebounceConfiguration& configuration,
+        Aggregator aggregator /* = nullptr */,
+        TimerService& timer_service /* = TimerService::shared() */)
+    : configuration_(configuration)
+    , aggregator_(std::move(aggregator))
+    , timer_service_(timer_service)
+    , source_(std::move(source))
+{
+    if (configuration_.debounce_window > 0 || configuration_.throttle_window > 0)
+    {
+        emission_thread_ = std::thread(&DebouncedEventHandler<Args...>::emission_routine_, this);
+    }
+
+    source_->set_callback(
+        [this](EventArgument<Args>... args)
+        {
+            source_event_(args ...);
+        });
+}
+
+template <typename ... Args>
+DebouncedEventHandler<Args...>::DebouncedEventHandler(
+        typename EventHandler<Args...>::Callback callback,
+        std::unique_ptr<EventHandler<Args...>> source,
+        const DebounceConfiguration& configuration,
+        Aggregator aggregator /* = nullptr */,
+        TimerService& timer_service /* = TimerService::shared() */)
+    : DebouncedEventHandler(std::move(source), configuration, std::move(aggregator), timer_service)
+{
+    this->set_callback(callback);
+}
+
+template <typename ... Args>
+DebouncedEventHandler<Args...>::~DebouncedEventHandler()
+{
+    this->unset_callback();
+
+    // Destroying the source waits for its callbacks, so no new event arrives from now on
+    source_.reset();
+
+    TimerTaskId timer_id;
+    TimerTaskId running_timer_id;
+    {
+        std::lock_guard<std::mutex> lock(debounce_mutex_);
+        stopped_ = true;
+        timer_id = timer_id_;
+        running_timer_id = running_timer_id_;
+    }
+
+    // Cancel without the mutex, as a task running needs it to finish
+    timer_service_.cancel(timer_id);
+    timer_service_.cancel(running_timer_id);
+
+    released_cv_.notify_all();
+    if (emission_thread_.joinable())
+    {
+        emission_thread_.join();
+    }
+}
+
+template <typename ... Args>
+void DebouncedEventHandler<Args...>::source_event_(
+        EventArgument<Args>... args) noexcept
+{
+    // Nothing to debounce: forward the event as it is
+    if (configuration_.debounce_window == 0 && configuration_.throttle_window == 0)
+    {
+        this->event_occurred_(args ...);
+        return;
+    }
+
+    const TimerService::Clock::time_point now = TimerService::Clock::now();
+
+    try
+    {
+        std::lock_guard<std::mutex> lock(debounce_mutex_);
+
+        // Leading edge: outside the throttle window the event is not held
+        if (!held_arguments_ && configuration_.throttle_window > 0 && now >= throttle_until_)
+        {
+            throttle_until_ = now + std::chrono::milliseconds(configuration_.throttle_window);
+        }
+        else
+        {
+            if (!held_arguments_)
+            {
+                held_arguments_.reset(new Arguments(args ...));
+                burst_start_ = now;
+            }
+            else if (aggregator_)
+            {
+                aggregator_(*held_arguments_, Arguments(args ...));
+            }
+            else
+            {
+                *held_arguments_ = Arguments(args ...);
+            }
+
+            deadline_ = std::max(now + std::chrono::milliseconds(configuration_.debounce_window), throttle_until_);
+            if (configuration_.max_wait > 0)
+            {
+                deadline_ = std::min(deadline_, burst_start_ + std::chrono::milliseconds(configuration_.max_wait));
+            }
+
+            // Deadline never moves earlier within a burst, so a task already scheduled only needs to be delayed
+            if (timer_id_ == 0)
+            {
+                schedule_timer_nts_();
+            }
+
+            return;
+        }
+    }
+    // Whatever was already held stays, and the next event schedules its release again
+    catch (const std::exception& e)
+    {
+        logWarning(UTILS_DEBOUNCE, "Event could not be debounced: " << e.what() << ".");
+        return;
+    }
+    catch (...)
+    {
+        logWarning(UTILS_DEBOUNCE, "Event could not be debounced.");
+        return;
+    }
+
+    this->event_occurred_(args ...);
+}
+
+template <typename ... Args>
+void DebouncedEventHandler<Args...>::timer_expired_() noexcept
+{
+    try
+    {
+        std::lock_guard<std::mutex> lock(debounce_mutex_);
+
+        running_timer_id_ = timer_id_;
+        timer_id_ = 0;
+
+        if (stopped_ || !held_arguments_)
+        {
+            return;
+        }
+
+        const TimerService::Clock::time_point now = TimerService::Clock::now();
+
+        // More events arrived since the task was scheduled: wait until the new deadline
+        if (now < deadline_)
+        {
+            schedule_timer_nts_();
+            return;
+        }
+
+        if (configuration_.throttle_window > 0)
+        {
+            throttle_until_ = now + std::chrono::milliseconds(configuration_.throttle_window);
+        }
+
+        // The emission thread is still calling the callback with a previous release: merge both
+        if (released_arguments_ && aggregator_)
+        {
+            aggregator_(*released_arguments_, *held_arguments_);
+            held_arguments_.reset();
+        }
+        else
+        {
+            released_arguments_ = std::move(held_arguments_);
+        }
+    }
+    // The event stays held, and the next event schedules its release again
+    catch (const std::exception& e)
+    {
+        logWarning(UTILS_DEBOUNCE, "Held event could not be released: " << e.what() << ".");
+    }
+    catch (...)
+    {
+        logWarning(UTILS_DEBOUNCE, "Held event could not be released.");
+    }
+
+    released_cv_.notify_one();
+}
+
+template <typename ... Args>
+void DebouncedEventHandler<Args...>::emission_routine_() noexcept
+{
+    std::unique_lock<std::mutex> lock(debounce_mutex_);
+
+    while (true)
+    {
+        released_cv_.wait(
+            lock,
+            [this]()
+            {
+                return stopped_ || released_arguments_ != nullptr;
+            });
+
+        if (stopped_)
+        {
+            return;
+        }
+
+        std::unique_ptr<Arguments> arguments = std::move(released_arguments_);
+
+        // Call the callback without the mutex, so the source and the timer keep going meanwhile
+        lock.unlock();
+        emit_(*arguments);
+        lock.lock();
+    }
+}
+
+template <typename ... Args>
+void DebouncedEventHandler<Args...>::schedule_timer_nts_()
+{
+    timer_id_ = timer_service_.schedule(
+        deadline_,
+        [this]()
+        {
+            timer_expired_();
+        });
+}
+
+template <typename ... Args>
+void DebouncedEventHandler<Args...>::emit_(
+        const Arguments& arguments) noexcept
+{
+    detail::apply_event_arguments(
+        [this](const typename std::decay<Args>::type&... args)
+        {
+            this->event_occurred_(args ...);
+        },
+        arguments,
+        std::index_sequence_for<Args...>());
+}
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,239 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file EventBus.ipp
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <cpp_utils/Log.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+template <typename ... Args>
+EventBus<Args...>::Subscriber::Subscriber(
+        SubscriptionId id,
+        Callback&& callback)
+    : EventHandler<Args...>::CallbackSnapshot(std::move(callback))
+    , id(id)
+{
+}
+
+template <typename ... Args>
+EventBus<Args...>::EventBus()
+    : EventHandler<Args...>()
+    , subscribers_(std::make_shared<const SubscriberList>())
+    , next_id_(0)
+{
+    this->set_callback(
+        [this](EventArgument<Args>... args)
+        {
+            this->dispatch_(args ...);
+        });
+}
+
+template <typename ... Args>
+EventBus<Args...>::EventBus(
+        SlotThreadPool& thread_pool)
+    : EventBus()
+{
+    const unsigned int n_strands = std::max(1u, thread_pool.number_of_threads());
+    for (unsigned int i = 0; i < n_strands; ++i)
+    {
+        strands_.push_back(std::unique_ptr<Strand>(new Strand(thread_pool)));
+    }
+}
+
+template <typename ... Args>
+EventBus<Args...>::~EventBus()
+{
+    this->unset_callback();
+
+    // Events already posted to strands find their subscribers inactive and are skipped
+    std::shared_ptr<const SubscriberList> subscribers = std::atomic_load(&subscribers_);
+    for (const std::shared_ptr<Subscriber>& subscriber : *subscribers)
+    {
+        deactivate_(*subscriber);
+    }
+}
+
+template <typename ... Args>
+SubscriptionId EventBus<Args...>::subscribe(
+        Callback callback)
+{
+    std::lock_guard<std::mutex> lock(subscribers_mutex_);
+
+    const SubscriptionId id = next_id_++;
+
+    std::shared_ptr<SubscriberList> new_subscribers =
+            std::make_shared<SubscriberList>(*std::atomic_load(&subscribers_));
+    new_subscribers->push_back(std::make_shared<Subscriber>(id, std::move(callback)));
+    std::atomic_store(&subscribers_, std::shared_ptr<const SubscriberList>(std::move(new_subscribers)));
+
+    logDebug(UTILS_EVENTBUS, "Subscriber " << id << " added to EventBus.");
+
+    return id;
+}
+
+template <typename ... Args>
+bool EventBus<Args...>::unsubscribe(
+        SubscriptionId id)
+{
+    std::shared_ptr<Subscriber> removed;
+
+    {
+        std::lock_guard<std::mutex> lock(subscribers_mutex_);
+
+        std::shared_ptr<const SubscriberList> subscribers = std::atomic_load(&subscribers_);
+        std::shared_ptr<SubscriberList> new_subscribers = std::make_shared<SubscriberList>();
+        new_subscribers->reserve(subscribers->size());
+
+        for (const std::shared_ptr<Subscriber>& subscriber : *subscribers)
+        {
+            if (subscriber->id == id)
+            {
+                removed = subscriber;
+            }
+            else
+            {
+                new_subscribers->push_back(subscriber);
+            }
+        }
+
+        if (!removed)
+        {
+            return false;
+        }
+
+        std::atomic_store(&subscribers_, std::shared_ptr<const SubscriberList>(std::move(new_subscribers)));
+    }
+
+    // Publishers could have taken the previous list, so wait for them outside the lock
+    deactivate_(*removed);
+
+    logDebug(UTILS_EVENTBUS, "Subscriber " << id << " removed from EventBus.");
+
+    return true;
+}
+
+template <typename ... Args>
+void EventBus<Args...>::publish(
+        EventArgument<Args>... args) noexcept
+{
+    this->event_occurred_(args ...);
+}
+
+template <typename ... Args>
+typename EventBus<Args...>::Callback EventBus<Args...>::publisher() noexcept
+{
+    return [this](EventArgument<Args>... args)
+           {
+               this->publish(args ...);
+           };
+}
+
+template <typename ... Args>
+std::size_t EventBus<Args...>::subscribers() const noexcept
+{
+    return std::atomic_load(&subscribers_)->size();
+}
+
+template <typename ... Args>
+void EventBus<Args...>::dispatch_(
+        EventArgument<Args>... args) noexcept
+{
+    std::shared_ptr<const SubscriberList> subscribers = std::atomic_load(&subscribers_);
+
+    if (strands_.empty())
+    {
+        for (const std::shared_ptr<Subscriber>& subscriber : *subscribers)
+        {
+            call_(*subscriber, args ...);
+        }
+        return;
+    }
+
+    if (subscribers->empty())
+    {
+        return;
+    }
+
+    // Arguments are copied once and shared by the tasks of every subscriber
+    using Arguments = std::tuple<typename std::decay<Args>::type...>;
+    std::shared_ptr<const Arguments> arguments = std::make_shared<const Arguments>(args ...);
+
+    for (const std::shared_ptr<Subscriber>& subscriber : *subscribers)
+    {
+        strands_[subscriber->id % strands_.size()]->post(
+            [subscriber, arguments]()
+            {
+                detail::apply_event_arguments(
+                    [&subscriber](const typename std::decay<Args>::type&... event_args)
+                    {
+                        call_(*subscriber, event_args ...);
+                    },
+                    *arguments,
+                    std::index_sequence_for<Args...>());
+            });
+    }
+}
+
+template <typename ... Args>
+void EventBus<Args...>::call_(
+        Subscriber& subscriber,
+        EventArgument<Args>... args) noexcept
+{
+    // Only calls registered before the subscriber is retired go on, so deactivate_ waits just for them
+    if (!subscriber.enter())
+    {
+        return;
+    }
+
+    {
+        detail::CallbackFrame frame(&subscriber);
+        try
+        {
+            subscriber.callback(args ...);
+        }
+        catch (const std::exception& e)
+        {
+            logWarning(UTILS_EVENTBUS, "Subscriber " << subscriber.id << " threw an exception: " << e.what() << ".");
+        }
+    }
+
+    subscriber.exit();
+}
+
+template <typename ... Args>
+void EventBus<Args...>::deactivate_(
+        Subscriber& subscriber) noexcept
+{
+    subscriber.retire();
+
+    // Calls of this subscriber in this same thread (unsubscribing from itself) are not waited
+    subscriber.wait_calls_finished(detail::CallbackFrame::count(&subscriber));
+}
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
@@ -18,7 +18,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <functional>
+#include <tuple>
+#include <utility>
 
 #include <cpp_utils/utils.hpp>
 #include <cpp_utils/Log.hpp>
@@ -27,18 +30,120 @@ namespace eprosima {
 namespace utils {
 namespace event {
 
+namespace detail {
+
+/**
+ * @brief Record of a callback being called in the current thread.
+ *
+ * Records form a stack per thread, so a handler can know how many of its own callbacks the current thread is
+ * running, and not wait for them when unsetting the callback from inside it.
+ * \c handler is any address that identifies the callback (the handler, its callback snapshot, ...).
+ */
+struct CallbackFrame
+{
+    CallbackFrame(
+            const void* handler)
+        : handler(handler)
+        , previous(top())
+    {
+        top() = this;
+    }
+
+    ~CallbackFrame()
+    {
+        top() = previous;
+    }
+
+    //! Last frame of the current thread.
+    static CallbackFrame*& top()
+    {
+        static thread_local CallbackFrame* top_frame = nullptr;
+        return top_frame;
+    }
+
+    //! Number of frames of \c handler in the current thread.
+    static uint32_t count(
+            const void* handler)
+    {
+        uint32_t frames = 0;
+        for (const CallbackFrame* frame = top(); frame != nullptr; frame = frame->previous)
+        {
+            if (frame->handler == handler)
+            {
+                ++frames;
+            }
+        }
+        return frames;
+    }
+
+    const void* handler;
+    CallbackFrame* previous;
+};
+
+//! Call \c function with the elements of \c arguments .
+template <typename Function, typename Tuple, std::size_t ... I>
+void apply_event_arguments(
+        Function&& function,
+        const Tuple& arguments,
+        std::index_sequence<I...>)
+{
+    function(std::get<I>(arguments)...);
+}
+
+} /* namespace detail */
+
+template <typename ... Args>
+EventHandler<Args...>::CallbackSnapshot::CallbackSnapshot(
+        Callback&& callback)
+    : callback(std::move(callback))
+    , calls(0)
+{
+}
+
 template <typename ... Args>
-const std::function<void(Args...)> EventHandler<Args...>::DEFAULT_CALLBACK_ =
-        [](Args...)
+bool EventHandler<Args...>::CallbackSnapshot::enter() noexcept
+{
+    if (calls.fetch_add(1) & RETIRED)
+    {
+        exit();
+        return false;
+    }
+    return true;
+}
+
+template <typename ... Args>
+void EventHandler<Args...>::CallbackSnapshot::exit() noexcept
+{
+    if ((calls.fetch_sub(1) - 1) & RETIRED)
+    {
+        // Notify with the mutex taken, so a thread checking calls in wait_calls_finished does not miss it
+        std::lock_guard<std::mutex> lock(calls_mutex);
+        calls_finished_cv.notify_all();
+    }
+}
+
+template <typename ... Args>
+void EventHandler<Args...>::CallbackSnapshot::retire() noexcept
+{
+    calls.fetch_or(RETIRED);
+}
+
+template <typename ... Args>
+void EventHandler<Args...>::CallbackSnapshot::wait_calls_finished(
+        uint32_t own_calls) noexcept
+{
+    std::unique_lock<std::mutex> lock(calls_mutex);
+    calls_finished_cv.wait(
+        lock,
+        [this, own_calls]
         {
-            // This should never happen
-            utils::tsnh(
-                utils::Formatter() << "This callback must not be called.");
-        };
+            return (calls.load() & ~RETIRED) <= own_calls;
+        });
+}
 
 template <typename ... Args>
 EventHandler<Args...>::EventHandler()
-    : callback_(DEFAULT_CALLBACK_)
+    : callback_(nullptr)
     , is_callback_set_(false)
     , number_of_events_registered_(0)
     , threads_waiting_(0)
@@ -47,23 +152,40 @@ EventHandler<Args...>::EventHandler()
 
 template <typename ... Args>
 void EventHandler<Args...>::set_callback(
-        std::function<void(Args...)> callback) noexcept
+        Callback callback) noexcept
 {
     std::lock_guard<std::recursive_mutex> lock(event_mutex_);
 
     bool was_callback_set_before;
 
-    {
-        std::lock_guard<std::recursive_mutex> lock(internal_callback_mutex_);
+    // Publish new snapshot. Events already running keep their reference to the previous one
+    std::shared_ptr<CallbackSnapshot> previous = std::atomic_exchange(
+        &callback_,
+        std::make_shared<CallbackSnapshot>(std::move(callback)));
 
-        {
-            // Setting callback
-            // Wait mutex must be taken because this variable is used in wait_for_event() wait
-            std::lock_guard<std::mutex> lock(wait_mutex_);
-            was_callback_set_before = is_callback_set_.exchange(true);
-        }
+    if (previous)
+    {
+        // Events that took the previous snapshot but did not start calling it move to the new one
+        previous->retire();
+
+        // Keep it until unset_callback, forgetting the ones that have finished already
+        retired_callbacks_.erase(
+            std::remove_if(
+                retired_callbacks_.begin(),
+                retired_callbacks_.end(),
+                [](const std::shared_ptr<CallbackSnapshot>& snapshot)
+                {
+                    return snapshot->calls.load() == CallbackSnapshot::RETIRED;
+                }),
+            retired_callbacks_.end());
+        retired_callbacks_.push_back(std::move(previous));
+    }
 
-        callback_ = callback;
+    {
+        // Setting callback
+        // Wait mutex must be taken because this variable is used in wait_for_event() wait
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        was_callback_set_before = is_callback_set_.exchange(true);
     }
 
     // Call child methods in case they should do something when handler is enabled or change callback
@@ -89,8 +211,6 @@ void EventHandler<Args...>::unset_callback() noexcept
     {
         was_callback_set_before = true;
 
-        std::lock_guard<std::recursive_mutex> lock(internal_callback_mutex_);
-
         {
             // Unsetting callback
             // Wait mutex must be taken because this variable is used in wait_for_event() wait
@@ -98,8 +218,16 @@ void EventHandler<Args...>::unset_callback() noexcept
             is_callback_set_.store(false);
         }
 
-        // Setting new callback (even when it will not be called)
-        callback_ = DEFAULT_CALLBACK_;
+        // Remove snapshot, so new events do not call it, and wait for the ones that already took it
+        std::shared_ptr<CallbackSnapshot> previous = std::atomic_exchange(
+            &callback_,
+            std::shared_ptr<CallbackSnapshot>());
+        if (previous)
+        {
+            previous->retire();
+            retired_callbacks_.push_back(std::move(previous));
+        }
+        wait_callbacks_finished_nts_();
     }
     else
     {
@@ -169,21 +297,29 @@ void EventHandler<Args...>::decrement_event_count() noexcept
 
 template <typename ... Args>
 void EventHandler<Args...>::simulate_event_occurred(
-        Args... args) noexcept
+        EventArgument<Args>... args) noexcept
 {
     event_occurred_(args ...);
 }
 
 template <typename ... Args>
 void EventHandler<Args...>::event_occurred_(
-        Args... args) noexcept
+        EventArgument<Args>... args) noexcept
 {
-    // While event occurred is being process, avoid setting/unsetting callback or destroying object
-    std::lock_guard<std::recursive_mutex> lock(internal_callback_mutex_);
+    std::shared_ptr<CallbackSnapshot> snapshot = std::atomic_load(&callback_);
 
-    if (is_callback_set_.load())
+    // A retired snapshot has just been replaced or unset, so take the current one instead
+    while (snapshot && !snapshot->enter())
     {
-        callback_(args ...);
+        snapshot = std::atomic_load(&callback_);
+    }
+
+    if (snapshot)
+    {
+        {
+            detail::CallbackFrame frame(snapshot.get());
+            snapshot->callback(args ...);
+        }
 
         // TODO: decide if a disabled event should add number of events registered
         {
@@ -191,14 +327,30 @@ void EventHandler<Args...>::event_occurred_(
             std::lock_guard<std::mutex> lock(wait_mutex_);
             ++number_of_events_registered_;
         }
+
+        // Awake every thread waiting for event to occur
+        wait_condition_variable_.notify_all();
+
+        // This must be the last access to this object, as it could be destroyed right after.
+        // The snapshot itself is kept alive by the reference of this thread
+        snapshot->exit();
     }
     else
     {
+        // Not registered, so this object must not be accessed any more
         logInfo(UTILS_HANDLER, "Skipping callback in a not enabled EventHandler.");
     }
+}
 
-    // Awake every thread waiting for event to occur
-    wait_condition_variable_.notify_all();
+template <typename ... Args>
+void EventHandler<Args...>::wait_callbacks_finished_nts_() noexcept
+{
+    for (const std::shared_ptr<CallbackSnapshot>& snapshot : retired_callbacks_)
+    {
+        // Callbacks being executed by this same thread (this is called from the callback) are not waited
+        snapshot->wait_calls_finished(detail::CallbackFrame::count(snapshot.get()));
+    }
+    retired_callbacks_.clear();
 }
 
 template <typename ... Args>
@@ -30,9 +30,9 @@ void MultipleEventHandler::register_event_handler(
         std::unique_ptr<T> handler) noexcept
 {
     // Set new callback to handler so every time even occurred, it calls to this event
-    std::function<void(Args...)> new_callback =
+    typename EventHandler<Args...>::Callback new_callback =
             [this]
-                (Args... args)
+                (EventArgument<Args>... args)
             {
                 this->event_occurred_();
             };
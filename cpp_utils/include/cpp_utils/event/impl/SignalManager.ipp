@@ -20,6 +20,7 @@
 #pragma once
 
 #include <algorithm>
+#include <exception>
 #include <thread>
 
 #include <cpp_utils/exception/InconsistencyException.hpp>
@@ -32,11 +33,13 @@ namespace event {
 template <Signal SigVal>
 std::recursive_mutex SignalManager<SigVal>::instance_mutex_;
 
+#if !defined(__linux__)
 template <Signal SigVal>
 std::condition_variable SignalManager<SigVal>::signal_received_cv_;
 
 template <Signal SigVal>
 std::atomic<uint32_t> SignalManager<SigVal>::signals_received_(0);
+#endif // if !defined(__linux__)
 
 template <Signal SigVal>
 SignalManager<SigVal>& SignalManager<SigVal>::get_instance() noexcept
@@ -47,6 +50,42 @@ SignalManager<SigVal>& SignalManager<SigVal>::get_instance() noexcept
     return instance_;
 }
 
+#if defined(__linux__)
+
+template <Signal SigVal>
+SignalManager<SigVal>::SignalManager() noexcept
+    : current_last_id_(0)
+{
+    try
+    {
+        SignalDispatcher::get_instance().add_signal(
+            static_cast<int>(SigVal),
+            [this]()
+            {
+                signal_handler_routine_();
+            });
+
+        logDebug(UTILS_SIGNALMANAGER,
+                "Set SignalManager handling signal: " << SigVal << ".");
+    }
+    catch (const std::exception& e)
+    {
+        logError(UTILS_SIGNALMANAGER,
+                "Error handling signal " << SigVal << ": " << e.what());
+    }
+}
+
+template <Signal SigVal>
+SignalManager<SigVal>::~SignalManager() noexcept
+{
+    SignalDispatcher::get_instance().remove_signal(static_cast<int>(SigVal));
+
+    logDebug(UTILS_SIGNALMANAGER,
+            "Destroying SignalManager in signal: " << SigVal << ".");
+}
+
+#else
+
 template <Signal SigVal>
 SignalManager<SigVal>::SignalManager() noexcept
     : signal_handler_thread_stop_(false)
@@ -76,10 +115,18 @@ SignalManager<SigVal>::~SignalManager() noexcept
             "Destroying SignalManager in signal: " << SigVal << ".");
 }
 
+#endif // if defined(__linux__)
+
 template <Signal SigVal>
 UniqueCallbackId SignalManager<SigVal>::register_callback(
         std::function<void()> callback) noexcept
 {
+#if defined(__linux__)
+    // Let the dispatcher thread deliver the signals received before this callback (to the callbacks already
+    // registered), so it only receives signals raised from now on
+    SignalDispatcher::get_instance().wait_dispatched();
+#endif // if defined(__linux__)
+
     std::lock_guard<std::mutex> lock(active_callbacks_mutex_);
 
     UniqueCallbackId new_id = new_unique_id_();
@@ -114,6 +161,7 @@ UniqueCallbackId SignalManager<SigVal>::new_unique_id_() noexcept
     return current_last_id_;
 }
 
+#if !defined(__linux__)
 template <Signal SigVal>
 void SignalManager<SigVal>::signal_handler_function_(
         int sigval) noexcept
@@ -136,20 +184,6 @@ void SignalManager<SigVal>::signal_received_() noexcept
     signal_received_cv_.notify_one();
 }
 
-template <Signal SigVal>
-void SignalManager<SigVal>::signal_handler_routine_() noexcept
-{
-    std::lock_guard<std::mutex> lock(active_callbacks_mutex_);
-
-    logInfo(UTILS_SIGNALHANDLER,
-            "Received signal " << SigVal << ".");
-
-    for (auto it : active_callbacks_)
-    {
-        it.second();
-    }
-}
-
 template <Signal SigVal>
 void SignalManager<SigVal>::signal_handler_thread_routine_() noexcept
 {
@@ -176,7 +210,23 @@ void SignalManager<SigVal>::signal_handler_thread_routine_() noexcept
     }
 }
 
-std::ostream& operator <<(
+#endif // if !defined(__linux__)
+
+template <Signal SigVal>
+void SignalManager<SigVal>::signal_handler_routine_() noexcept
+{
+    std::lock_guard<std::mutex> lock(active_callbacks_mutex_);
+
+    logInfo(UTILS_SIGNALHANDLER,
+            "Received signal " << SigVal << ".");
+
+    for (auto it : active_callbacks_)
+    {
+        it.second();
+    }
+}
+
+inline std::ostream& operator <<(
         std::ostream& os,
         const Signal& sigval)
 {
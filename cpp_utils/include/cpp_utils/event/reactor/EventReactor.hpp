@@ -0,0 +1,161 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file EventReactor.hpp
+ *
+ * This file contains class EventReactor definition.
+ */
+
+#pragma once
+
+#if defined(__linux__)
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <cpp_utils/library/library_dll.h>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+/**
+ * This class waits on several file descriptors with a single \c epoll instance and a single thread,
+ * and calls the routine registered for each descriptor when it is readable.
+ *
+ * It allows to drive many event sources (stdin, timers, signals, file changes, ...) that can be represented
+ * as a file descriptor from one thread, instead of one or more threads per source.
+ *
+ * The reactor thread is woken up only when some descriptor is readable or when the reactor is stopped
+ * (through an internal \c eventfd ).
+ *
+ * @note Only available in Linux.
+ */
+class EventReactor
+{
+public:
+
+    /**
+     * @brief Construct a new Event Reactor with no sources and not running.
+     *
+     * @throw \c InitializationException if the epoll instance could not be created.
+     */
+    CPP_UTILS_DllAPI EventReactor();
+
+    /**
+     * @brief Destroy the Event Reactor
+     *
+     * Calls \c stop . File descriptors of the sources are not closed, as they belong to the sources.
+     */
+    CPP_UTILS_DllAPI ~EventReactor();
+
+    /**
+     * @brief Watch \c fd and call \c on_readable from the reactor thread every time it is readable.
+     *
+     * The descriptor is watched in level-triggered mode, so \c on_readable must consume the data available,
+     * or it will be called again right away.
+     *
+     * @param fd file descriptor to watch. It must be valid while registered.
+     * @param on_readable routine to call when \c fd is readable. Exceptions thrown are logged and ignored.
+     * It runs without any lock of the reactor held, so it can add or remove sources.
+     *
+     * @throw \c ValueNotAllowedException if \c fd is already registered.
+     * @throw \c InitializationException if \c fd could not be added to the epoll instance.
+     */
+    CPP_UTILS_DllAPI void add_source(
+            int fd,
+            std::function<void()> on_readable);
+
+    /**
+     * @brief Stop watching \c fd .
+     *
+     * Once this method returns, the routine of \c fd is not running and it will not be called again,
+     * unless this is called from the routine itself.
+     * Does nothing if \c fd is not registered.
+     */
+    CPP_UTILS_DllAPI void remove_source(
+            int fd) noexcept;
+
+    //! Start the reactor thread. Does nothing if already running.
+    CPP_UTILS_DllAPI void start();
+
+    /**
+     * @brief Stop the reactor thread and wait for it to finish. Does nothing if not running.
+     *
+     * It must not be called from a routine of a source.
+     */
+    CPP_UTILS_DllAPI void stop() noexcept;
+
+    //! Number of sources registered.
+    CPP_UTILS_DllAPI std::size_t size() const noexcept;
+
+protected:
+
+    //! Routine of the reactor thread: wait on the epoll instance and dispatch every descriptor readable.
+    void run_() noexcept;
+
+    //! Epoll instance.
+    int epoll_fd_;
+
+    //! Event descriptor used to wake up the reactor thread when stopping.
+    int wakeup_fd_;
+
+    /**
+     * @brief Routines of each descriptor registered.
+     *
+     * They are shared, so the reactor thread takes a reference to the routine it runs without copying it.
+     *
+     * Guarded by \c sources_mutex_
+     */
+    std::map<int, std::shared_ptr<const std::function<void()>>> sources_;
+
+    /**
+     * @brief Descriptor whose routine the reactor thread is running, or -1 if none.
+     *
+     * Only set while holding \c sources_mutex_ , and cleared without it.
+     */
+    std::atomic<int> running_fd_;
+
+    //! Number of threads in \c remove_source waiting for the routine running. Only changed with \c sources_mutex_
+    std::atomic<uint32_t> removers_waiting_;
+
+    /**
+     * @brief Protects \c sources_ and setting \c running_fd_ .
+     *
+     * It is not held while a routine runs, so routines are free to use the reactor or any lock of their own.
+     */
+    mutable std::mutex sources_mutex_;
+
+    //! Notifies \c remove_source when the reactor thread finishes running a routine, only if it is waiting.
+    std::condition_variable routine_finished_cv_;
+
+    //! Whether the reactor thread must keep running.
+    std::atomic<bool> running_;
+
+    //! Reactor thread.
+    std::thread thread_;
+};
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+#endif // if defined(__linux__)
@@ -0,0 +1,202 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FdEventSource.hpp
+ *
+ * This file contains the event sources based on file descriptors that an \c EventReactor can drive.
+ */
+
+#pragma once
+
+#if defined(__linux__)
+
+#include <signal.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include <cpp_utils/event/reactor/IFdEventSource.hpp>
+#include <cpp_utils/event/SignalManager.hpp>
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/time/time_utils.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+/**
+ * @brief Periodic event source based on a \c timerfd .
+ *
+ * Each expiration of the period is an event. If the reactor is late, every expiration missed is counted.
+ */
+class TimerFdEventSource : public IFdEventSource
+{
+public:
+
+    /**
+     * @brief Construct a timer that expires every \c period_time milliseconds, starting now.
+     *
+     * @throw \c InitializationException if \c period_time is not greater than 0 or the timer could not be created.
+     */
+    CPP_UTILS_DllAPI TimerFdEventSource(
+            utils::Duration_ms period_time);
+
+    //! Close the timer.
+    CPP_UTILS_DllAPI ~TimerFdEventSource();
+
+    CPP_UTILS_DllAPI int fd() const noexcept override;
+
+    CPP_UTILS_DllAPI uint32_t consume() noexcept override;
+
+protected:
+
+    //! Timer descriptor.
+    int fd_;
+};
+
+/**
+ * @brief Signal event source based on a \c signalfd .
+ *
+ * Each signal received is an event.
+ * The set of signals received can be changed while the source exists, reusing the same descriptor.
+ *
+ * @warning The signal is blocked in the thread that creates this object, and it is only delivered to the descriptor
+ * if it is blocked in every thread of the process. Create it before any other thread (so they inherit the mask),
+ * and do not combine it with a \c SignalEventHandler of the same signal.
+ */
+class SignalFdEventSource : public IFdEventSource
+{
+public:
+
+    /**
+     * @brief Construct a source that receives \c signal .
+     *
+     * @throw \c InitializationException if the descriptor could not be created.
+     */
+    CPP_UTILS_DllAPI SignalFdEventSource(
+            Signal signal);
+
+    /**
+     * @brief Construct a source that receives \c signals , without blocking them.
+     *
+     * The signals are only delivered to the descriptor while they are blocked in every thread of the process.
+     *
+     * @throw \c InitializationException if the descriptor could not be created.
+     */
+    CPP_UTILS_DllAPI SignalFdEventSource(
+            const sigset_t& signals);
+
+    //! Close the descriptor. The signal is kept blocked, so a pending signal does not kill the process.
+    CPP_UTILS_DllAPI ~SignalFdEventSource();
+
+    CPP_UTILS_DllAPI int fd() const noexcept override;
+
+    CPP_UTILS_DllAPI uint32_t consume() noexcept override;
+
+    /**
+     * @brief Read the signals available in the descriptor, and call \c on_signal with each of them.
+     *
+     * @return number of signals read.
+     */
+    CPP_UTILS_DllAPI uint32_t consume(
+            const std::function<void(int signal)>& on_signal) noexcept;
+
+    /**
+     * @brief Receive \c signals from now on, instead of the previous ones.
+     *
+     * @throw \c InitializationException if the descriptor could not be updated.
+     */
+    CPP_UTILS_DllAPI void update_signals(
+            const sigset_t& signals);
+
+protected:
+
+    //! Signal descriptor.
+    int fd_;
+};
+
+/**
+ * @brief Source of lines read from a stream descriptor (stdin by default).
+ *
+ * Each line completed is an event. Data is consumed by this object, so it is not available for other readers.
+ */
+class StdinFdEventSource : public IFdEventSource
+{
+public:
+
+    /**
+     * @brief Construct a source that reads lines from \c fd .
+     *
+     * @param fd descriptor to read from. It is not closed by this object.
+     */
+    CPP_UTILS_DllAPI StdinFdEventSource(
+            int fd = 0);
+
+    CPP_UTILS_DllAPI int fd() const noexcept override;
+
+    CPP_UTILS_DllAPI uint32_t consume() noexcept override;
+
+    //! Whether the end of the stream has been reached.
+    CPP_UTILS_DllAPI bool finished() const noexcept override;
+
+protected:
+
+    //! Descriptor to read from.
+    int fd_;
+
+    //! Whether the end of the stream has been reached.
+    bool finished_;
+};
+
+/**
+ * @brief File change event source based on \c inotify .
+ *
+ * The directory of the file is watched (so the file can be replaced, as many editors do), and every read of the
+ * descriptor that contains any modification of the file is one event.
+ */
+class InotifyFdEventSource : public IFdEventSource
+{
+public:
+
+    /**
+     * @brief Construct a source that watches changes in \c file_path .
+     *
+     * @throw \c InitializationException if the directory of \c file_path could not be watched.
+     */
+    CPP_UTILS_DllAPI InotifyFdEventSource(
+            const std::string& file_path);
+
+    //! Close the inotify instance.
+    CPP_UTILS_DllAPI ~InotifyFdEventSource();
+
+    CPP_UTILS_DllAPI int fd() const noexcept override;
+
+    CPP_UTILS_DllAPI uint32_t consume() noexcept override;
+
+protected:
+
+    //! Inotify descriptor.
+    int fd_;
+
+    //! Name of the file inside the watched directory.
+    std::string file_name_;
+};
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+#endif // if defined(__linux__)
@@ -0,0 +1,71 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file IFdEventSource.hpp
+ *
+ * This file contains the interface of the event sources that an \c EventReactor can drive.
+ */
+
+#pragma once
+
+#if defined(__linux__)
+
+#include <cstdint>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+/**
+ * @brief Interface of an event source represented by a file descriptor.
+ *
+ * The descriptor becomes readable when events have occurred, and \c consume reads them.
+ *
+ * @note Only available in Linux.
+ */
+class IFdEventSource
+{
+public:
+
+    //! Virtual destructor so sources can be destroyed from this interface.
+    virtual ~IFdEventSource()
+    {
+    }
+
+    //! File descriptor to watch.
+    virtual int fd() const noexcept = 0;
+
+    /**
+     * @brief Read the data available in the descriptor.
+     *
+     * It is called when the descriptor is readable, and it must not block.
+     *
+     * @return number of events read.
+     */
+    virtual uint32_t consume() noexcept = 0;
+
+    //! Whether the source will not produce more events (e.g. end of file), so it must not be watched anymore.
+    virtual bool finished() const noexcept
+    {
+        return false;
+    }
+
+};
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+#endif // if defined(__linux__)
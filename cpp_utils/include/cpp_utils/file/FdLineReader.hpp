@@ -0,0 +1,132 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FdLineReader.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/library/library_dll.h>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Buffered reader of lines from a file descriptor (stdin by default).
+ *
+ * Data is read in big chunks with a single \c read call each, and lines are found inside the buffer without
+ * copying them, so piped streams of many short lines are read at I/O speed.
+ *
+ * A line is given as a pointer into the internal buffer that is valid until the next line is read.
+ * The buffer is reused for the whole life of the object, and it only grows if a line does not fit in it.
+ *
+ * @note It is not thread safe.
+ */
+class FdLineReader
+{
+public:
+
+    //! Default size of the chunks read.
+    static constexpr std::size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+    /**
+     * @brief Construct a reader of descriptor \c fd .
+     *
+     * @param fd descriptor to read from. It is not closed by this object.
+     * @param chunk_size maximum size read from \c fd at once.
+     */
+    CPP_UTILS_DllAPI FdLineReader(
+            int fd = 0,
+            std::size_t chunk_size = DEFAULT_CHUNK_SIZE);
+
+    /**
+     * @brief Get the next line, without its line break.
+     *
+     * It blocks until a whole line is available or the end of the stream is reached.
+     * The last line of the stream is given even if it has no line break.
+     *
+     * @param [out] data beginning of the line. Valid until the next call to any method of this object.
+     * @param [out] size number of characters of the line.
+     *
+     * @return true if a line has been read.
+     * @return false if the end of the stream has been reached (or it could not be read), so there are no more lines.
+     */
+    CPP_UTILS_DllAPI bool next_line(
+            const char*& data,
+            std::size_t& size);
+
+    /**
+     * @brief Copy the next line, without its line break, in \c line .
+     *
+     * \c line memory is reused, so reading many lines in the same string does not allocate.
+     *
+     * @return true if a line has been read.
+     * @return false if there are no more lines. \c line is left empty.
+     */
+    CPP_UTILS_DllAPI bool read_line(
+            std::string& line);
+
+    //! Whether the end of the stream has been reached and every line has been read.
+    CPP_UTILS_DllAPI bool finished() const noexcept;
+
+protected:
+
+    //! Read one more chunk at the end of the buffer. Return false if nothing could be read.
+    bool fill_buffer_();
+
+    //! Descriptor to read from.
+    int fd_;
+
+    //! Maximum size read at once.
+    std::size_t chunk_size_;
+
+    //! Data read and not given yet is in [begin_, end_).
+    std::vector<char> buffer_;
+
+    //! Beginning of the data not given yet.
+    std::size_t begin_;
+
+    //! End of the data read.
+    std::size_t end_;
+
+    //! Whether the end of the stream has been reached.
+    bool end_of_stream_;
+};
+
+/**
+ * @brief Split a line in tokens divided by \c delimiter .
+ *
+ * It gives the same tokens as \c split_string , but it reuses the strings already in \c tokens ,
+ * so tokenizing many lines in the same vector does not allocate.
+ *
+ * @param data beginning of the line
+ * @param size number of characters of the line
+ * @param delimiter character that divides tokens. It will no longer exist in any token.
+ * @param [out] tokens tokens of the line. It is resized to the number of tokens.
+ *
+ * @return number of tokens
+ */
+CPP_UTILS_DllAPI std::size_t split_line(
+        const char* data,
+        std::size_t size,
+        char delimiter,
+        std::vector<std::string>& tokens);
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -18,10 +18,12 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
 #include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/time/time_utils.hpp>
 
 namespace eprosima {
 namespace utils {
@@ -52,5 +54,36 @@ CPP_UTILS_DllAPI std::vector<std::string> file_to_strings(
         bool strip_chars = true,
         bool strip_empty_lines = false);
 
+/**
+ * @brief Content hash and metadata of a file, read at once.
+ */
+struct FileSnapshot
+{
+    //! Hash of the whole content of the file, calculated with \c hash_64 .
+    uint64_t content_hash {0};
+
+    //! Size of the file in bytes, i.e. of the content hashed.
+    uint64_t size {0};
+
+    //! Time of the last modification of the file.
+    Timestamp modification_time {};
+};
+
+/**
+ * @brief Read the content hash and metadata of a file.
+ *
+ * The file is read into a buffer of the calling thread that is reused by later calls, so hashing a file again
+ * does not allocate unless it has grown. It is not mapped in memory, so a file truncated while it is read
+ * (e.g. by another process rewriting it) does not crash the process: the snapshot is just that of the content read.
+ *
+ * @param file_name name of the file to read
+ *
+ * @return Snapshot of the file
+ *
+ * @throw \c PreconditionNotMet if the file could not be read.
+ */
+CPP_UTILS_DllAPI FileSnapshot file_to_snapshot(
+        const char* file_name);
+
 } /* namespace utils */
 } /* namespace eprosima */
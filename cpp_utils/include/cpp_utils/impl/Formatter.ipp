@@ -25,10 +25,17 @@ template<class Val>
 Formatter& Formatter::operator <<(
         const Val& val)
 {
-    ss_ << val;
+    append_value_(val);
     return *this;
 }
 
+template<class Val>
+void Formatter::append_value_(
+        const Val& val)
+{
+    stream_() << val;
+}
+
 } /* namespace utils */
 } /* namespace eprosima */
 
@@ -18,6 +18,11 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
+#include <regex>
+#include <string>
+
 #include <cpp_utils/library/library_dll.h>
 #include <cpp_utils/Log.hpp>
 #include <cpp_utils/logging/BaseLogConfiguration.hpp>
@@ -32,6 +37,10 @@ namespace utils {
  * - Their kind is higher or equal than the verbosity level.
  * - Their category or message matches the filter regex.
  *
+ * The filter regex of each kind is compiled once, when the consumer is created or the filter is set, and not for
+ * every entry. Empty filters accept every entry without matching, and filters without regex metacharacters are
+ * matched as plain substrings.
+ *
  * @attention This consumer filters the entries that it receives, but other entries could be filtered beforehand
  * by Fast DDS Log. To avoid this consumer's filters, set the verbosity to Info and do not filter the content.
  */
@@ -48,16 +57,78 @@ public:
     CPP_UTILS_DllAPI
     ~BaseLogConsumer() noexcept = default;
 
+    /**
+     * @brief Replace the regex filter for entry category or message.
+     *
+     * It can be called while entries are being consumed: each entry is filtered either with the old
+     * or with the new filter.
+     *
+     * @throw \c std::regex_error if the filter of any kind is not a valid regex. The filter is not changed then.
+     */
+    CPP_UTILS_DllAPI
+    void set_filter(
+            const LogFilter& filter);
+
 protected:
 
+    //! Filter of a single kind, prepared to be matched against entries without parsing it again.
+    struct CompiledFilter
+    {
+        //! How the filter is matched, from the cheapest to the most expensive.
+        enum class Mode
+        {
+            //! Empty filter: every text matches.
+            match_all,
+
+            //! Filter without regex metacharacters: texts containing it match.
+            substring,
+
+            //! Any other filter: texts where the regex is found match.
+            regex,
+        };
+
+        //! Choose the cheapest mode for \c pattern and compile its regex if needed.
+        CompiledFilter(
+                const std::string& pattern);
+
+        //! Whether the text in [begin, end) matches the filter.
+        bool matches(
+                const char* begin,
+                const char* end) const;
+
+        //! How this filter is matched.
+        Mode mode;
+
+        //! Text of the filter.
+        std::string pattern;
+
+        //! Regex of the filter. Only compiled in \c regex mode.
+        std::regex regex;
+    };
+
+    //! Compiled filter of each kind. Kinds without filter accept every entry.
+    using CompiledLogFilter = std::map<VerbosityKind, CompiledFilter>;
+
+    //! Compile the filter of every kind in \c filter .
+    static std::shared_ptr<const CompiledLogFilter> compile_filter_(
+            const LogFilter& filter);
+
     //! Whether the entry must be accepted depending on kind and category
     CPP_UTILS_DllAPI
     virtual bool accept_entry_(
             const Log::Entry& entry);
 
-    //! Regex filter for entry category or message.
+    //! Regex filter for entry category or message, as configured.
     LogFilter filter_;
 
+    /**
+     * @brief Filters of \c filter_ compiled.
+     *
+     * It is replaced as a whole with \c std::atomic_store in \c set_filter , and read with \c std::atomic_load ,
+     * so entries can be filtered while the filter changes.
+     */
+    std::shared_ptr<const CompiledLogFilter> compiled_filter_;
+
     //! Maximum Log Kind that will be printed.
     VerbosityKind verbosity_;
 };
@@ -0,0 +1,338 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BinaryLog.hpp
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/logging/BaseLogConfiguration.hpp>
+#include <cpp_utils/logging/CategoryVerbosityRegistry.hpp>
+#include <cpp_utils/logging/compile_time_log_filter.hpp>
+
+namespace eprosima {
+namespace utils {
+
+//! Identifier of a \c BinaryLogSite , given when it is registered.
+using BinaryLogSiteId = uint32_t;
+
+/**
+ * @brief Static description of a place in the code that writes binary log records.
+ *
+ * It is registered once, and every record written from it only holds its identifier.
+ */
+struct BinaryLogSite
+{
+    //! Kind of the records of this site.
+    VerbosityKind kind;
+
+    //! Category of the records of this site.
+    std::string category;
+
+    //! Source file of this site.
+    std::string file;
+
+    //! Source line of this site.
+    uint32_t line;
+
+    //! Message of the records. Each \c {} is replaced by the next argument of the record when decoded.
+    std::string format;
+};
+
+//! Type of an argument of a binary log record, stored before its bytes.
+enum class BinaryLogArgumentType : uint8_t
+{
+    //! Any signed integer or enumeration, stored as \c int64_t .
+    signed_integer = 'i',
+
+    //! Any unsigned integer, stored as \c uint64_t .
+    unsigned_integer = 'u',
+
+    //! Any floating point number, stored as \c double .
+    floating_point = 'd',
+
+    //! \c bool , stored as one byte.
+    boolean = 'b',
+
+    //! \c char , stored as one byte.
+    character = 'c',
+
+    //! Text, stored as its size in \c uint32_t followed by its characters.
+    string = 's',
+};
+
+/**
+ * @brief Records of a single thread, waiting to be written in the binary log.
+ *
+ * Each thread writes in its own buffer, so writing a record does not contend with other threads.
+ */
+struct BinaryLogBuffer
+{
+    //! Append \c size bytes from \c data at the end of the buffer.
+    void append(
+            const void* data,
+            std::size_t size)
+    {
+        if (used + size > bytes.size())
+        {
+            bytes.resize(std::max(bytes.size() * 2, used + size));
+        }
+        std::memcpy(bytes.data() + used, data, size);
+        used += size;
+    }
+
+    //! Protects the buffer. It is only contended while the buffer is being flushed.
+    std::mutex mutex;
+
+    //! Memory of the buffer. Only the first \c used bytes hold records.
+    std::vector<char> bytes;
+
+    //! Number of bytes used.
+    std::size_t used = 0;
+
+    //! Index of the thread of this buffer, written with its records.
+    uint32_t thread_index = 0;
+};
+
+/**
+ * Binary log that writes log records in a compact binary file, instead of formatting them as text.
+ *
+ * Each place in the code that logs (a \c BinaryLogSite with file, line, category and message format) is registered
+ * once, and then each record only holds the site identifier, a timestamp and the raw bytes of its arguments.
+ * Records are appended to a buffer of the calling thread, and buffers are written in the file once full,
+ * when \c flush is called, when their thread ends or when the log is closed.
+ *
+ * The file is decoded back to text offline with \c BinaryLogReader (e.g. with tool \c cpp_utils_log_decoder ).
+ *
+ * Use it with macros \c logBinaryInfo , \c logBinaryWarning and \c logBinaryError :
+ * @code
+ * logBinaryInfo(DDSPIPE, "Participant {} discovered {} endpoints", participant_name, n_endpoints);
+ * @endcode
+ *
+ * Arguments can be integers, enumerations, floating point numbers, \c bool , \c char , C strings and
+ * \c std::string .
+ *
+ * @note Records are not written while the log is not open, nor for categories whose verbosity in
+ * \c CategoryVerbosityRegistry is lower than their kind. Categories disabled in \c compile_time_log_filter.hpp
+ * are compiled out.
+ */
+class BinaryLog
+{
+public:
+
+    //! Size of the thread buffers from which they are written in the file.
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+    //! First bytes of a binary log file.
+    static constexpr const char* FILE_MAGIC = "CUBINLOG";
+
+    //! Version of the binary log format, written after \c FILE_MAGIC .
+    static constexpr uint32_t FILE_VERSION = 1;
+
+    //! Written after the version, to detect files written with a different byte order.
+    static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    //! Tag of a block with the description of a site.
+    static constexpr char SITE_BLOCK = 'S';
+
+    //! Tag of a block with records of a thread.
+    static constexpr char RECORDS_BLOCK = 'R';
+
+    /**
+     * @brief Start writing records in file \c file_path , replacing it if it exists.
+     *
+     * If the log was already open, the previous file is closed first.
+     *
+     * @param buffer_size size of the thread buffers from which they are written in the file.
+     *
+     * @throw \c InitializationException if the file could not be opened.
+     */
+    CPP_UTILS_DllAPI static void open(
+            const std::string& file_path,
+            std::size_t buffer_size = DEFAULT_BUFFER_SIZE);
+
+    /**
+     * @brief Write every record buffered and close the file.
+     *
+     * Records written meanwhile from other threads may be discarded.
+     */
+    CPP_UTILS_DllAPI static void close();
+
+    //! Write the records buffered in every thread in the file.
+    CPP_UTILS_DllAPI static void flush();
+
+    //! Whether the log is open, so records are written.
+    CPP_UTILS_DllAPI static bool enabled() noexcept;
+
+    /**
+     * @brief Register a site and get its identifier.
+     *
+     * Each site is meant to be registered once, in a static variable, which the logging macros do.
+     * The arguments are only used to deduce the signature shared with \c write .
+     */
+    template <typename ... Args>
+    static BinaryLogSiteId register_site(
+            VerbosityKind kind,
+            const char* category,
+            const char* file,
+            uint32_t line,
+            const char* format,
+            const Args&... args);
+
+    /**
+     * @brief Write a record of \c site with \c args in the buffer of this thread.
+     *
+     * @param site identifier of the site, given by \c register_site .
+     * @param format not used, as it is already stored in the site.
+     * @param args arguments of the record.
+     */
+    template <typename ... Args>
+    static void write(
+            BinaryLogSiteId site,
+            const char* format,
+            const Args&... args);
+
+protected:
+
+    //! Register \c site and give it an identifier.
+    CPP_UTILS_DllAPI static BinaryLogSiteId register_site_(
+            BinaryLogSite&& site);
+
+    //! Buffer of this thread, created the first time it is used.
+    CPP_UTILS_DllAPI static BinaryLogBuffer& thread_buffer_();
+
+    //! Write the header of a record of \c site in \c buffer . Return where the record begins.
+    CPP_UTILS_DllAPI static std::size_t begin_record_(
+            BinaryLogBuffer& buffer,
+            BinaryLogSiteId site);
+
+    //! Set the size of the record that begins in \c begin , and write the buffer in the file if it is full.
+    CPP_UTILS_DllAPI static void end_record_(
+            BinaryLogBuffer& buffer,
+            std::size_t begin);
+
+    //! Write the records of \c buffer in the file. It must be guarded by the mutex of \c buffer .
+    CPP_UTILS_DllAPI static void flush_buffer_nts_(
+            BinaryLogBuffer& buffer);
+
+    //! Encode no arguments.
+    static void encode_(
+            BinaryLogBuffer& buffer);
+
+    //! Encode every argument, one after the other.
+    template <typename T, typename ... Args>
+    static void encode_(
+            BinaryLogBuffer& buffer,
+            const T& arg,
+            const Args&... args);
+
+    //! Encode a single argument with its type.
+    static void encode_argument_(
+            BinaryLogBuffer& buffer,
+            bool arg);
+
+    //! Encode a single argument with its type.
+    static void encode_argument_(
+            BinaryLogBuffer& buffer,
+            char arg);
+
+    //! Encode a single argument with its type.
+    static void encode_argument_(
+            BinaryLogBuffer& buffer,
+            const char* arg);
+
+    //! Encode a single argument with its type.
+    static void encode_argument_(
+            BinaryLogBuffer& buffer,
+            const std::string& arg);
+
+    //! Encode a single argument with its type, for integers and floating point numbers.
+    template <typename T>
+    static typename std::enable_if<std::is_arithmetic<T>::value>::type encode_argument_(
+            BinaryLogBuffer& buffer,
+            const T& arg);
+
+    //! Encode a single argument with its type, for enumerations, as signed integers.
+    template <typename T>
+    static typename std::enable_if<std::is_enum<T>::value>::type encode_argument_(
+            BinaryLogBuffer& buffer,
+            const T& arg);
+
+    //! Encode text with its size.
+    static void encode_string_(
+            BinaryLogBuffer& buffer,
+            const char* data,
+            std::size_t size);
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+/**
+ * @brief Write a binary log record of kind Info, when the binary log is open.
+ *
+ * @param cat category of the record, as in \c logInfo .
+ * @param ... message format, with a \c {} for each argument, followed by the arguments.
+ */
+#define logBinaryInfo(cat, ...) logBinary_(eprosima::utils::VerbosityKind::Info, cat, __VA_ARGS__)
+
+/**
+ * @brief Write a binary log record of kind Warning, when the binary log is open.
+ *
+ * @param cat category of the record, as in \c logWarning .
+ * @param ... message format, with a \c {} for each argument, followed by the arguments.
+ */
+#define logBinaryWarning(cat, ...) logBinary_(eprosima::utils::VerbosityKind::Warning, cat, __VA_ARGS__)
+
+/**
+ * @brief Write a binary log record of kind Error, when the binary log is open.
+ *
+ * @param cat category of the record, as in \c logError .
+ * @param ... message format, with a \c {} for each argument, followed by the arguments.
+ */
+#define logBinaryError(cat, ...) logBinary_(eprosima::utils::VerbosityKind::Error, cat, __VA_ARGS__)
+
+#define logBinary_(kind, cat, ...)                                                                                 \
+    {                                                                                                              \
+        eprosima::utils::log_if_compiled(CPP_UTILS_LOG_COMPILED_TAG(cat, kind), __func__,                          \
+                [&](auto)                                                                                          \
+                {                                                                                                  \
+                    static const std::atomic<eprosima::utils::CategoryVerbosityRegistry::Kind>&                    \
+                    binary_log_category_tmp__ =                                                                    \
+                            eprosima::utils::CategoryVerbosityRegistry::get_instance().register_category(#cat);    \
+                    if (eprosima::utils::CategoryVerbosityRegistry::is_enabled(binary_log_category_tmp__, kind) && \
+                            eprosima::utils::BinaryLog::enabled())                                                 \
+                    {                                                                                              \
+                        static const eprosima::utils::BinaryLogSiteId binary_log_site_tmp__ =                      \
+                                eprosima::utils::BinaryLog::register_site(                                         \
+                            kind, #cat, __FILE__, __LINE__, __VA_ARGS__);                                          \
+                        eprosima::utils::BinaryLog::write(binary_log_site_tmp__, __VA_ARGS__);                     \
+                    }                                                                                              \
+                });                                                                                                \
+    }
+
+// Include implementation template file
+#include <cpp_utils/logging/impl/BinaryLog.ipp>
@@ -0,0 +1,139 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BinaryLogReader.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/logging/BinaryLog.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Record of a binary log decoded, with the description of its site and its message rendered.
+ */
+struct BinaryLogEntry
+{
+    //! Time when the record was written.
+    Timestamp timestamp;
+
+    //! Index of the thread that wrote the record, in the order threads started writing.
+    uint32_t thread_index;
+
+    //! Site of the record.
+    BinaryLogSite site;
+
+    //! Format of the site with each \c {} replaced by its argument. Arguments left are appended.
+    std::string message;
+};
+
+/**
+ * Reader of the files written by \c BinaryLog , that decodes their records one by one.
+ *
+ * Records are given in the order they are in the file: in order for each thread, but not between threads.
+ *
+ * A file that ends in the middle of a block (e.g. because the process crashed while writing it) is read until
+ * its last complete record.
+ */
+class BinaryLogReader
+{
+public:
+
+    /**
+     * @brief Open the binary log in \c file_path and read its header.
+     *
+     * @throw \c InitializationException if the file could not be opened or it is not a binary log
+     * written in a machine with the same byte order.
+     */
+    CPP_UTILS_DllAPI BinaryLogReader(
+            const std::string& file_path);
+
+    /**
+     * @brief Read the next record.
+     *
+     * @param [out] entry record decoded.
+     *
+     * @return true if a record has been read.
+     * @return false if there are no more records.
+     *
+     * @throw \c InconsistencyException if the file holds a record of an unknown site or with wrong arguments.
+     */
+    CPP_UTILS_DllAPI bool next(
+            BinaryLogEntry& entry);
+
+    //! Read every record left, sorted by timestamp.
+    CPP_UTILS_DllAPI std::vector<BinaryLogEntry> read_all_sorted();
+
+protected:
+
+    //! Read the next block of records, describing the sites found before it. Return false if there are no more.
+    bool read_records_block_();
+
+    //! Read \c size bytes in \c data . Return false if the file ends before.
+    bool read_(
+            void* data,
+            std::size_t size);
+
+    //! Read a string preceded by its size. Return false if the file ends before.
+    bool read_string_(
+            std::string& value);
+
+    //! Render the arguments in [begin, end) in the format of \c site .
+    static std::string render_(
+            const BinaryLogSite& site,
+            const char* begin,
+            const char* end);
+
+    //! File read.
+    std::ifstream file_;
+
+    //! Sites described so far, by identifier.
+    std::map<BinaryLogSiteId, BinaryLogSite> sites_;
+
+    //! Records of the current block.
+    std::vector<char> block_;
+
+    //! Position of the next record in \c block_ .
+    std::size_t block_position_;
+
+    //! Thread index of the current block.
+    uint32_t block_thread_index_;
+
+    //! Whether the file ends in the middle of the current block.
+    bool truncated_;
+};
+
+/**
+ * @brief \c BinaryLogEntry to stream serialization
+ *
+ * It is written as a text log line: timestamp, category, kind, message, file and line.
+ */
+CPP_UTILS_DllAPI std::ostream& operator <<(
+        std::ostream& os,
+        const BinaryLogEntry& entry);
+
+} /* namespace utils */
+} /* namespace eprosima */
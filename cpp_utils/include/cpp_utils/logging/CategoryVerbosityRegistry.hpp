@@ -0,0 +1,127 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CategoryVerbosityRegistry.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fastdds/dds/log/Log.hpp>
+
+#include <cpp_utils/library/library_dll.h>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * This class creates a Singleton object that holds the verbosity of each log category, settable at runtime.
+ *
+ * Log macros register their category once per call site and keep a reference to its level, so they can skip
+ * a message of a category with a lower verbosity with a single relaxed load, before formatting it.
+ *
+ * Verbosities are set for category glob patterns (e.g. \c DDSPIPE_* ). Patterns are matched against each category
+ * only when the pattern is set or when the category is registered, never when logging.
+ * If several patterns match a category, the last one set wins.
+ * Categories that match no pattern have the maximum verbosity (Info), so only the global verbosity applies to them.
+ */
+class CategoryVerbosityRegistry
+{
+public:
+
+    //! Kind of a log entry, as in Fast DDS Log.
+    using Kind = eprosima::fastdds::dds::Log::Kind;
+
+    //! Get Singleton object
+    CPP_UTILS_DllAPI static CategoryVerbosityRegistry& get_instance() noexcept;
+
+    /**
+     * @brief Register \c category and get its verbosity.
+     *
+     * The reference is valid for the whole life of the process, and it is updated every time the verbosity
+     * of the category changes.
+     * Registering a category again gives the same reference.
+     */
+    CPP_UTILS_DllAPI const std::atomic<Kind>& register_category(
+            const std::string& category);
+
+    /**
+     * @brief Set the verbosity of every category that matches \c category_pattern .
+     *
+     * It applies to categories already registered and to categories registered later.
+     * Setting a pattern that is already set replaces its verbosity, and makes it the last one set.
+     *
+     * @param category_pattern glob pattern of the categories, or a category name.
+     * @param verbosity maximum kind of the entries of the categories that are logged.
+     */
+    CPP_UTILS_DllAPI void set_verbosity(
+            const std::string& category_pattern,
+            Kind verbosity);
+
+    //! Remove every pattern set, so every category gets the maximum verbosity again.
+    CPP_UTILS_DllAPI void reset() noexcept;
+
+    //! Current verbosity of \c category , whether it is registered or not.
+    CPP_UTILS_DllAPI Kind verbosity(
+            const std::string& category) const;
+
+    //! Whether an entry of \c kind passes the verbosity \c category_verbosity of its category.
+    static bool is_enabled(
+            const std::atomic<Kind>& category_verbosity,
+            Kind kind) noexcept
+    {
+        return kind <= category_verbosity.load(std::memory_order_relaxed);
+    }
+
+    //! Deleted copy method
+    CategoryVerbosityRegistry(
+            CategoryVerbosityRegistry const&) = delete;
+    //! Deleted copy method
+    void operator =(
+            CategoryVerbosityRegistry const&) = delete;
+
+protected:
+
+    //! Private constructor
+    CategoryVerbosityRegistry() = default;
+
+    //! Verbosity of \c category given by the patterns set. It must be guarded by \c mutex_
+    Kind verbosity_nts_(
+            const std::string& category) const;
+
+    /**
+     * @brief Verbosity of each category registered.
+     *
+     * Nodes of a map are never moved, so references to the levels stay valid.
+     *
+     * Guarded by \c mutex_
+     */
+    std::map<std::string, std::atomic<Kind>> categories_;
+
+    //! Patterns set with their verbosity, in the order they were set. Guarded by \c mutex_
+    std::vector<std::pair<std::string, Kind>> patterns_;
+
+    //! Protects the categories and the patterns.
+    mutable std::mutex mutex_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,344 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file DeferredLog.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/logging/BaseLogConfiguration.hpp>
+#include <cpp_utils/logging/CategoryVerbosityRegistry.hpp>
+#include <cpp_utils/logging/compile_time_log_filter.hpp>
+
+namespace eprosima {
+namespace utils {
+
+//! Text argument of a \c DeferredLogEntry , copied in its argument buffer.
+struct DeferredLogString
+{
+    //! Position of the text in the argument buffer.
+    uint32_t offset;
+
+    //! Number of characters of the text.
+    uint32_t size;
+};
+
+/**
+ * @brief Log entry captured by \c DeferredLog , whose message is not formatted yet.
+ *
+ * Its arguments are copied in a buffer of fixed size inside the entry, so capturing them does not allocate
+ * (unless an argument allocates when copied), and the entry knows how to format and destroy them.
+ */
+struct DeferredLogEntry
+{
+    //! Size of the buffer of the arguments.
+    static constexpr std::size_t ARGUMENTS_CAPACITY = 192;
+
+    //! Write the message of \c entry in \c message .
+    using FormatFunction = void (*)(
+        const DeferredLogEntry& entry,
+        std::string& message);
+
+    //! Destroy the arguments of \c entry .
+    using DestroyFunction = void (*)(
+        DeferredLogEntry& entry);
+
+    //! Verbosity of the category of the entry, checked again before formatting it.
+    const std::atomic<CategoryVerbosityRegistry::Kind>* category_verbosity;
+
+    //! Kind of the entry.
+    VerbosityKind kind;
+
+    //! File, line, function and category of the entry. They are static strings.
+    Log::Context context;
+
+    //! Message format, with a \c {} for each argument. It is a static string.
+    const char* format;
+
+    //! Function that formats the arguments of the entry.
+    FormatFunction format_function;
+
+    //! Function that destroys the arguments of the entry.
+    DestroyFunction destroy_function;
+
+    //! Bytes of \c arguments used.
+    std::size_t arguments_size;
+
+    //! Whether a text argument did not fit in \c arguments .
+    bool overflow;
+
+    //! Arguments of the entry (in a \c std::tuple ), followed by the characters of its text arguments.
+    alignas(std::max_align_t) char arguments[ARGUMENTS_CAPACITY];
+};
+
+/**
+ * Log whose messages are formatted in a thread of its own, instead of in the thread that logs them.
+ *
+ * The thread that logs only copies the arguments of the entry in a slot of a queue, together with the function
+ * to format them. Slots are taken with an atomic ticket, and the arguments are copied without holding any lock,
+ * so threads that log do not wait for each other, and an argument whose copy logs does not deadlock. The log thread takes the entries from the queue, and only formats those whose kind is still
+ * accepted by the Fast DDS Log verbosity and by \c CategoryVerbosityRegistry , which may have changed meanwhile.
+ * Then it passes them to Fast DDS Log as any other entry, where its consumers filter them as usual.
+ *
+ * Use it with macros \c logDeferredInfo , \c logDeferredWarning and \c logDeferredError :
+ * @code
+ * logDeferredWarning(DDSPIPE, "Reader {} of topic {} lost {} samples", reader_id, topic_name, lost);
+ * @endcode
+ *
+ * Arguments are copied by value: integers, enumerations, floating point numbers, \c bool and \c char are kept as
+ * they are, C strings and \c std::string are copied in the buffer of the entry, and any other type is copied
+ * with its copy constructor and formatted later with its \c operator<< .
+ *
+ * While the log is not started, and for entries whose text arguments do not fit in the buffer of the entry,
+ * the message is formatted in the calling thread and passed to Fast DDS Log right away.
+ * If the queue is full, entries are dropped instead of blocking the calling thread.
+ *
+ * @note Categories disabled in \c compile_time_log_filter.hpp are compiled out.
+ */
+class DeferredLog
+{
+public:
+
+    //! Default number of entries that can wait to be formatted.
+    static constexpr std::size_t DEFAULT_QUEUE_SIZE = 4096;
+
+    /**
+     * @brief Start the log thread, with room for \c queue_size entries waiting to be formatted.
+     *
+     * If the log was already started, it is stopped first.
+     *
+     * @throw \c InitializationException if \c queue_size is 0.
+     */
+    CPP_UTILS_DllAPI static void start(
+            std::size_t queue_size = DEFAULT_QUEUE_SIZE);
+
+    /**
+     * @brief Format the entries queued, stop the log thread, and flush \c LogStaging (and so Fast DDS Log).
+     *
+     * Entries written meanwhile from other threads may be dropped.
+     */
+    CPP_UTILS_DllAPI static void stop();
+
+    //! Wait until the entries queued so far are formatted, and flush \c LogStaging (and so Fast DDS Log).
+    CPP_UTILS_DllAPI static void flush();
+
+    //! Whether the log thread is running, so entries are formatted in it.
+    CPP_UTILS_DllAPI static bool enabled() noexcept;
+
+    //! Number of entries dropped because the queue was full.
+    CPP_UTILS_DllAPI static uint64_t dropped_entries() noexcept;
+
+    //! Number of entries not formatted, because their kind was not accepted any more when they were taken.
+    CPP_UTILS_DllAPI static uint64_t filtered_entries() noexcept;
+
+    /**
+     * @brief Queue an entry with \c args , to be formatted in the log thread.
+     *
+     * @param category_verbosity verbosity of the category in \c CategoryVerbosityRegistry .
+     * @param kind kind of the entry.
+     * @param context file, line, function and category of the entry. They must be static strings.
+     * @param format message, with a \c {} for each argument. It must be a static string.
+     * @param args arguments of the message. Those left when there are no more \c {} are appended at the end.
+     */
+    template <typename ... Args>
+    static void write(
+            const std::atomic<CategoryVerbosityRegistry::Kind>& category_verbosity,
+            VerbosityKind kind,
+            const Log::Context& context,
+            const char* format,
+            const Args&... args);
+
+protected:
+
+    //! How an argument of type \c T is kept in an entry.
+    template <typename T>
+    struct Stored
+    {
+        using type = typename std::conditional<
+            std::is_same<typename std::decay<T>::type, std::string>::value ||
+            std::is_same<typename std::decay<T>::type, char*>::value ||
+            std::is_same<typename std::decay<T>::type, const char*>::value,
+            DeferredLogString,
+            typename std::decay<T>::type>::type;
+    };
+
+    /**
+     * @brief Take the next free slot of the queue, without locking it.
+     *
+     * @param ticket position of the slot in the queue, to give to \c end_entry_ .
+     *
+     * @return the entry of the slot, or null if the queue is full or the log is not started (the entry is dropped).
+     */
+    CPP_UTILS_DllAPI static DeferredLogEntry* begin_entry_(
+            uint64_t& ticket);
+
+    //! Queue the entry of the slot taken with \c ticket , or skip it if \c cancel .
+    CPP_UTILS_DllAPI static void end_entry_(
+            uint64_t ticket,
+            bool cancel);
+
+    //! Format the message with \c args in this thread and pass it to Fast DDS Log.
+    template <typename ... Args>
+    static void write_now_(
+            VerbosityKind kind,
+            const Log::Context& context,
+            const char* format,
+            const Args&... args);
+
+    //! Copy a text argument in the buffer of \c entry .
+    CPP_UTILS_DllAPI static DeferredLogString capture_argument_(
+            DeferredLogEntry& entry,
+            const char* arg);
+
+    //! Copy a text argument in the buffer of \c entry .
+    static DeferredLogString capture_argument_(
+            DeferredLogEntry& entry,
+            char* arg);
+
+    //! Copy a text argument in the buffer of \c entry .
+    CPP_UTILS_DllAPI static DeferredLogString capture_argument_(
+            DeferredLogEntry& entry,
+            const std::string& arg);
+
+    //! Any other argument is copied as it is.
+    template <typename T>
+    static const T& capture_argument_(
+            DeferredLogEntry& entry,
+            const T& arg);
+
+    //! \c DeferredLogEntry::FormatFunction of entries with arguments \c Arguments .
+    template <typename Arguments>
+    static void format_entry_(
+            const DeferredLogEntry& entry,
+            std::string& message);
+
+    //! \c DeferredLogEntry::DestroyFunction of entries with arguments \c Arguments .
+    template <typename Arguments>
+    static void destroy_entry_(
+            DeferredLogEntry& entry);
+
+    //! Write \c format in \c message replacing each \c {} with the next argument, from argument \c I .
+    template <std::size_t I, typename Arguments>
+    static typename std::enable_if<(I < std::tuple_size<Arguments>::value)>::type format_arguments_(
+            const Arguments& arguments,
+            const char* buffer,
+            const char* format,
+            std::string& message);
+
+    //! Write the rest of \c format in \c message , when there are no arguments left.
+    template <std::size_t I, typename Arguments>
+    static typename std::enable_if<(I == std::tuple_size<Arguments>::value)>::type format_arguments_(
+            const Arguments& arguments,
+            const char* buffer,
+            const char* format,
+            std::string& message);
+
+    //! Append the arguments from \c I , separated by spaces, when there are no \c {} left.
+    template <std::size_t I, typename Arguments>
+    static typename std::enable_if<(I < std::tuple_size<Arguments>::value)>::type append_arguments_(
+            const Arguments& arguments,
+            const char* buffer,
+            std::string& message);
+
+    //! No arguments left to append.
+    template <std::size_t I, typename Arguments>
+    static typename std::enable_if<(I == std::tuple_size<Arguments>::value)>::type append_arguments_(
+            const Arguments& arguments,
+            const char* buffer,
+            std::string& message);
+
+    //! Append a text argument copied in \c buffer .
+    CPP_UTILS_DllAPI static void append_argument_(
+            const DeferredLogString& arg,
+            const char* buffer,
+            std::string& message);
+
+    //! Append a text argument.
+    CPP_UTILS_DllAPI static void append_argument_(
+            const char* arg,
+            const char* buffer,
+            std::string& message);
+
+    //! Append a text argument.
+    CPP_UTILS_DllAPI static void append_argument_(
+            const std::string& arg,
+            const char* buffer,
+            std::string& message);
+
+    //! Append any other argument, formatted with \c Formatter .
+    template <typename T>
+    static void append_argument_(
+            const T& arg,
+            const char* buffer,
+            std::string& message);
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+/**
+ * @brief Log an entry of kind Info, formatted in the \c DeferredLog thread.
+ *
+ * @param cat category of the entry, as in \c logInfo .
+ * @param ... message format, with a \c {} for each argument, followed by the arguments.
+ */
+#define logDeferredInfo(cat, ...) logDeferred_(eprosima::utils::VerbosityKind::Info, cat, __VA_ARGS__)
+
+/**
+ * @brief Log an entry of kind Warning, formatted in the \c DeferredLog thread.
+ *
+ * @param cat category of the entry, as in \c logWarning .
+ * @param ... message format, with a \c {} for each argument, followed by the arguments.
+ */
+#define logDeferredWarning(cat, ...) logDeferred_(eprosima::utils::VerbosityKind::Warning, cat, __VA_ARGS__)
+
+/**
+ * @brief Log an entry of kind Error, formatted in the \c DeferredLog thread.
+ *
+ * @param cat category of the entry, as in \c logError .
+ * @param ... message format, with a \c {} for each argument, followed by the arguments.
+ */
+#define logDeferredError(cat, ...) logDeferred_(eprosima::utils::VerbosityKind::Error, cat, __VA_ARGS__)
+
+#define logDeferred_(kind, cat, ...)                                                                                  \
+    {                                                                                                                 \
+        eprosima::utils::log_if_compiled(CPP_UTILS_LOG_COMPILED_TAG(cat, kind), __func__,                             \
+                [&](auto deferred_log_function_tmp__)                                                                 \
+                {                                                                                                     \
+                    static const std::atomic<eprosima::utils::CategoryVerbosityRegistry::Kind>&                       \
+                    deferred_log_category_tmp__ =                                                                     \
+                            eprosima::utils::CategoryVerbosityRegistry::get_instance().register_category(#cat);       \
+                    if (eprosima::utils::CategoryVerbosityRegistry::is_enabled(deferred_log_category_tmp__, kind) &&  \
+                            eprosima::utils::Log::GetVerbosity() >= kind)                                             \
+                    {                                                                                                 \
+                        eprosima::utils::DeferredLog::write(deferred_log_category_tmp__, kind,                        \
+                                eprosima::utils::Log::Context{__FILE__, __LINE__, deferred_log_function_tmp__, #cat}, \
+                                __VA_ARGS__);                                                                         \
+                    }                                                                                                 \
+                });                                                                                                   \
+    }
+
+// Include implementation template file
+#include <cpp_utils/logging/impl/DeferredLog.ipp>
@@ -0,0 +1,92 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FileLogConfiguration.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/logging/BaseLogConfiguration.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * The collection of settings of a \c FileLogConsumer .
+ *
+ * Besides the verbosity and the filter, they are:
+ *  - File to write and its rotation
+ *  - Interval to write the entries buffered
+ *  - Size of the buffers and of the queue of buffers to write
+ */
+struct FileLogConfiguration : public BaseLogConfiguration
+{
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    //! Default FileLogConfiguration constructor
+    CPP_UTILS_DllAPI
+    FileLogConfiguration();
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    /**
+     * @brief \c is_valid method.
+     *
+     * The file path, the flush interval and the buffers must not be empty.
+     */
+    CPP_UTILS_DllAPI
+    virtual bool is_valid(
+            Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Path of the file to write.
+    std::string file_path;
+
+    /**
+     * @brief Size in bytes from which the file is rotated. 0 to never rotate it.
+     *
+     * When rotated, the file is renamed to \c file_path.1 (and the previous ones to \c file_path.2 and so on),
+     * and a new file is started.
+     */
+    uint64_t max_file_size;
+
+    //! Number of rotated files kept besides the current one. Older ones are removed.
+    uint32_t max_rotated_files;
+
+    //! Maximum time that an accepted entry waits in a buffer before being written.
+    Duration_ms flush_interval;
+
+    //! Size in bytes from which a buffer is handed to the writer.
+    std::size_t buffer_size;
+
+    //! Maximum number of buffers waiting to be written. Entries are dropped while the queue is full.
+    uint32_t queue_size;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
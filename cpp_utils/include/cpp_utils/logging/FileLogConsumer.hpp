@@ -0,0 +1,200 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FileLogConsumer.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/logging/BaseLogConsumer.hpp>
+#include <cpp_utils/logging/FileLogConfiguration.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * File Log Consumer that writes the entries accepted by the \c BaseLogConsumer in a file, asynchronously.
+ *
+ * \c Consume only formats the entry at the end of a buffer that is reused, so it does not make any system call
+ * in Fast DDS's logging thread. Once a buffer is full it is handed to a writer thread through a bounded queue,
+ * and the writer writes every buffer queued with a single \c writev call.
+ * Buffers not full are also written after the flush interval, or when \c flush is called.
+ *
+ * If the writer does not keep up and the queue is full, new entries are dropped, instead of blocking the logging
+ * thread. They are counted in \c dropped_entries , and a line with the number of entries dropped is written
+ * in the file once there is room again.
+ *
+ * The file is rotated once its size reaches the maximum size configured, so every file may exceed it by the data
+ * written at once.
+ */
+class FileLogConsumer : public BaseLogConsumer
+{
+public:
+
+    /**
+     * @brief Open the file and start the writer thread.
+     *
+     * If the file exists, the entries are appended to it.
+     *
+     * @throw \c InitializationException if the configuration is not valid or the file could not be opened.
+     */
+    CPP_UTILS_DllAPI
+    FileLogConsumer(
+            const FileLogConfiguration* log_configuration);
+
+    /**
+     * @brief Write every entry consumed, stop the writer thread and close the file.
+     */
+    CPP_UTILS_DllAPI
+    ~FileLogConsumer();
+
+    /**
+     * @brief Implements the \c BaseLogConsumer \c Consume method.
+     *
+     * To be consumed, entries must be accepted by the \c BaseLogConsumer, so:
+     * - Their kind must be higher or equal than the verbosity level.
+     * - Their category or message must match the filter regex.
+     *
+     * The entry is formatted in the current buffer, unless the queue of buffers is full, in which case it is dropped.
+     *
+     * @param entry entry to consume
+     */
+    CPP_UTILS_DllAPI
+    void Consume(
+            const Log::Entry& entry) override;
+
+    /**
+     * @brief Write every entry consumed so far, and wait until it is written.
+     */
+    CPP_UTILS_DllAPI
+    void flush();
+
+    //! Number of entries dropped because the queue of buffers was full.
+    CPP_UTILS_DllAPI
+    uint64_t dropped_entries() const noexcept;
+
+protected:
+
+    //! Stream buffer that appends everything written at the end of a string, reusing its memory.
+    class StringAppendBuffer : public std::streambuf
+    {
+    public:
+
+        //! Set the string to append to.
+        void set_target(
+                std::string* target) noexcept;
+
+    protected:
+
+        int overflow(
+                int c) override;
+
+        std::streamsize xsputn(
+                const char* s,
+                std::streamsize n) override;
+
+        //! String to append to.
+        std::string* target_ = nullptr;
+    };
+
+    //! Routine of the writer thread: write the buffers queued until stopped.
+    void thread_routine_() noexcept;
+
+    //! Write \c buffers in the file and rotate it if needed. Only called from the writer thread.
+    void write_buffers_(
+            const std::vector<std::string>& buffers) noexcept;
+
+    //! Rename the file and the rotated ones, remove the oldest one, and open a new file.
+    void rotate_() noexcept;
+
+    //! Open the file to append. Return false if it could not be opened.
+    bool open_file_() noexcept;
+
+    /**
+     * @brief Hand the current buffer to the writer, even if not full, and take a free one to continue.
+     *
+     * It does not check the size of the queue. It does nothing if the current buffer is empty.
+     *
+     * It must be guarded by \c mutex_ .
+     */
+    void queue_current_buffer_nts_();
+
+    //! Configuration of the file, the rotation and the buffers.
+    const FileLogConfiguration configuration_;
+
+    //! Buffer where entries are being formatted. Guarded by \c mutex_
+    std::string current_buffer_;
+
+    //! Buffers full, waiting to be written. Guarded by \c mutex_
+    std::vector<std::string> queued_buffers_;
+
+    //! Buffers already written, with their memory kept to be reused. Guarded by \c mutex_
+    std::vector<std::string> free_buffers_;
+
+    //! Stream to format entries in \c current_buffer_ . Guarded by \c mutex_
+    StringAppendBuffer format_buffer_;
+
+    //! Stream over \c format_buffer_ . Guarded by \c mutex_
+    std::ostream format_stream_;
+
+    //! Number of buffers queued so far. Guarded by \c mutex_
+    uint64_t buffers_queued_;
+
+    //! Number of buffers written so far. Guarded by \c mutex_
+    uint64_t buffers_written_;
+
+    //! Number of entries dropped.
+    std::atomic<uint64_t> dropped_entries_;
+
+    //! Whether the writer thread must stop. Guarded by \c mutex_
+    bool stop_;
+
+    //! Protects the buffers.
+    std::mutex mutex_;
+
+    //! Notifies the writer of buffers queued or of stop.
+    std::condition_variable writer_cv_;
+
+    //! Notifies the threads flushing of buffers written.
+    std::condition_variable written_cv_;
+
+    //! Descriptor of the file. Only used from the writer thread once it is started.
+    int fd_;
+
+    //! Size of the current file. Only used from the writer thread once it is started.
+    uint64_t file_size_;
+
+    //! Number of dropped entries already reported in the file. Only used from the writer thread.
+    uint64_t dropped_entries_reported_;
+
+    //! Writer thread.
+    std::thread thread_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,133 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file FlightRecorderFormat.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * Layout of the ring file written by \c FlightRecorderLogConsumer and read by \c FlightRecorderReader .
+ *
+ * The file is a \c FileHeader followed by the ring of \c FileHeader::ring_size bytes.
+ * Each record is a \c RecordHeader followed by timestamp, category, file name and message, without terminators,
+ * and it takes a multiple of \c RECORD_ALIGNMENT bytes. Records are written at increasing positions, that are
+ * wrapped into the ring, so a record (and its header) may continue at the beginning of the ring.
+ *
+ * The header of a record is committed writing \c RecordHeader::commit last, as its position xor \c RECORD_MARK .
+ * Memory never written, records not committed and bytes inside other records do not hold the commit of the
+ * position they are in, so the reader skips them and finds the next record checking every aligned position.
+ *
+ * Every number is written in the byte order of the machine.
+ */
+struct FlightRecorderFormat
+{
+    //! First bytes of a flight recorder file.
+    static constexpr const char* FILE_MAGIC = "CUFLIGHT";
+
+    //! Version of the format, written after \c FILE_MAGIC .
+    static constexpr uint32_t FILE_VERSION = 1;
+
+    //! Written after the version, to detect files written with a different byte order.
+    static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    //! Mixed with the position of a record to commit it.
+    static constexpr uint64_t RECORD_MARK = 0x9E3779B97F4A7C15ull;
+
+    //! Every record begins in a position multiple of this.
+    static constexpr std::size_t RECORD_ALIGNMENT = 8;
+
+    //! Header at the beginning of the file.
+    struct FileHeader
+    {
+        //! \c FILE_MAGIC , without terminator.
+        char magic[8];
+
+        //! \c FILE_VERSION .
+        uint32_t version;
+
+        //! \c BYTE_ORDER_MARK .
+        uint32_t byte_order_mark;
+
+        //! Size in bytes of the ring after this header. Multiple of \c RECORD_ALIGNMENT .
+        uint64_t ring_size;
+
+        //! Position after the last record reserved, that only grows. Updated atomically by the writers.
+        uint64_t head;
+
+        //! Not used yet.
+        uint64_t reserved[4];
+    };
+
+    //! Header of each record in the ring.
+    struct RecordHeader
+    {
+        //! Position of the record xor \c RECORD_MARK , once the record is completely written.
+        uint64_t commit;
+
+        //! Size in bytes of the record with this header, without the alignment padding.
+        uint32_t size;
+
+        //! Size of the message.
+        uint32_t message_size;
+
+        //! Line of the log call.
+        uint32_t line;
+
+        //! Size of the timestamp.
+        uint16_t timestamp_size;
+
+        //! Size of the category.
+        uint16_t category_size;
+
+        //! Size of the file name.
+        uint16_t file_size;
+
+        //! Kind of the entry.
+        uint8_t kind;
+
+        //! Not used yet.
+        uint8_t reserved_1;
+
+        //! Not used yet.
+        uint32_t reserved_2;
+    };
+
+    //! Size of the file header. The ring begins after it.
+    static constexpr std::size_t FILE_HEADER_SIZE = sizeof(FileHeader);
+
+    //! Size of the header of a record.
+    static constexpr std::size_t RECORD_HEADER_SIZE = sizeof(RecordHeader);
+
+    //! Round \c size up to a multiple of \c RECORD_ALIGNMENT .
+    static constexpr uint64_t align(
+            uint64_t size) noexcept
+    {
+        return (size + RECORD_ALIGNMENT - 1) / RECORD_ALIGNMENT * RECORD_ALIGNMENT;
+    }
+};
+
+static_assert(sizeof(FlightRecorderFormat::FileHeader) == 64, "Flight recorder file header must take 64 bytes");
+static_assert(sizeof(FlightRecorderFormat::RecordHeader) == 32, "Flight recorder record header must take 32 bytes");
+
+} /* namespace utils */
+} /* namespace eprosima */
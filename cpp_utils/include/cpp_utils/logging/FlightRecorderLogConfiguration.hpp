@@ -0,0 +1,71 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file FlightRecorderLogConfiguration.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/logging/BaseLogConfiguration.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * The collection of settings of a \c FlightRecorderLogConsumer .
+ *
+ * Besides the verbosity and the filter, they are the file of the ring and its size.
+ */
+struct FlightRecorderLogConfiguration : public BaseLogConfiguration
+{
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    //! Default FlightRecorderLogConfiguration constructor
+    CPP_UTILS_DllAPI
+    FlightRecorderLogConfiguration();
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    /**
+     * @brief \c is_valid method.
+     *
+     * The file path must not be empty, and the ring size must be a multiple of 8 of at least 4 KiB.
+     */
+    CPP_UTILS_DllAPI
+    virtual bool is_valid(
+            Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Path of the file mapped as ring.
+    std::string file_path;
+
+    //! Size in bytes of the ring. The oldest entries are overwritten once it is full.
+    uint64_t ring_size;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
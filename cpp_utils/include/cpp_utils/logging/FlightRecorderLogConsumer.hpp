@@ -0,0 +1,132 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file FlightRecorderLogConsumer.hpp
+ */
+
+#pragma once
+
+#if !defined(_WIN32)
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/logging/BaseLogConsumer.hpp>
+#include <cpp_utils/logging/FlightRecorderFormat.hpp>
+#include <cpp_utils/logging/FlightRecorderLogConfiguration.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * Log Consumer that writes the entries accepted by the \c BaseLogConsumer in a ring of fixed size, kept in a file
+ * mapped in memory, overwriting the oldest entries once the ring is full.
+ *
+ * \c Consume reserves the space of the entry moving the head of the ring with a single atomic operation, and copies
+ * the entry in it, without locks nor system calls. The pages mapped belong to the file, so the entries written
+ * survive the process if it crashes or it is killed, and \c FlightRecorderReader (or tool
+ * \c cpp_utils_log_decoder ) can dump them in order afterwards.
+ *
+ * If the file already holds a ring of the same size, the new entries are written after the ones in it.
+ * Otherwise it is replaced by an empty ring.
+ *
+ * The layout of the file is described in \c FlightRecorderFormat .
+ *
+ * @note Entries are only written to disk by the operating system, so they survive the process but not the machine,
+ * unless \c flush is called.
+ *
+ * @note Not available in Windows.
+ */
+class FlightRecorderLogConsumer : public BaseLogConsumer
+{
+public:
+
+    /**
+     * @brief Open the file and map its ring.
+     *
+     * @throw \c InitializationException if the configuration is not valid or the file could not be mapped.
+     */
+    CPP_UTILS_DllAPI
+    FlightRecorderLogConsumer(
+            const FlightRecorderLogConfiguration* log_configuration);
+
+    /**
+     * @brief Unmap the file. The entries remain in it.
+     */
+    CPP_UTILS_DllAPI
+    ~FlightRecorderLogConsumer();
+
+    /**
+     * @brief Implements the \c BaseLogConsumer \c Consume method.
+     *
+     * To be consumed, entries must be accepted by the \c BaseLogConsumer, so:
+     * - Their kind must be higher or equal than the verbosity level.
+     * - Their category or message must match the filter regex.
+     *
+     * The entry is copied in the ring. Its message is truncated if the entry takes more than a quarter of the ring.
+     * It can be called from several threads at the same time.
+     *
+     * @param entry entry to consume
+     */
+    CPP_UTILS_DllAPI
+    void Consume(
+            const Log::Entry& entry) override;
+
+    //! Write the ring to disk, and wait until it is written.
+    CPP_UTILS_DllAPI
+    void flush() noexcept;
+
+protected:
+
+    //! Copy \c size bytes of \c data in the ring from \c position , continuing at its beginning if needed.
+    void write_(
+            uint64_t position,
+            const void* data,
+            std::size_t size) noexcept;
+
+    //! Whether the file mapped holds a ring of the size configured, so it can be reused.
+    bool is_ring_reusable_() const noexcept;
+
+    //! Path of the file mapped.
+    std::string file_path_;
+
+    //! Size of the ring.
+    uint64_t ring_size_;
+
+    //! Memory of the whole file mapped.
+    char* mapped_;
+
+    //! Size of the whole file mapped.
+    std::size_t mapped_size_;
+
+    //! Header of the file, inside \c mapped_ .
+    FlightRecorderFormat::FileHeader* header_;
+
+    //! Head of the ring, in the file header.
+    std::atomic<uint64_t>* head_;
+
+    //! Beginning of the ring, inside \c mapped_ .
+    char* ring_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+#endif // if !defined(_WIN32)
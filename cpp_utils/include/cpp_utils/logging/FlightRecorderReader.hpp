@@ -0,0 +1,127 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file FlightRecorderReader.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/logging/BaseLogConfiguration.hpp>
+#include <cpp_utils/logging/FlightRecorderFormat.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Entry of a flight recorder ring, as written by \c FlightRecorderLogConsumer .
+ */
+struct FlightRecorderEntry
+{
+    //! Timestamp of the entry, as given by Fast DDS Log.
+    std::string timestamp;
+
+    //! Kind of the entry.
+    VerbosityKind kind;
+
+    //! Category of the entry.
+    std::string category;
+
+    //! Message of the entry. It may be truncated.
+    std::string message;
+
+    //! File of the log call.
+    std::string file_name;
+
+    //! Line of the log call.
+    uint32_t line;
+};
+
+/**
+ * Reader of the ring files written by \c FlightRecorderLogConsumer , that gives their entries from the oldest.
+ *
+ * The whole file is read when the reader is created, so it can be read while the ring is still being written.
+ * Entries being written, or not completely written because the process died, are skipped.
+ */
+class FlightRecorderReader
+{
+public:
+
+    /**
+     * @brief Read the ring in \c file_path .
+     *
+     * @throw \c InitializationException if the file could not be read or it is not a flight recorder ring
+     * written in a machine with the same byte order.
+     */
+    CPP_UTILS_DllAPI FlightRecorderReader(
+            const std::string& file_path);
+
+    /**
+     * @brief Read the next entry.
+     *
+     * @param [out] entry entry read.
+     *
+     * @return true if an entry has been read.
+     * @return false if there are no more entries.
+     */
+    CPP_UTILS_DllAPI bool next(
+            FlightRecorderEntry& entry);
+
+    //! Whether the file in \c file_path begins as a flight recorder ring.
+    CPP_UTILS_DllAPI static bool is_flight_recorder_file(
+            const std::string& file_path);
+
+protected:
+
+    //! Copy \c size bytes from \c position of the ring in \c data , continuing at its beginning if needed.
+    void read_(
+            uint64_t position,
+            void* data,
+            std::size_t size) const;
+
+    //! Copy \c size bytes from \c position of the ring in \c value .
+    void read_string_(
+            uint64_t position,
+            std::size_t size,
+            std::string& value) const;
+
+    //! Content of the ring.
+    std::vector<char> ring_;
+
+    //! Position of the next record to check.
+    uint64_t position_;
+
+    //! Position after the last record.
+    uint64_t head_;
+};
+
+/**
+ * @brief \c FlightRecorderEntry to stream serialization
+ *
+ * It is written as a text log line: timestamp, category, kind, message, file and line.
+ */
+CPP_UTILS_DllAPI std::ostream& operator <<(
+        std::ostream& os,
+        const FlightRecorderEntry& entry);
+
+} /* namespace utils */
+} /* namespace eprosima */
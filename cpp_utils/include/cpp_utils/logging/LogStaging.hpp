@@ -0,0 +1,104 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file LogStaging.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Use FastDDS log
+#include <fastdds/dds/log/Log.hpp>
+
+#include <cpp_utils/library/library_dll.h>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * Staging layer between the threads that log with the macros of \c Log.hpp and Fast DDS Log.
+ *
+ * Instead of calling \c Log::QueueLog , where every thread contends on the same queue lock, each thread appends
+ * its entries to a ring buffer of its own, with a single producer (the thread) and a single consumer
+ * (the collector thread), so appending an entry does not lock.
+ * The collector thread drains the buffers of every thread into Fast DDS Log, merging them by the time
+ * they were logged, so Fast DDS Log is only called from one thread.
+ *
+ * Entries of a thread keep their order. Entries of different threads are passed in the order they were logged,
+ * among those drained together, so the order is approximate.
+ *
+ * While staging is not started, entries are passed to Fast DDS Log right away from the thread that logs them.
+ * When the buffer of a thread is full, the thread waits until the collector thread has passed the entries in it,
+ * and then passes its entry to Fast DDS Log itself.
+ *
+ * @warning Only \c logDebug and \c logDevError stage their entries. \c logInfo , \c logWarning and \c logError
+ * are macros of Fast DDS, and they (as \c DeferredLog and any direct call to \c Log::QueueLog ) pass their entries
+ * to Fast DDS Log right away. So they may reach its consumers before entries staged earlier, even by the same
+ * thread. Use \c flush (instead of \c Log::Flush ) to wait for both.
+ */
+class LogStaging
+{
+public:
+
+    //! Default number of entries of the buffer of each thread.
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE = 1024;
+
+    /**
+     * @brief Start the collector thread, so entries are staged in buffers of \c buffer_size entries.
+     *
+     * If staging was already started, it is stopped first.
+     * Buffers already created keep their size.
+     *
+     * @param buffer_size number of entries of the buffer of each thread. At least 1.
+     */
+    CPP_UTILS_DllAPI static void start(
+            std::size_t buffer_size = DEFAULT_BUFFER_SIZE);
+
+    //! Pass every entry staged to Fast DDS Log and stop the collector thread.
+    CPP_UTILS_DllAPI static void stop();
+
+    /**
+     * @brief Wait until every entry staged so far is passed to Fast DDS Log, and flush Fast DDS Log.
+     *
+     * It can be called from any thread. Called from the collector thread (e.g. by a consumer of Fast DDS Log),
+     * it only flushes Fast DDS Log.
+     */
+    CPP_UTILS_DllAPI static void flush();
+
+    //! Whether the collector thread is running, so entries are staged.
+    CPP_UTILS_DllAPI static bool enabled() noexcept;
+
+    //! Number of entries passed to Fast DDS Log from the thread that logged them because its buffer was full.
+    CPP_UTILS_DllAPI static uint64_t overflow_entries() noexcept;
+
+    /**
+     * @brief Stage an entry in the buffer of this thread, to be passed to Fast DDS Log by the collector thread.
+     *
+     * @param message message of the entry. It is moved to the buffer.
+     * @param context file, line, function and category of the entry. They must be static strings.
+     * @param kind kind of the entry.
+     */
+    CPP_UTILS_DllAPI static void queue_log(
+            std::string&& message,
+            const eprosima::fastdds::dds::Log::Context& context,
+            eprosima::fastdds::dds::Log::Kind kind);
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,82 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file RateLimitLogConfiguration.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/library/library_dll.h>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * The collection of settings of a \c RateLimitLogConsumer :
+ *  - Rate and burst of entries of each call site
+ *  - Whether repeated messages are collapsed
+ *  - Size of the table of call sites
+ */
+struct RateLimitLogConfiguration
+{
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    //! Default RateLimitLogConfiguration constructor
+    CPP_UTILS_DllAPI
+    RateLimitLogConfiguration();
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    /**
+     * @brief \c is_valid method.
+     *
+     * Rate and burst must be higher than 0, and the table size must be a power of 2.
+     */
+    CPP_UTILS_DllAPI
+    bool is_valid(
+            Formatter& error_msg) const noexcept;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Entries per second passed on from each call site, once its burst is spent.
+    double entries_per_second;
+
+    //! Entries passed on at once from a call site that has not logged for a while.
+    uint32_t burst;
+
+    //! Whether consecutive entries of a call site with the same message are collapsed into a count.
+    bool suppress_duplicates;
+
+    /**
+     * @brief Number of call sites tracked. It must be a power of 2.
+     *
+     * Entries of call sites that do not fit in the table are passed on without limit.
+     */
+    uint32_t table_size;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
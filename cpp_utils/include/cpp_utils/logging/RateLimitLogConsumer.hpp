@@ -0,0 +1,150 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file RateLimitLogConsumer.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/logging/RateLimitLogConfiguration.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * Log Consumer that passes the entries it consumes on to another consumer (e.g. a \c StdLogConsumer ), limiting
+ * the entries of each call site, so a message logged in a loop does not flood the output.
+ *
+ * A call site is identified by the category, file and line of an entry. For each one:
+ * - Entries are limited with a token bucket: \c burst entries can be passed on at once, and then
+ *   \c entries_per_second .
+ * - Consecutive entries with the same message as the last one passed on are not passed on, but counted, for the
+ *   time between two entries of its rate since that message was passed on. After that, a repeat is passed on again.
+ *
+ * The entries held back are reported in a single entry (e.g. "Previous message repeated 3 times.") of the same
+ * call site, just before the next entry of that call site that is passed on, even if it repeats the message.
+ *
+ * The state of each call site is kept in a hash table of fixed size, that is accessed without locks,
+ * so this consumer can be called from several threads. Call sites that do not fit in the table are not limited.
+ */
+class RateLimitLogConsumer : public LogConsumer
+{
+public:
+
+    /**
+     * @brief Create a consumer that passes entries on to \c consumer .
+     *
+     * @param consumer consumer that receives the entries not held back.
+     * @param configuration rate, burst and table size.
+     *
+     * @throw \c InitializationException if the configuration is not valid or \c consumer is null.
+     */
+    CPP_UTILS_DllAPI
+    RateLimitLogConsumer(
+            std::unique_ptr<LogConsumer> consumer,
+            const RateLimitLogConfiguration& configuration = RateLimitLogConfiguration());
+
+    /**
+     * @brief Implements \c LogConsumer \c Consume method.
+     *
+     * The entry is passed on unless its call site has spent its tokens or it repeats the last message passed on
+     * less than the time between two entries ago.
+     *
+     * @param entry entry to consume
+     */
+    CPP_UTILS_DllAPI
+    void Consume(
+            const Log::Entry& entry) override;
+
+    //! Number of entries held back so far, by the rate limit or as repeated.
+    CPP_UTILS_DllAPI
+    uint64_t suppressed_entries() const noexcept;
+
+protected:
+
+    //! State of a call site in the table. Every field is updated atomically.
+    struct SiteState
+    {
+        //! Key of the call site. 0 if the position is free.
+        std::atomic<uint64_t> key{0};
+
+        //! Theoretical time of the next entry, in nanoseconds, for the token bucket (GCRA).
+        std::atomic<int64_t> next_entry_time{0};
+
+        //! Hash of the last message passed on.
+        std::atomic<uint64_t> last_message{0};
+
+        //! Time the last message was passed on, in nanoseconds.
+        std::atomic<int64_t> last_message_time{0};
+
+        //! Entries repeating the last message since it was passed on.
+        std::atomic<uint64_t> repeated{0};
+
+        //! Entries held back by the rate limit since the last entry passed on.
+        std::atomic<uint64_t> dropped{0};
+    };
+
+    //! Maximum number of consecutive positions checked to find a call site.
+    static constexpr uint32_t MAX_PROBES = 8;
+
+    //! Key of the call site of \c entry . Never 0.
+    static uint64_t site_key_(
+            const Log::Entry& entry) noexcept;
+
+    //! Find the state of the call site with key \c key , or take a free position for it. Null if the table is full.
+    SiteState* find_site_(
+            uint64_t key) noexcept;
+
+    //! Take a token of \c site at time \c now (in nanoseconds). Return false if there are none left.
+    bool take_token_(
+            SiteState& site,
+            int64_t now) const noexcept;
+
+    //! Pass on entries with the number of entries of \c site held back, if any, in the context of \c entry .
+    void report_suppressed_(
+            SiteState& site,
+            const Log::Entry& entry);
+
+    //! Consumer that receives the entries passed on.
+    std::unique_ptr<LogConsumer> consumer_;
+
+    //! Whether repeated messages are collapsed.
+    bool suppress_duplicates_;
+
+    //! Time between two entries of a call site once its burst is spent, in nanoseconds.
+    int64_t entry_interval_;
+
+    //! Time that a call site can be ahead of its rate, in nanoseconds: its burst.
+    int64_t burst_tolerance_;
+
+    //! Size of the table minus 1, to wrap positions.
+    uint64_t table_mask_;
+
+    //! Table of call sites.
+    std::unique_ptr<SiteState[]> table_;
+
+    //! Number of entries held back.
+    std::atomic<uint64_t> suppressed_entries_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
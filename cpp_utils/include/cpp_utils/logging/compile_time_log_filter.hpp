@@ -0,0 +1,181 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file compile_time_log_filter.hpp
+ *
+ * Log categories and levels removed from the binary at compile time.
+ *
+ * The lists are set with CMake options \c CPP_UTILS_LOG_DISABLED_CATEGORIES , \c CPP_UTILS_LOG_ENABLED_CATEGORIES
+ * and \c CPP_UTILS_LOG_COMPILED_VERBOSITY , or defining these macros before including any log header.
+ */
+
+#pragma once
+
+#include <type_traits>
+
+#include <fastdds/dds/log/Log.hpp>
+
+/**
+ * @brief Categories whose messages are compiled out, separated by commas (e.g. "UTILS_WAIT, LIMITLESS_POOL").
+ *
+ * Spaces around each name are ignored.
+ * A name ending in \c * matches every category starting with it (e.g. "UTILS_WAIT*").
+ */
+#ifndef CPP_UTILS_LOG_DISABLED_CATEGORIES
+#define CPP_UTILS_LOG_DISABLED_CATEGORIES ""
+#endif // ifndef CPP_UTILS_LOG_DISABLED_CATEGORIES
+
+/**
+ * @brief If not empty, only messages of these categories are compiled in. Same format as the disabled ones.
+ *
+ * A category both enabled and disabled is compiled out.
+ */
+#ifndef CPP_UTILS_LOG_ENABLED_CATEGORIES
+#define CPP_UTILS_LOG_ENABLED_CATEGORIES ""
+#endif // ifndef CPP_UTILS_LOG_ENABLED_CATEGORIES
+
+//! Maximum kind of the messages compiled in: 0 (Error), 1 (Warning) or 2 (Info).
+#ifndef CPP_UTILS_LOG_COMPILED_VERBOSITY
+#define CPP_UTILS_LOG_COMPILED_VERBOSITY 2
+#endif // ifndef CPP_UTILS_LOG_COMPILED_VERBOSITY
+
+//! Whether messages of kind \c kind of category \c cat are compiled in, as a constant expression.
+#define CPP_UTILS_IS_LOG_COMPILED(cat, kind) \
+    std::integral_constant<bool, eprosima::utils::is_log_compiled(#cat, kind)>::value
+
+/**
+ * @brief Whether messages of kind \c kind of category \c cat are compiled in, as \c std::true_type or
+ * \c std::false_type , to select the overload of \c log_if_compiled .
+ */
+#define CPP_UTILS_LOG_COMPILED_TAG(cat, kind) \
+    std::integral_constant<bool, eprosima::utils::is_log_compiled(#cat, kind)>()
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Whether \c category matches the name in [name, name_end).
+ *
+ * A \c * as the last character of the name matches every category starting with the rest of the name.
+ * Anywhere else it is a regular character.
+ */
+constexpr bool category_matches(
+        const char* category,
+        const char* name,
+        const char* name_end) noexcept
+{
+    while (name != name_end)
+    {
+        if (*name == '*' && name + 1 == name_end)
+        {
+            return true;
+        }
+        if (*category != *name)
+        {
+            return false;
+        }
+        ++category;
+        ++name;
+    }
+    return *category == '\0';
+}
+
+/**
+ * @brief Whether \c category is in \c list , a list of names separated by commas.
+ *
+ * Spaces around each name are ignored, and empty names match no category.
+ * A name ending in \c * matches every category starting with the rest of the name.
+ */
+constexpr bool category_in_list(
+        const char* category,
+        const char* list) noexcept
+{
+    while (true)
+    {
+        // Next name of the list, without the spaces around it
+        const char* name = list;
+        while (*list != '\0' && *list != ',')
+        {
+            ++list;
+        }
+        const char* name_end = list;
+        while (name != name_end && *name == ' ')
+        {
+            ++name;
+        }
+        while (name_end != name && *(name_end - 1) == ' ')
+        {
+            --name_end;
+        }
+
+        if (name != name_end && category_matches(category, name, name_end))
+        {
+            return true;
+        }
+
+        if (*list == '\0')
+        {
+            return false;
+        }
+        ++list;
+    }
+}
+
+/**
+ * @brief Whether messages of kind \c kind of category \c category are compiled in.
+ *
+ * It is evaluated at compile time by the log macros, with the lists in \c CPP_UTILS_LOG_DISABLED_CATEGORIES
+ * and \c CPP_UTILS_LOG_ENABLED_CATEGORIES and the level in \c CPP_UTILS_LOG_COMPILED_VERBOSITY .
+ */
+constexpr bool is_log_compiled(
+        const char* category,
+        eprosima::fastdds::dds::Log::Kind kind) noexcept
+{
+    return static_cast<int>(kind) <= CPP_UTILS_LOG_COMPILED_VERBOSITY &&
+           !category_in_list(category, CPP_UTILS_LOG_DISABLED_CATEGORIES) &&
+           (CPP_UTILS_LOG_ENABLED_CATEGORIES[0] == '\0' ||
+           category_in_list(category, CPP_UTILS_LOG_ENABLED_CATEGORIES));
+}
+
+/**
+ * @brief Call \c body with \c function , as the message is compiled in.
+ *
+ * Log macros pass their body as a generic lambda, which is a template, and select the overload with
+ * \c CPP_UTILS_LOG_COMPILED_TAG . So the body of a message compiled out is never instantiated, whatever the
+ * optimization level: its category is not registered, it defines no static data, generates no formatting code
+ * and its arguments are never evaluated. Only the call to the empty overload is left.
+ *
+ * @param function name of the function that logs, as \c __func__ in the body would be the name of the lambda.
+ */
+template <typename Body>
+inline void log_if_compiled(
+        std::true_type,
+        const char* function,
+        Body&& body)
+{
+    body(function);
+}
+
+//! Do nothing, as the message is compiled out, so \c body is not instantiated.
+template <typename Body>
+inline void log_if_compiled(
+        std::false_type,
+        const char*,
+        Body&&) noexcept
+{
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,149 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BinaryLog.ipp
+ */
+
+#pragma once
+
+namespace eprosima {
+namespace utils {
+
+template <typename ... Args>
+BinaryLogSiteId BinaryLog::register_site(
+        VerbosityKind kind,
+        const char* category,
+        const char* file,
+        uint32_t line,
+        const char* format,
+        const Args&... /* args */)
+{
+    return register_site_({kind, category, file, line, format});
+}
+
+template <typename ... Args>
+void BinaryLog::write(
+        BinaryLogSiteId site,
+        const char* /* format */,
+        const Args&... args)
+{
+    BinaryLogBuffer& buffer = thread_buffer_();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+
+    const std::size_t begin = begin_record_(buffer, site);
+    encode_(buffer, args...);
+    end_record_(buffer, begin);
+}
+
+inline void BinaryLog::encode_(
+        BinaryLogBuffer& /* buffer */)
+{
+}
+
+template <typename T, typename ... Args>
+void BinaryLog::encode_(
+        BinaryLogBuffer& buffer,
+        const T& arg,
+        const Args&... args)
+{
+    encode_argument_(buffer, arg);
+    encode_(buffer, args...);
+}
+
+inline void BinaryLog::encode_argument_(
+        BinaryLogBuffer& buffer,
+        bool arg)
+{
+    const char data[2] = {static_cast<char>(BinaryLogArgumentType::boolean), static_cast<char>(arg ? 1 : 0)};
+    buffer.append(data, sizeof(data));
+}
+
+inline void BinaryLog::encode_argument_(
+        BinaryLogBuffer& buffer,
+        char arg)
+{
+    const char data[2] = {static_cast<char>(BinaryLogArgumentType::character), arg};
+    buffer.append(data, sizeof(data));
+}
+
+inline void BinaryLog::encode_argument_(
+        BinaryLogBuffer& buffer,
+        const char* arg)
+{
+    if (arg == nullptr)
+    {
+        arg = "";
+    }
+    encode_string_(buffer, arg, std::strlen(arg));
+}
+
+inline void BinaryLog::encode_argument_(
+        BinaryLogBuffer& buffer,
+        const std::string& arg)
+{
+    encode_string_(buffer, arg.data(), arg.size());
+}
+
+template <typename T>
+typename std::enable_if<std::is_arithmetic<T>::value>::type BinaryLog::encode_argument_(
+        BinaryLogBuffer& buffer,
+        const T& arg)
+{
+    char data[1 + sizeof(uint64_t)];
+
+    if (std::is_floating_point<T>::value)
+    {
+        const double value = static_cast<double>(arg);
+        data[0] = static_cast<char>(BinaryLogArgumentType::floating_point);
+        std::memcpy(data + 1, &value, sizeof(value));
+    }
+    else if (std::is_signed<T>::value)
+    {
+        const int64_t value = static_cast<int64_t>(arg);
+        data[0] = static_cast<char>(BinaryLogArgumentType::signed_integer);
+        std::memcpy(data + 1, &value, sizeof(value));
+    }
+    else
+    {
+        const uint64_t value = static_cast<uint64_t>(arg);
+        data[0] = static_cast<char>(BinaryLogArgumentType::unsigned_integer);
+        std::memcpy(data + 1, &value, sizeof(value));
+    }
+
+    buffer.append(data, sizeof(data));
+}
+
+template <typename T>
+typename std::enable_if<std::is_enum<T>::value>::type BinaryLog::encode_argument_(
+        BinaryLogBuffer& buffer,
+        const T& arg)
+{
+    encode_argument_(buffer, static_cast<int64_t>(arg));
+}
+
+inline void BinaryLog::encode_string_(
+        BinaryLogBuffer& buffer,
+        const char* data,
+        std::size_t size)
+{
+    const char type = static_cast<char>(BinaryLogArgumentType::string);
+    const uint32_t string_size = static_cast<uint32_t>(size);
+    buffer.append(&type, sizeof(type));
+    buffer.append(&string_size, sizeof(string_size));
+    buffer.append(data, size);
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
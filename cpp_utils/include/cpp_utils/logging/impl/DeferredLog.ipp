@@ -0,0 +1,192 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file DeferredLog.ipp
+ */
+
+#pragma once
+
+#include <cstring>
+#include <new>
+
+#include <cpp_utils/Formatter.hpp>
+
+namespace eprosima {
+namespace utils {
+
+template <typename ... Args>
+void DeferredLog::write(
+        const std::atomic<CategoryVerbosityRegistry::Kind>& category_verbosity,
+        VerbosityKind kind,
+        const Log::Context& context,
+        const char* format,
+        const Args&... args)
+{
+    using Arguments = std::tuple<typename Stored<Args>::type...>;
+
+    // Arguments that do not fit in an entry are never deferred
+    if (sizeof(Arguments) > DeferredLogEntry::ARGUMENTS_CAPACITY ||
+            alignof(Arguments) > alignof(std::max_align_t) ||
+            !enabled())
+    {
+        write_now_(kind, context, format, args...);
+        return;
+    }
+
+    uint64_t ticket;
+    DeferredLogEntry* entry = begin_entry_(ticket);
+    if (entry == nullptr)
+    {
+        return;
+    }
+
+    entry->category_verbosity = &category_verbosity;
+    entry->kind = kind;
+    entry->context = context;
+    entry->format = format;
+    entry->format_function = &format_entry_<Arguments>;
+    entry->destroy_function = &destroy_entry_<Arguments>;
+    entry->arguments_size = sizeof(Arguments);
+    entry->overflow = false;
+
+    // Texts are copied after the tuple, while its elements are captured
+    try
+    {
+        new (entry->arguments) Arguments(capture_argument_(*entry, args)...);
+    }
+    catch (...)
+    {
+        // The slot is given up, so the log thread does not wait for it
+        end_entry_(ticket, true);
+        throw;
+    }
+
+    if (entry->overflow)
+    {
+        destroy_entry_<Arguments>(*entry);
+        end_entry_(ticket, true);
+        write_now_(kind, context, format, args...);
+        return;
+    }
+
+    end_entry_(ticket, false);
+}
+
+template <typename ... Args>
+void DeferredLog::write_now_(
+        VerbosityKind kind,
+        const Log::Context& context,
+        const char* format,
+        const Args&... args)
+{
+    std::string message;
+    format_arguments_<0>(std::forward_as_tuple(args...), nullptr, format, message);
+    Log::QueueLog(message, context, kind);
+}
+
+inline DeferredLogString DeferredLog::capture_argument_(
+        DeferredLogEntry& entry,
+        char* arg)
+{
+    return capture_argument_(entry, static_cast<const char*>(arg));
+}
+
+template <typename T>
+const T& DeferredLog::capture_argument_(
+        DeferredLogEntry& /* entry */,
+        const T& arg)
+{
+    return arg;
+}
+
+template <typename Arguments>
+void DeferredLog::format_entry_(
+        const DeferredLogEntry& entry,
+        std::string& message)
+{
+    const Arguments& arguments = *reinterpret_cast<const Arguments*>(entry.arguments);
+    format_arguments_<0>(arguments, entry.arguments, entry.format, message);
+}
+
+template <typename Arguments>
+void DeferredLog::destroy_entry_(
+        DeferredLogEntry& entry)
+{
+    reinterpret_cast<Arguments*>(entry.arguments)->~Arguments();
+}
+
+template <std::size_t I, typename Arguments>
+typename std::enable_if<(I < std::tuple_size<Arguments>::value)>::type DeferredLog::format_arguments_(
+        const Arguments& arguments,
+        const char* buffer,
+        const char* format,
+        std::string& message)
+{
+    const char* placeholder = std::strstr(format, "{}");
+    if (placeholder == nullptr)
+    {
+        message.append(format);
+        append_arguments_<I>(arguments, buffer, message);
+        return;
+    }
+
+    message.append(format, placeholder - format);
+    append_argument_(std::get<I>(arguments), buffer, message);
+    format_arguments_<I + 1>(arguments, buffer, placeholder + 2, message);
+}
+
+template <std::size_t I, typename Arguments>
+typename std::enable_if<(I == std::tuple_size<Arguments>::value)>::type DeferredLog::format_arguments_(
+        const Arguments& /* arguments */,
+        const char* /* buffer */,
+        const char* format,
+        std::string& message)
+{
+    message.append(format);
+}
+
+template <std::size_t I, typename Arguments>
+typename std::enable_if<(I < std::tuple_size<Arguments>::value)>::type DeferredLog::append_arguments_(
+        const Arguments& arguments,
+        const char* buffer,
+        std::string& message)
+{
+    message += ' ';
+    append_argument_(std::get<I>(arguments), buffer, message);
+    append_arguments_<I + 1>(arguments, buffer, message);
+}
+
+template <std::size_t I, typename Arguments>
+typename std::enable_if<(I == std::tuple_size<Arguments>::value)>::type DeferredLog::append_arguments_(
+        const Arguments& /* arguments */,
+        const char* /* buffer */,
+        std::string& /* message */)
+{
+}
+
+template <typename T>
+void DeferredLog::append_argument_(
+        const T& arg,
+        const char* /* buffer */,
+        std::string& message)
+{
+    Formatter formatter;
+    formatter << arg;
+    message.append(formatter.data(), formatter.size());
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
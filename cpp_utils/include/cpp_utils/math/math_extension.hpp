@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <stdint.h>
 
 #include <cpp_utils/library/library_dll.h>
@@ -134,5 +135,22 @@ CPP_UTILS_DllAPI unsigned int fast_exponential(
         unsigned int base,
         unsigned int exponent) noexcept;
 
+/**
+ * @brief Calculate a fast non cryptographic 64 bit hash of a memory block.
+ *
+ * It implements the XXH64 algorithm, that processes 32 bytes per iteration. In little endian platforms
+ * the result is the one of any other XXH64 implementation.
+ *
+ * @param data memory block to hash. It may be \c nullptr if \c size is 0.
+ * @param size number of bytes of \c data
+ * @param seed initial value of the hash
+ *
+ * @return hash of \c data
+ */
+CPP_UTILS_DllAPI uint64_t hash_64(
+        const void* data,
+        std::size_t size,
+        uint64_t seed = 0) noexcept;
+
 } /* namespace utils */
 } /* namespace eprosima */
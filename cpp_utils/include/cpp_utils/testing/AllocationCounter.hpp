@@ -0,0 +1,67 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AllocationCounter.hpp
+ *
+ * This file contains the counter of the allocations done by each thread.
+ *
+ * @note This header does not count anything by itself: the executable must be linked with a replacement of the global
+ * \c operator \c new that increments \c thread_allocations (as the tests do with \c AllocationCounterOperators.cpp ).
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace eprosima {
+namespace utils {
+namespace testing {
+
+//! Number of allocations done by the current thread with the global \c operator \c new and \c operator \c new[] .
+inline std::size_t& thread_allocations() noexcept
+{
+    static thread_local std::size_t allocations = 0;
+    return allocations;
+}
+
+/**
+ * @brief This is an auxiliary class to count the allocations done in a test.
+ *
+ * It counts the allocations done by the thread that creates it while it exists.
+ */
+class AllocationCounter
+{
+public:
+
+    AllocationCounter() noexcept
+        : initial_(thread_allocations())
+    {
+    }
+
+    //! Number of allocations done by this thread since this object was created.
+    std::size_t count() const noexcept
+    {
+        return thread_allocations() - initial_;
+    }
+
+protected:
+
+    //! Allocations done by this thread before this object was created.
+    std::size_t initial_;
+};
+
+} /* namespace testing */
+} /* namespace utils */
+} /* namespace eprosima */
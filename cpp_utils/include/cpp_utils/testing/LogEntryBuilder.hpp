@@ -0,0 +1,115 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LogEntryBuilder.hpp
+ */
+
+#pragma once
+
+#include <string>
+
+#include <cpp_utils/Log.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace testing {
+
+/**
+ * @brief This is an auxiliary class to create the log entries given directly to consumers in tests.
+ *
+ * It starts an Info entry with no location, category nor timestamp, and each method sets one field:
+ *
+ * \code
+ * consumer.Consume(LogEntryBuilder("Connection lost.").kind(Log::Kind::Warning).at(__FILE__, __LINE__));
+ * \endcode
+ *
+ * Consumers that use the location of the entry (e.g. to tell log calls apart) must be given the line of the call site.
+ * The builder converts to the entry it holds, so it can be passed wherever a \c Log::Entry is expected.
+ */
+class LogEntryBuilder
+{
+public:
+
+    //! Start an Info entry with \c message .
+    LogEntryBuilder(
+            const std::string& message = "")
+    {
+        entry_.message = message;
+        entry_.context.filename = "";
+        entry_.context.line = 0;
+        entry_.context.function = "";
+        entry_.context.category = "";
+        entry_.kind = Log::Kind::Info;
+    }
+
+    //! Set the message of the entry.
+    LogEntryBuilder& message(
+            const std::string& message)
+    {
+        entry_.message = message;
+        return *this;
+    }
+
+    //! Set the kind of the entry.
+    LogEntryBuilder& kind(
+            Log::Kind kind)
+    {
+        entry_.kind = kind;
+        return *this;
+    }
+
+    //! Set the category of the entry. It must outlive the entry.
+    LogEntryBuilder& category(
+            const char* category)
+    {
+        entry_.context.category = category;
+        return *this;
+    }
+
+    //! Set the location of the log call of the entry. \c filename and \c function must outlive the entry.
+    LogEntryBuilder& at(
+            const char* filename,
+            int line,
+            const char* function = "")
+    {
+        entry_.context.filename = filename;
+        entry_.context.line = line;
+        entry_.context.function = function;
+        return *this;
+    }
+
+    //! Set the timestamp of the entry.
+    LogEntryBuilder& timestamp(
+            const std::string& timestamp)
+    {
+        entry_.timestamp = timestamp;
+        return *this;
+    }
+
+    //! Entry built.
+    operator const Log::Entry& () const
+    {
+        return entry_;
+    }
+
+protected:
+
+    //! Entry being built.
+    Log::Entry entry_;
+};
+
+} /* namespace testing */
+} /* namespace utils */
+} /* namespace eprosima */
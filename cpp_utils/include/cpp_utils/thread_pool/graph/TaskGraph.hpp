@@ -0,0 +1,220 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TaskGraph.hpp
+ *
+ * This file contains class TaskGraph definition.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
+#include <cpp_utils/thread_pool/task/Task.hpp>
+#include <cpp_utils/thread_pool/task/TaskId.hpp>
+
+namespace eprosima {
+namespace utils {
+
+//! Type of the index of a task inside a \c TaskGraph .
+using TaskNodeId = std::size_t;
+
+/**
+ * This class represents a directed acyclic graph of tasks executed by a \c SlotThreadPool .
+ *
+ * Each node of the graph is a \c Task , and each edge is a dependency: a task is not executed until every task it
+ * depends on has finished. Tasks whose dependencies are fulfilled are emitted to the pool as soon as possible,
+ * so independent branches of the graph are executed in parallel.
+ *
+ * Each node keeps an atomic counter of predecessors not finished yet. When a task finishes, it decrements the
+ * counter of each of its successors, and the one that reaches 0 emits the successor.
+ *
+ * The graph is built once and can be executed as many times as required with \c run .
+ * Each node is registered as a slot in the pool the first time the graph runs after adding it.
+ *
+ * @note Tasks must not be added nor connected while the graph is running.
+ */
+class TaskGraph
+{
+public:
+
+    /**
+     * @brief Construct an empty Task Graph that runs in \c thread_pool .
+     *
+     * @param thread_pool pool where tasks are executed. It must be enabled to run the graph and must outlive this.
+     */
+    CPP_UTILS_DllAPI TaskGraph(
+            SlotThreadPool& thread_pool);
+
+    /**
+     * @brief Destroy the Task Graph, removing its slots from the pool.
+     *
+     * @pre The graph must not be running.
+     */
+    CPP_UTILS_DllAPI ~TaskGraph();
+
+    /**
+     * @brief Add a new task to the graph.
+     *
+     * @param task task to execute in each run.
+     * @return id of the node that identifies this task in the graph.
+     *
+     * @throw \c PreconditionNotMet if the graph is running.
+     */
+    CPP_UTILS_DllAPI TaskNodeId add_task(
+            Task&& task);
+
+    /**
+     * @brief Make task \c successor depend on task \c predecessor .
+     *
+     * @param predecessor task that must finish before \c successor starts.
+     * @param successor task that waits for \c predecessor .
+     *
+     * @throw \c PreconditionNotMet if the graph is running.
+     * @throw \c ValueNotAllowedException if any of the ids does not belong to this graph or they are the same.
+     */
+    CPP_UTILS_DllAPI void add_dependency(
+            TaskNodeId predecessor,
+            TaskNodeId successor);
+
+    /**
+     * @brief Execute every task of the graph respecting its dependencies and wait for all of them to finish.
+     *
+     * If a task throws an exception, the tasks not started yet are skipped, and the first exception is rethrown
+     * once every running task has finished. The same happens if a task cannot be emitted to the pool.
+     *
+     * @warning The pool must not be disabled while the graph runs: the tasks emitted and not started yet would
+     * never be executed, so this method would never return.
+     *
+     * @throw \c PreconditionNotMet if the graph is already running, it has a cycle or the pool is not enabled.
+     * @throw any exception thrown by a task.
+     */
+    CPP_UTILS_DllAPI void run();
+
+    //! Number of tasks in the graph.
+    CPP_UTILS_DllAPI std::size_t size() const noexcept;
+
+protected:
+
+    //! Node of the graph.
+    struct TaskNode
+    {
+        //! Task to execute.
+        Task task;
+
+        //! Nodes that depend on this one.
+        std::vector<TaskNodeId> successors;
+
+        //! Number of nodes this one depends on.
+        unsigned int predecessors {0};
+
+        //! Number of predecessors not finished in the current run.
+        std::atomic<unsigned int> pending_predecessors {0};
+
+        //! Id of the slot of this node in the pool.
+        TaskId task_id {0};
+
+        //! Whether this node has already been registered as a slot in the pool.
+        bool registered {false};
+    };
+
+    /**
+     * @brief Check that the graph is acyclic and register in the pool the nodes not registered yet.
+     *
+     * @throw \c PreconditionNotMet if the graph has a cycle.
+     */
+    void prepare_();
+
+    /**
+     * @brief Routine of each node slot.
+     *
+     * Execute the task of the node (unless the run has failed), release its successors and
+     * notify the end of the run if it is the last node.
+     */
+    void execute_node_(
+            TaskNode& node) noexcept;
+
+    /**
+     * @brief Emit the slot of \c node to the pool.
+     *
+     * If it cannot be emitted, the run fails with the exception thrown and \c node is traversed in this thread,
+     * without executing its task, so the nodes that depend on it are released and the run finishes.
+     */
+    void emit_node_(
+            TaskNode& node) noexcept;
+
+    //! Make the current run fail with \c exception , unless it has already failed.
+    void fail_(
+            std::exception_ptr exception) noexcept;
+
+    //! Throw \c PreconditionNotMet if the graph is running.
+    void check_not_running_() const;
+
+    //! Pool where tasks are emitted.
+    SlotThreadPool& thread_pool_;
+
+    /**
+     * @brief Nodes of the graph, indexed by their \c TaskNodeId .
+     *
+     * A deque is used so nodes are not moved when new ones are added, as their slots reference them.
+     */
+    std::deque<TaskNode> nodes_;
+
+    //! Nodes without predecessors, computed in \c prepare_ .
+    std::vector<TaskNodeId> roots_;
+
+    //! Whether the graph has changed since last \c prepare_ .
+    bool modified_;
+
+    //! Whether the graph is running.
+    std::atomic<bool> running_;
+
+    //! Number of nodes not finished in the current run.
+    std::atomic<std::size_t> nodes_remaining_;
+
+    //! Whether any task has thrown in the current run.
+    std::atomic<bool> failed_;
+
+    /**
+     * @brief First exception thrown in the current run.
+     *
+     * Guarded by \c finished_mutex_
+     */
+    std::exception_ptr exception_;
+
+    /**
+     * @brief Whether every node of the current run has finished.
+     *
+     * Guarded by \c finished_mutex_
+     */
+    bool finished_;
+
+    //! Protects \c finished_ and \c exception_ .
+    std::mutex finished_mutex_;
+
+    //! Notified when the last node of the run finishes.
+    std::condition_variable finished_cv_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
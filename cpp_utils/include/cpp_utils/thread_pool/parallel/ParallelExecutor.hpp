@@ -0,0 +1,226 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ParallelExecutor.hpp
+ *
+ * This file contains class ParallelExecutor definition.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
+#include <cpp_utils/thread_pool/task/TaskId.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Description of a chunked job being executed by a \c ParallelExecutor .
+ *
+ * A job is a range of chunks [0, n_chunks) and a function to execute each of them.
+ * Every participant (the calling thread and the pool threads that help) takes the next chunk available from
+ * \c next_chunk until there are no more, so faster participants naturally take more chunks.
+ *
+ * The job lives in the stack of the thread that calls \c ParallelExecutor::run , and the function is referenced
+ * by a raw pointer and a plain function pointer, so executing a job does not require any heap allocation.
+ */
+struct ParallelJob
+{
+    //! Construct a job of \c n_chunks chunks that executes \c invoke over \c context for each chunk.
+    CPP_UTILS_DllAPI ParallelJob(
+            std::size_t n_chunks,
+            void (* invoke)(void*, std::size_t),
+            void* context) noexcept;
+
+    //! Number of chunks of this job.
+    const std::size_t n_chunks;
+
+    //! Next chunk to be taken by any participant.
+    std::atomic<std::size_t> next_chunk;
+
+    //! Function that executes chunk \c i over \c context .
+    void (* const invoke)(void*, std::size_t);
+
+    //! Function object that \c invoke casts and calls.
+    void* const context;
+
+    /**
+     * @brief Number of pool threads currently executing chunks of this job.
+     *
+     * Guarded by \c ParallelJobQueue::mutex_
+     */
+    unsigned int helpers_active;
+
+    /**
+     * @brief First exception thrown by any chunk, rethrown in the calling thread.
+     *
+     * Guarded by \c ParallelJobQueue::mutex_
+     */
+    std::exception_ptr exception;
+
+    /**
+     * @brief Next job in the \c ParallelJobQueue .
+     *
+     * Guarded by \c ParallelJobQueue::mutex_
+     */
+    ParallelJob* next;
+};
+
+/**
+ * @brief Queue of jobs currently running that pool threads can help with.
+ *
+ * This object is shared between the \c ParallelExecutor and the task registered in the \c SlotThreadPool ,
+ * so tasks emitted but executed after the executor has been destroyed find an empty queue and do nothing.
+ */
+class ParallelJobQueue
+{
+public:
+
+    //! Make \c job available for helpers.
+    CPP_UTILS_DllAPI void push(
+            ParallelJob& job) noexcept;
+
+    /**
+     * @brief Remove \c job from the queue and wait until every helper has left it.
+     *
+     * After this method returns, no other thread references \c job , so it can be destroyed.
+     */
+    CPP_UTILS_DllAPI void remove_and_wait(
+            ParallelJob& job) noexcept;
+
+    /**
+     * @brief Join the oldest job in the queue with chunks left (if any) and execute chunks until it has no more.
+     *
+     * This is the routine executed by the pool threads.
+     */
+    CPP_UTILS_DllAPI void help() noexcept;
+
+    /**
+     * @brief Execute chunks of \c job until it has no more.
+     *
+     * If a chunk throws, the exception is stored in the job and the rest of chunks are skipped.
+     */
+    CPP_UTILS_DllAPI void execute_chunks(
+            ParallelJob& job) noexcept;
+
+protected:
+
+    /**
+     * @brief Oldest job in the queue.
+     *
+     * Guarded by \c mutex_
+     */
+    ParallelJob* head_ {nullptr};
+
+    //! Protects the list of jobs and the helpers counters of each of them.
+    std::mutex mutex_;
+
+    //! Notified every time a helper leaves a job.
+    std::condition_variable helper_left_cv_;
+};
+
+/**
+ * This class executes chunked jobs in parallel using the threads of a \c SlotThreadPool .
+ *
+ * The calling thread always takes part in the execution of its own job, so a job always progresses even if
+ * every thread in the pool is busy (or the pool is disabled), and jobs can be nested inside pool tasks.
+ *
+ * Chunks are distributed dynamically: each participant takes the next free chunk when it finishes the previous one,
+ * which balances the work when chunks have different costs.
+ *
+ * A single slot is registered in the pool at construction. Each call to \c run emits this slot as many times as
+ * helpers are useful for the job, so no tasks are allocated while running.
+ *
+ * This class is the back-end of the algorithms in \c parallel_algorithms.hpp .
+ */
+class ParallelExecutor
+{
+public:
+
+    /**
+     * @brief Construct a new Parallel Executor that runs jobs in \c thread_pool .
+     *
+     * @param thread_pool pool where helper tasks are emitted. It must outlive this object.
+     *
+     * @throw \c ValueNotAllowedException if the task id taken for the slot is already registered in the pool.
+     */
+    CPP_UTILS_DllAPI ParallelExecutor(
+            SlotThreadPool& thread_pool);
+
+    //! Destroy the Parallel Executor, removing its slot from the pool.
+    CPP_UTILS_DllAPI ~ParallelExecutor();
+
+    /**
+     * @brief Execute \c function(i) for every chunk i in [0, n_chunks) and wait for all of them to finish.
+     *
+     * Chunks are executed concurrently by the calling thread and the pool threads.
+     *
+     * @param n_chunks number of chunks of the job.
+     * @param function function object callable with a \c std::size_t chunk index.
+     *
+     * @throw any exception thrown by \c function . In such case, chunks not started yet are not executed.
+     */
+    template <typename Function>
+    void run(
+            std::size_t n_chunks,
+            Function& function);
+
+    //! Maximum number of threads that can execute a job at the same time (pool threads + calling thread).
+    CPP_UTILS_DllAPI unsigned int concurrency() const noexcept;
+
+protected:
+
+    //! Call \c Function object pointed by \c context with chunk \c i .
+    template <typename Function>
+    static void invoke_(
+            void* context,
+            std::size_t i);
+
+    /**
+     * @brief Push \c job in the queue and emit helper tasks for it.
+     *
+     * If emitting a helper throws, \c job is removed from the queue once the helpers already in it have left,
+     * so no helper references it after it is destroyed, and the exception is rethrown.
+     */
+    CPP_UTILS_DllAPI void start_(
+            ParallelJob& job);
+
+    //! Remove \c job from the queue, wait for its helpers and rethrow its exception if any.
+    CPP_UTILS_DllAPI void finish_(
+            ParallelJob& job);
+
+    //! Pool where the helper slot is registered.
+    SlotThreadPool& thread_pool_;
+
+    //! Id of the slot registered in \c thread_pool_ .
+    TaskId task_id_;
+
+    //! Jobs running, shared with the slot registered in \c thread_pool_ .
+    std::shared_ptr<ParallelJobQueue> jobs_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/thread_pool/parallel/impl/ParallelExecutor.ipp>
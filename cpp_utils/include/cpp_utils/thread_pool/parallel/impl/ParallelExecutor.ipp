@@ -0,0 +1,51 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ParallelExecutor.ipp
+ */
+
+#pragma once
+
+namespace eprosima {
+namespace utils {
+
+template <typename Function>
+void ParallelExecutor::run(
+        std::size_t n_chunks,
+        Function& function)
+{
+    if (n_chunks == 0)
+    {
+        return;
+    }
+
+    // The job (and the function it references) lives in this stack until every helper has left it
+    ParallelJob job(n_chunks, &ParallelExecutor::invoke_<Function>, &function);
+
+    start_(job);
+    jobs_->execute_chunks(job);
+    finish_(job);
+}
+
+template <typename Function>
+void ParallelExecutor::invoke_(
+        void* context,
+        std::size_t i)
+{
+    (*static_cast<Function*>(context))(i);
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,269 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file parallel_algorithms.ipp
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace utils {
+namespace detail {
+
+/**
+ * @brief Number of elements per chunk used when the user sets a grain of 0.
+ *
+ * It creates around 8 chunks per participant, which leaves room to balance the work without making chunks so small
+ * that taking them costs more than executing them.
+ */
+inline std::size_t automatic_grain(
+        const ParallelExecutor& executor,
+        std::size_t size) noexcept
+{
+    const std::size_t target_chunks = 8 * static_cast<std::size_t>(executor.concurrency());
+    return std::max<std::size_t>(1, (size + target_chunks - 1) / target_chunks);
+}
+
+//! Number of chunks of \c grain elements required to cover \c size elements.
+inline std::size_t number_of_chunks(
+        std::size_t size,
+        std::size_t grain) noexcept
+{
+    return (size + grain - 1) / grain;
+}
+
+/**
+ * @brief Merge every pair of consecutive sorted runs of \c run elements from \c source into \c destination .
+ *
+ * Each pair is merged in parallel with the others. The last run could be shorter or have no pair.
+ */
+template <typename SourceIt, typename DestinationIt, typename Compare>
+void merge_runs(
+        ParallelExecutor& executor,
+        SourceIt source,
+        DestinationIt destination,
+        std::size_t size,
+        std::size_t run,
+        Compare& comp)
+{
+    parallel_for(
+        executor,
+        0,
+        number_of_chunks(size, 2 * run),
+        1,
+        [&](std::size_t pair)
+        {
+            const std::size_t begin = pair * 2 * run;
+            const std::size_t middle = std::min(size, begin + run);
+            const std::size_t end = std::min(size, begin + 2 * run);
+            std::merge(
+                std::make_move_iterator(source + begin),
+                std::make_move_iterator(source + middle),
+                std::make_move_iterator(source + middle),
+                std::make_move_iterator(source + end),
+                destination + begin,
+                comp);
+        });
+}
+
+} /* namespace detail */
+
+template <typename Function>
+void parallel_for(
+        ParallelExecutor& executor,
+        std::size_t begin,
+        std::size_t end,
+        std::size_t grain,
+        Function function)
+{
+    if (end <= begin)
+    {
+        return;
+    }
+
+    const std::size_t size = end - begin;
+    if (grain == 0)
+    {
+        grain = detail::automatic_grain(executor, size);
+    }
+
+    auto chunk_function =
+            [&](std::size_t chunk)
+            {
+                const std::size_t chunk_begin = begin + chunk * grain;
+                const std::size_t chunk_end = std::min(end, chunk_begin + grain);
+                for (std::size_t i = chunk_begin; i < chunk_end; ++i)
+                {
+                    function(i);
+                }
+            };
+
+    executor.run(detail::number_of_chunks(size, grain), chunk_function);
+}
+
+template <typename RandomIt, typename OutputRandomIt, typename UnaryOperation>
+OutputRandomIt parallel_transform(
+        ParallelExecutor& executor,
+        RandomIt first,
+        RandomIt last,
+        OutputRandomIt d_first,
+        std::size_t grain,
+        UnaryOperation op)
+{
+    const std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+
+    parallel_for(
+        executor,
+        0,
+        size,
+        grain,
+        [&](std::size_t i)
+        {
+            *(d_first + i) = op(*(first + i));
+        });
+
+    return d_first + size;
+}
+
+template <typename RandomIt, typename T, typename BinaryOperation>
+T parallel_reduce(
+        ParallelExecutor& executor,
+        RandomIt first,
+        RandomIt last,
+        T init,
+        std::size_t grain,
+        BinaryOperation op)
+{
+    const std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+    if (size == 0)
+    {
+        return init;
+    }
+
+    if (grain == 0)
+    {
+        grain = detail::automatic_grain(executor, size);
+    }
+
+    const std::size_t n_chunks = detail::number_of_chunks(size, grain);
+    std::vector<T> partial_results(n_chunks, init);
+
+    auto chunk_function =
+            [&](std::size_t chunk)
+            {
+                // Each chunk starts from its first element, so init is only reduced once
+                RandomIt it = first + chunk * grain;
+                const RandomIt chunk_last = first + std::min(size, (chunk + 1) * grain);
+
+                T partial = *it;
+                for (++it; it != chunk_last; ++it)
+                {
+                    partial = op(std::move(partial), *it);
+                }
+                partial_results[chunk] = std::move(partial);
+            };
+
+    executor.run(n_chunks, chunk_function);
+
+    for (T& partial : partial_results)
+    {
+        init = op(std::move(init), std::move(partial));
+    }
+
+    return init;
+}
+
+template <typename RandomIt, typename Compare>
+void parallel_stable_sort(
+        ParallelExecutor& executor,
+        RandomIt first,
+        RandomIt last,
+        std::size_t grain,
+        Compare comp)
+{
+    using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+
+    const std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+    if (size < 2)
+    {
+        return;
+    }
+
+    if (grain == 0)
+    {
+        grain = detail::automatic_grain(executor, size);
+    }
+
+    // Sort every chunk independently
+    parallel_for(
+        executor,
+        0,
+        detail::number_of_chunks(size, grain),
+        1,
+        [&](std::size_t chunk)
+        {
+            std::stable_sort(
+                first + chunk * grain,
+                first + std::min(size, (chunk + 1) * grain),
+                comp);
+        });
+
+    if (grain >= size)
+    {
+        return;
+    }
+
+    // Move the sorted runs to the buffer and merge them by pairs, alternating the range and the buffer as source
+    // and destination, until a single run remains
+    std::vector<ValueType> buffer(std::make_move_iterator(first), std::make_move_iterator(last));
+    bool sorted_in_buffer = true;
+
+    for (std::size_t run = grain; run < size; run *= 2)
+    {
+        if (sorted_in_buffer)
+        {
+            detail::merge_runs(executor, buffer.begin(), first, size, run, comp);
+        }
+        else
+        {
+            detail::merge_runs(executor, first, buffer.begin(), size, run, comp);
+        }
+
+        sorted_in_buffer = !sorted_in_buffer;
+    }
+
+    if (sorted_in_buffer)
+    {
+        std::move(buffer.begin(), buffer.end(), first);
+    }
+}
+
+template <typename RandomIt>
+void parallel_stable_sort(
+        ParallelExecutor& executor,
+        RandomIt first,
+        RandomIt last,
+        std::size_t grain /* = 0 */)
+{
+    parallel_stable_sort(executor, first, last, grain, std::less<>());
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
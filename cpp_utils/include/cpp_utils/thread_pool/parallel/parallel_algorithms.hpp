@@ -0,0 +1,121 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file parallel_algorithms.hpp
+ *
+ * This file contains parallel versions of common algorithms that run over a \c ParallelExecutor .
+ *
+ * Every algorithm divides its range in chunks of \c grain elements that are executed by the calling thread
+ * and the threads of the pool. A \c grain of 0 lets the algorithm choose one depending on the size of the range
+ * and the concurrency of the executor.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include <cpp_utils/thread_pool/parallel/ParallelExecutor.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Call \c function(i) for every index i in [begin, end) in parallel.
+ *
+ * @param executor executor that runs the chunks.
+ * @param begin first index.
+ * @param end last index + 1.
+ * @param grain number of consecutive indexes executed as one chunk. 0 for automatic.
+ * @param function function object callable with a \c std::size_t index.
+ *
+ * @throw any exception thrown by \c function .
+ */
+template <typename Function>
+void parallel_for(
+        ParallelExecutor& executor,
+        std::size_t begin,
+        std::size_t end,
+        std::size_t grain,
+        Function function);
+
+/**
+ * @brief Parallel version of \c std::transform .
+ *
+ * Writes \c op(*(first + i)) in \c *(d_first + i) for every element in [first, last).
+ *
+ * @tparam RandomIt random access iterator of the input range.
+ * @tparam OutputRandomIt random access iterator of the output range, with space for every input element.
+ *
+ * @return iterator to the element past the last element written.
+ */
+template <typename RandomIt, typename OutputRandomIt, typename UnaryOperation>
+OutputRandomIt parallel_transform(
+        ParallelExecutor& executor,
+        RandomIt first,
+        RandomIt last,
+        OutputRandomIt d_first,
+        std::size_t grain,
+        UnaryOperation op);
+
+/**
+ * @brief Parallel version of \c std::accumulate .
+ *
+ * Each chunk is reduced independently and the partial results are then reduced in order over \c init .
+ * Thus \c op must be associative, but it does not need to be commutative.
+ *
+ * @note Partial results are stored in a single vector allocated once per call (one element per chunk).
+ *
+ * @return \c init reduced with every element in [first, last) by \c op .
+ */
+template <typename RandomIt, typename T, typename BinaryOperation>
+T parallel_reduce(
+        ParallelExecutor& executor,
+        RandomIt first,
+        RandomIt last,
+        T init,
+        std::size_t grain,
+        BinaryOperation op);
+
+/**
+ * @brief Parallel version of \c std::stable_sort .
+ *
+ * Each chunk is sorted with \c std::stable_sort and then chunks are merged by pairs in parallel, doubling the
+ * size of the sorted runs in each round, until the whole range is sorted.
+ * Merging uses an auxiliary buffer of the size of the range, allocated once per call.
+ *
+ * @tparam RandomIt random access iterator whose value type is move constructible and move assignable.
+ */
+template <typename RandomIt, typename Compare>
+void parallel_stable_sort(
+        ParallelExecutor& executor,
+        RandomIt first,
+        RandomIt last,
+        std::size_t grain,
+        Compare comp);
+
+//! \c parallel_stable_sort using \c operator< .
+template <typename RandomIt>
+void parallel_stable_sort(
+        ParallelExecutor& executor,
+        RandomIt first,
+        RandomIt last,
+        std::size_t grain = 0);
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/thread_pool/parallel/impl/parallel_algorithms.ipp>
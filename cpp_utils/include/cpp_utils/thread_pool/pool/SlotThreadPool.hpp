@@ -20,7 +20,9 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <map>
+#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -104,6 +106,7 @@ public:
      * @brief Register a new task identified by a task Id.
      *
      * This method registers a new task that will be executed when its task Id is added to the queue.
+     * The task is moved into the register, so its callable is never copied nor allocated again.
      *
      * @param task_id task Id that identifies the task.
      * @param task task to be registered.
@@ -112,6 +115,20 @@ public:
             const TaskId& task_id,
             Task&& task);
 
+    /**
+     * @brief Remove the task registered with \c task_id .
+     *
+     * Ids of the task already in the queue are skipped. If the task is being executed, it waits until every
+     * execution has finished, so objects the task refers to can be destroyed once it returns.
+     * Called from the task being removed, it does not wait, and the slot is erased once the task returns.
+     *
+     * @param task_id task Id that identifies the task.
+     *
+     * @throw \c ValueNotAllowedException if \c task_id is not registered.
+     */
+    CPP_UTILS_DllAPI void unslot(
+            const TaskId& task_id);
+
     /**
      * @brief Wait until all queued tasks are executed.
      *
@@ -124,6 +141,12 @@ public:
     CPP_UTILS_DllAPI utils::event::AwakeReason wait_all_consumed(
             const utils::Duration_ms& timeout = 0);
 
+    //! Whether the pool is enabled, so its threads execute the tasks emitted.
+    CPP_UTILS_DllAPI bool enabled() const noexcept;
+
+    //! Number of threads this pool runs while enabled.
+    CPP_UTILS_DllAPI unsigned int number_of_threads() const noexcept;
+
 protected:
 
     /**
@@ -158,16 +181,38 @@ protected:
      */
     std::vector<CustomThread> threads_;
 
+    //! Task registered, with the executions of it running.
+    struct Slot
+    {
+        Slot(
+                Task&& task)
+            : task(std::move(task))
+        {
+        }
+
+        //! Task to execute.
+        Task task;
+
+        //! Number of threads executing \c task .
+        unsigned int running = 0;
+
+        //! Whether the task is being removed, so it must not be executed again. The last execution erases it.
+        bool removed = false;
+    };
+
     /**
      * @brief Map of tasks indexed by their task Id.
      *
      * This object is protected by the \c slots_mutex_ mutex.
      */
-    std::map<TaskId, Task> slots_;
+    std::map<TaskId, Slot> slots_;
 
     //! Protects access to \c slots_ .
     std::mutex slots_mutex_;
 
+    //! Notifies slots erased to \c unslot .
+    std::condition_variable slots_cv_;
+
     //! Whether the object is currently enabled
     std::atomic<bool> enabled_;
 
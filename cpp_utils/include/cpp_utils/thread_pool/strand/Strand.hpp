@@ -0,0 +1,197 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file Strand.hpp
+ *
+ * This file contains class Strand definition.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
+#include <cpp_utils/thread_pool/task/Task.hpp>
+#include <cpp_utils/thread_pool/task/TaskId.hpp>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Lock-free queue of the tasks posted to a \c Strand .
+ *
+ * It is a linked list with multiple producers and a single consumer: producers append nodes by exchanging the
+ * tail pointer, and the consumer takes them from the head, that is always a node already consumed (or a dummy one).
+ *
+ * A counter of pending tasks decides which thread schedules the strand: the producer that increments it from 0
+ * must emit the strand slot, and the consumer keeps executing tasks until it decrements it to 0.
+ * Thus there is at most one emission of the strand in the pool at any time, and none while the queue is empty.
+ *
+ * This object is shared between the \c Strand and the task registered in the \c SlotThreadPool ,
+ * so tasks posted before the strand is destroyed are still executed afterwards.
+ * Once the strand is destroyed, the slot is removed from the pool as soon as the queue is empty.
+ */
+class StrandQueue
+{
+public:
+
+    //! Construct an empty queue.
+    CPP_UTILS_DllAPI StrandQueue();
+
+    //! Destroy the queue and the tasks not executed.
+    CPP_UTILS_DllAPI ~StrandQueue();
+
+    /**
+     * @brief Append \c task to the queue.
+     *
+     * @return whether the queue was idle, so the caller must schedule its execution.
+     */
+    CPP_UTILS_DllAPI bool push(
+            Task&& task);
+
+    /**
+     * @brief Execute tasks in FIFO order until the queue is empty or \c max_tasks have been executed.
+     *
+     * Only one thread may execute the queue at a time, what is guaranteed by scheduling it only when \c push
+     * returns true or this method returns true.
+     * Exceptions thrown by tasks are logged and do not stop the execution of the following tasks.
+     *
+     * @return whether tasks remain in the queue, so the caller must schedule its execution again.
+     */
+    CPP_UTILS_DllAPI bool execute(
+            unsigned int max_tasks) noexcept;
+
+    //! Number of tasks posted and not finished yet (including the one being executed).
+    CPP_UTILS_DllAPI std::size_t pending() const noexcept;
+
+    /**
+     * @brief Mark the queue as orphan, as its strand is destroyed and no more tasks are posted.
+     *
+     * @return whether the queue is empty, so the caller must remove the slot. Otherwise, \c release returns true
+     * once the last task has been executed.
+     */
+    CPP_UTILS_DllAPI bool orphan() noexcept;
+
+    /**
+     * @brief Whether the queue is orphan and empty, so the slot that executes it must be removed.
+     *
+     * It returns true only once, in this method or in \c orphan .
+     */
+    CPP_UTILS_DllAPI bool release() noexcept;
+
+protected:
+
+    //! Node of the linked list.
+    struct Node
+    {
+        //! Task posted. Empty for the dummy node.
+        Task task;
+
+        //! Next node in FIFO order.
+        std::atomic<Node*> next {nullptr};
+    };
+
+    /**
+     * @brief Take the task of the oldest node in the list.
+     *
+     * @pre at least one task has been counted in \c pending_ and not consumed yet.
+     */
+    Task pop_() noexcept;
+
+    /**
+     * @brief Last node consumed (or the dummy one). Its \c next is the next task to execute.
+     *
+     * Only accessed by the thread executing the queue.
+     */
+    Node* head_;
+
+    //! Last node appended. Exchanged by producers.
+    std::atomic<Node*> tail_;
+
+    //! Number of tasks counted by producers and not finished by the consumer.
+    std::atomic<std::size_t> pending_;
+
+    //! Whether the strand of this queue has been destroyed.
+    std::atomic<bool> orphan_;
+
+    //! Whether the removal of the slot has already been requested.
+    std::atomic<bool> released_;
+};
+
+/**
+ * This class executes tasks in a \c SlotThreadPool one after another, in the same order they are posted.
+ *
+ * Tasks posted to the same strand never run concurrently, but any thread of the pool can execute them, and
+ * tasks of different strands run in parallel. This allows to serialize the work related with one key
+ * (e.g. a topic) without mutexes inside the tasks that would block the pool threads, and without a pool per key.
+ *
+ * A strand does not hold any thread of the pool while it has no tasks. Once scheduled, it executes at most
+ * \c MAX_TASKS_PER_EMISSION tasks before yielding the thread, so a busy strand does not starve the others.
+ *
+ * A single slot is registered in the pool at construction, and it is emitted only when the strand goes from idle
+ * to busy. It is removed when the strand is destroyed and its tasks have finished, so short-lived strands do not
+ * leave slots behind. Each task posted requires one queue node allocation.
+ */
+class Strand
+{
+public:
+
+    /**
+     * @brief Construct a new Strand that executes its tasks in \c thread_pool .
+     *
+     * @param thread_pool pool where tasks are executed. It must outlive this object.
+     *
+     * @throw \c ValueNotAllowedException if the task id taken for the slot is already registered in the pool.
+     */
+    CPP_UTILS_DllAPI Strand(
+            SlotThreadPool& thread_pool);
+
+    /**
+     * @brief Destroy the Strand.
+     *
+     * Tasks already posted are still executed, and the slot is removed from the pool once they are finished.
+     */
+    CPP_UTILS_DllAPI ~Strand();
+
+    /**
+     * @brief Add \c task to be executed after every task previously posted to this strand.
+     *
+     * This method does not block, and can be called from any thread, including from tasks of this strand.
+     */
+    CPP_UTILS_DllAPI void post(
+            Task&& task);
+
+    //! Number of tasks posted and not finished yet.
+    CPP_UTILS_DllAPI std::size_t pending() const noexcept;
+
+    //! Maximum number of tasks executed by a pool thread before it yields the strand to other slots.
+    static constexpr unsigned int MAX_TASKS_PER_EMISSION = 16;
+
+protected:
+
+    //! Pool where the strand slot is registered.
+    SlotThreadPool& thread_pool_;
+
+    //! Id of the slot registered in \c thread_pool_ .
+    TaskId task_id_;
+
+    //! Tasks posted, shared with the slot registered in \c thread_pool_ .
+    std::shared_ptr<StrandQueue> queue_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,181 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InplaceTask.hpp
+ *
+ * This file contains class InplaceTask definition.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace eprosima {
+namespace utils {
+
+/**
+ * @brief Table of the operations required to manage a callable of type \c F stored inside an \c InplaceTask .
+ *
+ * There is one constant table per callable type, so an \c InplaceTask only stores a pointer to it.
+ */
+struct InplaceTaskOperations
+{
+    //! Call the object stored in \c storage .
+    void (* invoke)(void* storage);
+
+    //! Move construct the object in \c source into \c destination and destroy the one in \c source .
+    void (* relocate)(
+            void* destination,
+            void* source) noexcept;
+
+    //! Destroy the object stored in \c storage .
+    void (* destroy)(void* storage) noexcept;
+};
+
+//! Operations table of callable type \c F .
+template <typename F>
+struct InplaceTaskOperationsOf
+{
+    static const InplaceTaskOperations value;
+};
+
+/**
+ * This class represents a move-only task that stores its callable inside the object.
+ *
+ * Unlike \c std::function , it never allocates memory: the callable is constructed in an internal buffer of
+ * \c Capacity bytes, and a callable that does not fit (or requires a stricter alignment, or may throw when moved)
+ * is rejected at compile time. Callables bigger than the buffer can still be stored explicitly by wrapping them
+ * with \c make_allocated_task , that allocates them once in the heap.
+ *
+ * As it is move-only, callables that are not copyable (e.g. capturing a \c std::unique_ptr ) are accepted.
+ *
+ * @tparam Capacity size in bytes of the internal buffer.
+ */
+template <std::size_t Capacity>
+class InplaceTask
+{
+public:
+
+    //! Size in bytes of the internal buffer.
+    static constexpr std::size_t CAPACITY = Capacity;
+
+    //! Alignment of the internal buffer.
+    static constexpr std::size_t ALIGNMENT = alignof(std::max_align_t);
+
+    //! Construct an empty task.
+    InplaceTask() noexcept;
+
+    //! Construct an empty task.
+    InplaceTask(
+            std::nullptr_t) noexcept;
+
+    /**
+     * @brief Construct a task that stores a copy (or a moved instance) of \c callable .
+     *
+     * @tparam F callable type with signature \c void() . It must fit in \c Capacity bytes, must not require an
+     * alignment stricter than \c ALIGNMENT and must be nothrow move constructible.
+     */
+    template <
+        typename F,
+        typename = typename std::enable_if<
+            !std::is_base_of<InplaceTask, typename std::decay<F>::type>::value &&
+            !std::is_same<std::nullptr_t, typename std::decay<F>::type>::value>::type>
+    InplaceTask(
+            F&& callable);
+
+    //! Move the callable of \c other into this task, leaving \c other empty.
+    InplaceTask(
+            InplaceTask&& other) noexcept;
+
+    //! Destroy the callable of this task (if any) and move the one of \c other , leaving \c other empty.
+    InplaceTask& operator =(
+            InplaceTask&& other) noexcept;
+
+    //! Destroy the callable of this task (if any), leaving it empty.
+    InplaceTask& operator =(
+            std::nullptr_t) noexcept;
+
+    InplaceTask(
+            const InplaceTask&) = delete;
+    InplaceTask& operator =(
+            const InplaceTask&) = delete;
+
+    //! Destroy the callable stored (if any).
+    ~InplaceTask();
+
+    /**
+     * @brief Call the callable stored.
+     *
+     * @throw \c std::bad_function_call if the task is empty.
+     * @throw any exception thrown by the callable.
+     */
+    void operator ()();
+
+    //! Whether the task stores a callable.
+    explicit operator bool() const noexcept;
+
+protected:
+
+    //! Destroy the callable stored (if any) and leave this task empty.
+    void reset_() noexcept;
+
+    //! Operations of the callable stored. \c nullptr if empty.
+    const InplaceTaskOperations* operations_;
+
+    //! Buffer where the callable is constructed.
+    typename std::aligned_storage<Capacity, ALIGNMENT>::type storage_;
+};
+
+/**
+ * @brief Callable that owns a heap allocated callable of type \c F and calls it.
+ *
+ * It has the size of a pointer, so it fits in any \c InplaceTask . Moving it does not move the callable.
+ */
+template <typename F>
+class AllocatedTask
+{
+public:
+
+    //! Allocate a copy (or a moved instance) of \c callable .
+    template <typename G>
+    explicit AllocatedTask(
+            G&& callable);
+
+    //! Call the callable owned.
+    void operator ()();
+
+protected:
+
+    //! Callable owned.
+    std::unique_ptr<F> callable_;
+};
+
+/**
+ * @brief Wrap \c callable in an \c AllocatedTask .
+ *
+ * This is the explicit fallback to store in an \c InplaceTask callables that do not fit in its buffer.
+ * It performs a single allocation.
+ */
+template <typename F>
+AllocatedTask<typename std::decay<F>::type> make_allocated_task(
+        F&& callable);
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <cpp_utils/thread_pool/task/impl/InplaceTask.ipp>
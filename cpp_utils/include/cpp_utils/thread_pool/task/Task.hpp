@@ -20,20 +20,31 @@
 
 #pragma once
 
-#include <functional>
+#include <cstddef>
+
+#include <cpp_utils/thread_pool/task/InplaceTask.hpp>
 
 namespace eprosima {
 namespace utils {
 
+//! Size in bytes of the buffer where a \c Task stores its callable.
+constexpr const std::size_t TASK_INLINE_CAPACITY = 64;
+
 /**
  * This class represents a task that can be executed by a Thread Pool.
  *
- * @note this first implementation only uses this class as a \c std::function<void()> for simplicity.
- * In future implementations, this could be a more complex class.
+ * It is a move-only \c InplaceTask , so creating, moving and calling a task never allocates memory.
+ * Callables bigger than \c TASK_INLINE_CAPACITY bytes do not compile, unless they are explicitly wrapped with
+ * \c make_allocated_task .
  */
-class Task : public std::function<void()>
+class Task : public InplaceTask<TASK_INLINE_CAPACITY>
 {
-    using std::function<void()>::function;
+public:
+
+    using InplaceTask<TASK_INLINE_CAPACITY>::InplaceTask;
+
+    //! Construct an empty task.
+    Task() noexcept = default;
 };
 
 } /* namespace utils */
@@ -0,0 +1,192 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InplaceTask.ipp
+ */
+
+#pragma once
+
+#include <functional>
+#include <new>
+#include <utility>
+
+namespace eprosima {
+namespace utils {
+
+namespace detail {
+
+template <typename F>
+void inplace_task_invoke(
+        void* storage)
+{
+    (*static_cast<F*>(storage))();
+}
+
+template <typename F>
+void inplace_task_relocate(
+        void* destination,
+        void* source) noexcept
+{
+    F* source_callable = static_cast<F*>(source);
+    new (destination) F(std::move(*source_callable));
+    source_callable->~F();
+}
+
+template <typename F>
+void inplace_task_destroy(
+        void* storage) noexcept
+{
+    static_cast<F*>(storage)->~F();
+}
+
+} /* namespace detail */
+
+template <typename F>
+const InplaceTaskOperations InplaceTaskOperationsOf<F>::value = {
+    &detail::inplace_task_invoke<F>,
+    &detail::inplace_task_relocate<F>,
+    &detail::inplace_task_destroy<F>
+};
+
+template <std::size_t Capacity>
+constexpr std::size_t InplaceTask<Capacity>::CAPACITY;
+
+template <std::size_t Capacity>
+constexpr std::size_t InplaceTask<Capacity>::ALIGNMENT;
+
+template <std::size_t Capacity>
+InplaceTask<Capacity>::InplaceTask() noexcept
+    : operations_(nullptr)
+{
+}
+
+template <std::size_t Capacity>
+InplaceTask<Capacity>::InplaceTask(
+        std::nullptr_t) noexcept
+    : operations_(nullptr)
+{
+}
+
+template <std::size_t Capacity>
+template <typename F, typename>
+InplaceTask<Capacity>::InplaceTask(
+        F&& callable)
+    : operations_(nullptr)
+{
+    using Callable = typename std::decay<F>::type;
+
+    static_assert(sizeof(Callable) <= Capacity,
+            "Callable does not fit in the task buffer: reduce its captures or wrap it with make_allocated_task.");
+    static_assert(ALIGNMENT % alignof(Callable) == 0,
+            "Callable requires an alignment stricter than the task buffer.");
+    static_assert(std::is_nothrow_move_constructible<Callable>::value,
+            "Callable must be nothrow move constructible to be moved between tasks.");
+
+    new (&storage_) Callable(std::forward<F>(callable));
+    operations_ = &InplaceTaskOperationsOf<Callable>::value;
+}
+
+template <std::size_t Capacity>
+InplaceTask<Capacity>::InplaceTask(
+        InplaceTask&& other) noexcept
+    : operations_(other.operations_)
+{
+    if (operations_)
+    {
+        operations_->relocate(&storage_, &other.storage_);
+        other.operations_ = nullptr;
+    }
+}
+
+template <std::size_t Capacity>
+InplaceTask<Capacity>& InplaceTask<Capacity>::operator =(
+        InplaceTask&& other) noexcept
+{
+    if (this != &other)
+    {
+        reset_();
+        if (other.operations_)
+        {
+            other.operations_->relocate(&storage_, &other.storage_);
+            operations_ = other.operations_;
+            other.operations_ = nullptr;
+        }
+    }
+    return *this;
+}
+
+template <std::size_t Capacity>
+InplaceTask<Capacity>& InplaceTask<Capacity>::operator =(
+        std::nullptr_t) noexcept
+{
+    reset_();
+    return *this;
+}
+
+template <std::size_t Capacity>
+InplaceTask<Capacity>::~InplaceTask()
+{
+    reset_();
+}
+
+template <std::size_t Capacity>
+void InplaceTask<Capacity>::operator ()()
+{
+    if (!operations_)
+    {
+        throw std::bad_function_call();
+    }
+    operations_->invoke(&storage_);
+}
+
+template <std::size_t Capacity>
+InplaceTask<Capacity>::operator bool() const noexcept
+{
+    return operations_ != nullptr;
+}
+
+template <std::size_t Capacity>
+void InplaceTask<Capacity>::reset_() noexcept
+{
+    if (operations_)
+    {
+        operations_->destroy(&storage_);
+        operations_ = nullptr;
+    }
+}
+
+template <typename F>
+template <typename G>
+AllocatedTask<F>::AllocatedTask(
+        G&& callable)
+    : callable_(new F(std::forward<G>(callable)))
+{
+}
+
+template <typename F>
+void AllocatedTask<F>::operator ()()
+{
+    (*callable_)();
+}
+
+template <typename F>
+AllocatedTask<typename std::decay<F>::type> make_allocated_task(
+        F&& callable)
+{
+    return AllocatedTask<typename std::decay<F>::type>(std::forward<F>(callable));
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
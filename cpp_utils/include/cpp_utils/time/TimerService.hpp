@@ -0,0 +1,146 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TimerService.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include <cpp_utils/library/library_dll.h>
+#include <cpp_utils/time/time_utils.hpp>
+
+namespace eprosima {
+namespace utils {
+
+//! Identifier of a task scheduled in a \c TimerService . 0 never identifies a task.
+using TimerTaskId = uint64_t;
+
+/**
+ * @brief This class executes tasks at a given time from a single thread.
+ *
+ * Any number of objects can schedule tasks in the same service, so they share a single thread and a single wait
+ * instead of one thread per object. The thread sleeps until the earliest task is due, and it is only woken up
+ * when a task earlier than that is scheduled or when the service is destroyed.
+ *
+ * Tasks are executed in order of due time, one after the other, so they must be short.
+ */
+class TimerService
+{
+public:
+
+    //! Clock used to schedule tasks.
+    using Clock = std::chrono::steady_clock;
+
+    //! Construct a new Timer Service and start its thread.
+    CPP_UTILS_DllAPI TimerService();
+
+    //! Stop the thread. Tasks not executed yet are discarded.
+    CPP_UTILS_DllAPI ~TimerService();
+
+    //! Service shared by every object that does not require its own one.
+    CPP_UTILS_DllAPI static TimerService& shared();
+
+    /**
+     * @brief Execute \c task once at \c time (or as soon as possible if already passed).
+     *
+     * @return id to cancel the task.
+     */
+    CPP_UTILS_DllAPI TimerTaskId schedule(
+            Clock::time_point time,
+            std::function<void()> task);
+
+    //! Execute \c task once after \c delay milliseconds.
+    CPP_UTILS_DllAPI TimerTaskId schedule(
+            Duration_ms delay,
+            std::function<void()> task);
+
+    /**
+     * @brief Cancel the task identified by \c id .
+     *
+     * Once this method returns, the task is not running and it will not be executed,
+     * unless this is called from the task itself.
+     *
+     * @return whether the task was cancelled before being executed.
+     */
+    CPP_UTILS_DllAPI bool cancel(
+            TimerTaskId id) noexcept;
+
+    //! Number of tasks waiting to be executed.
+    CPP_UTILS_DllAPI std::size_t size() const noexcept;
+
+protected:
+
+    //! Routine of the timer thread.
+    void thread_routine_() noexcept;
+
+    /**
+     * @brief Tasks scheduled, ordered by time and then by id (so tasks at the same time keep their order).
+     *
+     * Guarded by \c mutex_
+     */
+    std::map<std::pair<Clock::time_point, TimerTaskId>, std::function<void()>> tasks_;
+
+    /**
+     * @brief Time of each task scheduled, to find it when cancelling.
+     *
+     * Guarded by \c mutex_
+     */
+    std::map<TimerTaskId, Clock::time_point> task_times_;
+
+    /**
+     * @brief Id of the task being executed. 0 if none.
+     *
+     * Guarded by \c mutex_
+     */
+    TimerTaskId running_task_;
+
+    /**
+     * @brief Id of the next task scheduled.
+     *
+     * Guarded by \c mutex_
+     */
+    TimerTaskId next_id_;
+
+    /**
+     * @brief Whether the thread must stop.
+     *
+     * Guarded by \c mutex_
+     */
+    bool stop_;
+
+    //! Protects every member of this object.
+    mutable std::mutex mutex_;
+
+    //! Notified when a task is scheduled earlier than the previous earliest one, or when stopping.
+    std::condition_variable wake_up_cv_;
+
+    //! Notified when a task finishes its execution.
+    std::condition_variable task_finished_cv_;
+
+    //! Timer thread.
+    std::thread thread_;
+};
+
+} /* namespace utils */
+} /* namespace eprosima */
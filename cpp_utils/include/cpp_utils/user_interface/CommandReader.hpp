@@ -14,8 +14,12 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include <cpp_utils/event/StdinEventHandler.hpp>
 #include <cpp_utils/enum/EnumBuilder.hpp>
+#include <cpp_utils/file/FdLineReader.hpp>
 #include <cpp_utils/wait/DBQueueWaitHandler.hpp>
 
 namespace eprosima {
@@ -46,7 +50,12 @@ struct Command
  * This class is similar to \c StdinEventHandler but this reads under request,
  * vs the event handler that is asynchronous.
  *
- * @note This class relies on \c StdinEventHandler to read from stdin and in \c EnumBuilder to interpret command.
+ * Constructed with a \c FdLineReader , commands are read directly from a file descriptor in the calling thread,
+ * without an internal thread nor queue, so streams of many commands (e.g. a replay script piped to stdin)
+ * are read at I/O speed.
+ *
+ * @note This class relies on \c StdinEventHandler to read from stdin (or on \c FdLineReader )
+ * and in \c EnumBuilder to interpret command.
  */
 template <typename CommandEnum>
 class CommandReader
@@ -66,6 +75,19 @@ public:
             const EnumBuilder<CommandEnum>& builder,
             std::istream& source = std::cin);
 
+    /**
+     * @brief Construct a new Command Reader object that reads commands from a file descriptor.
+     *
+     * @param builder class that allow to convert a string to a enumeration kind.
+     * @param reader reader of the descriptor (stdin by default in \c FdLineReader ).
+     *
+     * @warning Do not mix it with other readers of the same descriptor (or of \c std::cin if it is stdin),
+     * as data buffered by one of them is not available for the others.
+     */
+    CommandReader(
+            const EnumBuilder<CommandEnum>& builder,
+            std::unique_ptr<FdLineReader> reader);
+
     //! Default dtor
     ~CommandReader() = default;
 
@@ -84,21 +106,52 @@ public:
     bool read_next_command(
             Command<CommandEnum>& command);
 
+    /**
+     * @brief Read the next \c n lines, and keep the commands parsable to a enum value of \c EnumBuilder .
+     *
+     * The commands already in \c commands are reused, so reading batches in the same vector
+     * does not allocate once the strings are big enough.
+     *
+     * @param [out] commands commands read and parsable. It is resized to the number of them.
+     * @param n number of lines to read.
+     *
+     * @return number of lines read. It is lower than \c n only if reading from a \c FdLineReader and
+     * the end of the stream has been reached.
+     */
+    std::size_t read_commands(
+            std::vector<Command<CommandEnum>>& commands,
+            std::size_t n);
+
 protected:
 
     /**
-     * @brief
+     * @brief Read next command.
+     *
+     * @param [out] command command to fill with the data read.
+     * @param [out] line_read whether a line has been read, or the end of the stream has been reached.
      *
-     * @param command_read
+     * @return whether the data read is parsable to a enum value of \c EnumBuilder .
+     */
+    bool read_command_(
+            Command<CommandEnum>& command,
+            bool& line_read);
+
+    /**
+     * @brief Callback of \c stdin_handler_ : produce the line read in \c commands_read_ .
+     *
+     * @param command_read line read
      */
     void read_command_callback_(
-            std::string command_read);
+            const std::string& command_read);
 
     //! Builder to transform string into a command enum value.
     EnumBuilder<CommandEnum> builder_;
 
-    //! Event Handler used to read from stdin.
-    event::StdinEventHandler stdin_handler_;
+    //! Reader used to read from a file descriptor. \c nullptr if reading with \c stdin_handler_ .
+    std::unique_ptr<FdLineReader> line_reader_;
+
+    //! Event Handler used to read from stdin. \c nullptr if reading with \c line_reader_ .
+    std::unique_ptr<event::StdinEventHandler> stdin_handler_;
 
     /**
      * @brief Consumer where \c stdin_handler_ will produce commands read, and method \c read_next_command will
@@ -24,14 +24,25 @@ CommandReader<CommandEnum>::CommandReader(
         const EnumBuilder<CommandEnum>& builder,
         std::istream& source /* = std::cin */)
     : builder_(builder)
-    , stdin_handler_(
-        [this](std::string st)
-        {
-            this->read_command_callback_(st);
-        },
-        true,
-        0,
-        source)
+    , stdin_handler_(std::make_unique<event::StdinEventHandler>(
+                [this](const std::string& st)
+                {
+                    this->read_command_callback_(st);
+                },
+                true,
+                0,
+                source))
+    , commands_read_(0, true)
+{
+    // Do nothing
+}
+
+template <typename CommandEnum>
+CommandReader<CommandEnum>::CommandReader(
+        const EnumBuilder<CommandEnum>& builder,
+        std::unique_ptr<FdLineReader> reader)
+    : builder_(builder)
+    , line_reader_(std::move(reader))
     , commands_read_(0, true)
 {
     // Do nothing
@@ -41,11 +52,67 @@ template <typename CommandEnum>
 bool CommandReader<CommandEnum>::read_next_command(
         Command<CommandEnum>& command)
 {
-    stdin_handler_.read_one_more_line();
-    std::string full_command = commands_read_.consume();
+    bool line_read;
+    return read_command_(command, line_read);
+}
+
+template <typename CommandEnum>
+std::size_t CommandReader<CommandEnum>::read_commands(
+        std::vector<Command<CommandEnum>>& commands,
+        std::size_t n)
+{
+    if (commands.size() < n)
+    {
+        commands.resize(n);
+    }
+
+    std::size_t lines = 0;
+    std::size_t parsed = 0;
+
+    while (lines < n)
+    {
+        // Next command is read in place of the first one not kept yet
+        bool line_read;
+        const bool parsable = read_command_(commands[parsed], line_read);
+
+        if (!line_read)
+        {
+            break;
+        }
+
+        ++lines;
+        if (parsable)
+        {
+            ++parsed;
+        }
+    }
+
+    commands.resize(parsed);
+    return lines;
+}
+
+template <typename CommandEnum>
+bool CommandReader<CommandEnum>::read_command_(
+        Command<CommandEnum>& command,
+        bool& line_read)
+{
+    if (line_reader_)
+    {
+        // Divide command directly from the buffer of the reader. At the end of the stream, it is an empty command
+        const char* data = "";
+        std::size_t size = 0;
+        line_read = line_reader_->next_line(data, size);
+        split_line(data, size, ' ', command.arguments);
+    }
+    else
+    {
+        stdin_handler_->read_one_more_line();
+        std::string full_command = commands_read_.consume();
+        line_read = true;
 
-    // Divide command
-    command.arguments = utils::split_string(full_command, " ");
+        // Divide command
+        command.arguments = utils::split_string(full_command, " ");
+    }
 
     // Check if command exists
     // The args are already set in command, and the enum value will be set string_to_enumeration
@@ -54,7 +121,7 @@ bool CommandReader<CommandEnum>::read_next_command(
 
 template <typename CommandEnum>
 void CommandReader<CommandEnum>::read_command_callback_(
-        std::string command_read)
+        const std::string& command_read)
 {
     commands_read_.produce(command_read);
 }
@@ -17,11 +17,132 @@
  *
  */
 
+#include <cstdio>
+#include <cstring>
+#include <streambuf>
+
 #include <cpp_utils/Formatter.hpp>
 
 namespace eprosima {
 namespace utils {
 
+constexpr std::size_t Formatter::INLINE_CAPACITY;
+
+class Formatter::FallbackStream : public std::streambuf
+{
+public:
+
+    FallbackStream(
+            Formatter& formatter)
+        : formatter_(formatter)
+        , stream_(this)
+    {
+    }
+
+    std::ostream& stream() noexcept
+    {
+        return stream_;
+    }
+
+protected:
+
+    int_type overflow(
+            int_type c) override
+    {
+        if (!traits_type::eq_int_type(c, traits_type::eof()))
+        {
+            const char character = traits_type::to_char_type(c);
+            formatter_.append_(&character, 1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(
+            const char* s,
+            std::streamsize n) override
+    {
+        formatter_.append_(s, static_cast<std::size_t>(n));
+        return n;
+    }
+
+    //! Formatter where the text is written.
+    Formatter& formatter_;
+
+    //! Stream over this buffer.
+    std::ostream stream_;
+};
+
+Formatter::Formatter() noexcept
+    : data_(inline_buffer_)
+    , size_(0)
+    , capacity_(INLINE_CAPACITY)
+{
+}
+
+Formatter::Formatter(
+        const Formatter& other)
+    : Formatter()
+{
+    append_(other.data_, other.size_);
+}
+
+Formatter::Formatter(
+        Formatter&& other) noexcept
+    : Formatter()
+{
+    *this = std::move(other);
+}
+
+Formatter& Formatter::operator =(
+        const Formatter& other)
+{
+    if (this != &other)
+    {
+        size_ = 0;
+        append_(other.data_, other.size_);
+    }
+    return *this;
+}
+
+Formatter& Formatter::operator =(
+        Formatter&& other) noexcept
+{
+    if (this == &other)
+    {
+        return *this;
+    }
+
+    if (other.data_ != other.inline_buffer_)
+    {
+        // Take the heap buffer of other
+        if (data_ != inline_buffer_)
+        {
+            delete[] data_;
+        }
+        data_ = other.data_;
+        capacity_ = other.capacity_;
+    }
+    else
+    {
+        // The capacity of any buffer is at least the inline one
+        std::memcpy(data_, other.data_, other.size_);
+    }
+    size_ = other.size_;
+
+    other.data_ = other.inline_buffer_;
+    other.size_ = 0;
+    other.capacity_ = INLINE_CAPACITY;
+    return *this;
+}
+
+Formatter::~Formatter()
+{
+    if (data_ != inline_buffer_)
+    {
+        delete[] data_;
+    }
+}
+
 Formatter::operator std::string () const noexcept
 {
     return to_string();
@@ -29,14 +150,301 @@ Formatter::operator std::string () const noexcept
 
 std::string Formatter::to_string() const noexcept
 {
-    return ss_.str().c_str();
+    return std::string(data_, size_);
+}
+
+const char* Formatter::data() const noexcept
+{
+    return data_;
+}
+
+std::size_t Formatter::size() const noexcept
+{
+    return size_;
+}
+
+void Formatter::append_value_(
+        const std::string& val)
+{
+    if (stream_formatted_())
+    {
+        stream_() << val;
+        return;
+    }
+    append_(val.data(), val.size());
+}
+
+void Formatter::append_value_(
+        const char* val)
+{
+    if (val == nullptr)
+    {
+        // A stream sets its badbit and writes nothing
+        return;
+    }
+    if (stream_formatted_())
+    {
+        stream_() << val;
+        return;
+    }
+    append_(val, std::strlen(val));
+}
+
+void Formatter::append_value_(
+        char* val)
+{
+    append_value_(static_cast<const char*>(val));
+}
+
+void Formatter::append_value_(
+        char val)
+{
+    if (stream_formatted_())
+    {
+        stream_() << val;
+        return;
+    }
+    append_(&val, 1);
+}
+
+void Formatter::append_value_(
+        signed char val)
+{
+    if (stream_formatted_())
+    {
+        stream_() << val;
+        return;
+    }
+    append_value_(static_cast<char>(val));
+}
+
+void Formatter::append_value_(
+        unsigned char val)
+{
+    if (stream_formatted_())
+    {
+        stream_() << val;
+        return;
+    }
+    append_value_(static_cast<char>(val));
+}
+
+void Formatter::append_value_(
+        bool val)
+{
+    if (stream_formatted_())
+    {
+        stream_() << val;
+        return;
+    }
+    append_(val ? "1" : "0", 1);
+}
+
+void Formatter::append_value_(
+        short val)
+{
+    append_value_(static_cast<long long>(val));
+}
+
+void Formatter::append_value_(
+        unsigned short val)
+{
+    append_value_(static_cast<unsigned long long>(val));
+}
+
+void Formatter::append_value_(
+        int val)
+{
+    append_value_(static_cast<long long>(val));
+}
+
+void Formatter::append_value_(
+        unsigned int val)
+{
+    append_value_(static_cast<unsigned long long>(val));
+}
+
+void Formatter::append_value_(
+        long val)
+{
+    append_value_(static_cast<long long>(val));
+}
+
+void Formatter::append_value_(
+        unsigned long val)
+{
+    append_value_(static_cast<unsigned long long>(val));
+}
+
+void Formatter::append_value_(
+        long long val)
+{
+    if (stream_formatted_())
+    {
+        stream_() << val;
+        return;
+    }
+
+    // Magnitude computed in unsigned, so the lowest value does not overflow
+    const unsigned long long magnitude =
+            val < 0 ? 0ull - static_cast<unsigned long long>(val) : static_cast<unsigned long long>(val);
+    append_integer_(magnitude, val < 0);
+}
+
+void Formatter::append_value_(
+        unsigned long long val)
+{
+    if (stream_formatted_())
+    {
+        stream_() << val;
+        return;
+    }
+    append_integer_(val, false);
+}
+
+void Formatter::append_value_(
+        float val)
+{
+    // A stream writes a float as a double too
+    append_value_(static_cast<double>(val));
+}
+
+void Formatter::append_value_(
+        double val)
+{
+    append_floating_("%g", val);
+}
+
+void Formatter::append_value_(
+        long double val)
+{
+    append_floating_("%Lg", val);
+}
+
+void Formatter::append_value_(
+        const Formatter& val)
+{
+    if (&val == this)
+    {
+        // The buffer could move while appending it to itself
+        const std::string text = to_string();
+        append_(text.data(), text.size());
+        return;
+    }
+    append_(val.data_, val.size_);
+}
+
+void Formatter::append_(
+        const char* data,
+        std::size_t size)
+{
+    reserve_(size);
+    std::memcpy(data_ + size_, data, size);
+    size_ += size;
+}
+
+void Formatter::append_integer_(
+        unsigned long long magnitude,
+        bool negative)
+{
+    // Enough for the 20 digits of the highest value and the sign
+    char digits[24];
+    char* begin = digits + sizeof(digits);
+
+    do
+    {
+        *--begin = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+
+    if (negative)
+    {
+        *--begin = '-';
+    }
+
+    append_(begin, static_cast<std::size_t>(digits + sizeof(digits) - begin));
+}
+
+template<class Val>
+void Formatter::append_floating_(
+        const char* format,
+        Val val)
+{
+    if (stream_formatted_())
+    {
+        stream_() << val;
+        return;
+    }
+
+    // Same format as a default stream: %g with precision 6, whose longest output is like -1.23457e+4932
+    char number[32];
+    const int length = std::snprintf(number, sizeof(number), format, val);
+    if (length > 0)
+    {
+        append_(number, static_cast<std::size_t>(length));
+    }
+}
+
+void Formatter::reserve_(
+        std::size_t extra)
+{
+    if (size_ + extra <= capacity_)
+    {
+        return;
+    }
+
+    std::size_t new_capacity = capacity_ * 2;
+    if (new_capacity < size_ + extra)
+    {
+        new_capacity = size_ + extra;
+    }
+
+    char* new_data = new char[new_capacity];
+    std::memcpy(new_data, data_, size_);
+    if (data_ != inline_buffer_)
+    {
+        delete[] data_;
+    }
+
+    data_ = new_data;
+    capacity_ = new_capacity;
+}
+
+std::ostream& Formatter::stream_()
+{
+    if (!fallback_stream_)
+    {
+        fallback_stream_.reset(new FallbackStream(*this));
+    }
+    return fallback_stream_->stream();
+}
+
+bool Formatter::stream_formatted_() const noexcept
+{
+    if (!fallback_stream_)
+    {
+        return false;
+    }
+
+    const std::ostream& stream = fallback_stream_->stream();
+    return stream.flags() != (std::ios_base::dec | std::ios_base::skipws)
+           || stream.width() != 0
+           || stream.precision() != 6
+           || stream.fill() != ' ';
 }
 
 std::ostream& operator <<(
         std::ostream& os,
         const Formatter& f)
 {
-    os << f.to_string();
+    if (os.width() == 0)
+    {
+        os.write(f.data(), static_cast<std::streamsize>(f.size()));
+    }
+    else
+    {
+        os << f.to_string();
+    }
     return os;
 }
 
@@ -0,0 +1,138 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FileContentWatcherHandler.cpp
+ *
+ */
+
+#if defined(__linux__)
+
+#include <exception>
+
+#include <cpp_utils/exception/PreconditionNotMet.hpp>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/event/FileContentWatcherHandler.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+FileContentWatcherHandler::FileContentWatcherHandler(
+        std::string file_path)
+    : EventHandler<FileChange>()
+    , file_path_(file_path)
+    , watch_id_(0)
+    , last_content_hash_(0)
+    , content_known_(false)
+{
+    const std::size_t separator = file_path_.find_last_of('/');
+    file_name_ = separator == std::string::npos ? file_path_ : file_path_.substr(separator + 1);
+
+    logDebug(
+        UTILS_FILEWATCHER,
+        "FileContentWatcher Event Handler created with file path " << file_path_ << " .");
+}
+
+FileContentWatcherHandler::FileContentWatcherHandler(
+        const std::function<void(const FileChange&)>& callback,
+        std::string file_path)
+    : FileContentWatcherHandler(file_path)
+{
+    set_callback(callback);
+}
+
+FileContentWatcherHandler::~FileContentWatcherHandler()
+{
+    unset_callback();
+}
+
+void FileContentWatcherHandler::file_closed_() noexcept
+{
+    FileChange change;
+    change.file_name = file_name_;
+
+    try
+    {
+        change.snapshot = file_to_snapshot(file_path_.c_str());
+    }
+    catch (const PreconditionNotMet& e)
+    {
+        // The file could have been removed or replaced right after being written
+        logDebug(UTILS_FILEWATCHER, "File " << file_path_ << " changed but could not be read: " << e.what());
+        return;
+    }
+
+    if (content_known_ && change.snapshot.content_hash == last_content_hash_)
+    {
+        logDebug(UTILS_FILEWATCHER, "File " << file_path_ << " written with the same content.");
+        return;
+    }
+
+    last_content_hash_ = change.snapshot.content_hash;
+    content_known_ = true;
+
+    logInfo(UTILS_FILEWATCHER, "File: " << file_path_ << " content modified.");
+    event_occurred_(change);
+}
+
+void FileContentWatcherHandler::callback_set_nts_() noexcept
+{
+    // Current content is not notified, only its changes
+    try
+    {
+        last_content_hash_ = file_to_snapshot(file_path_.c_str()).content_hash;
+        content_known_ = true;
+    }
+    catch (const PreconditionNotMet&)
+    {
+        content_known_ = false;
+    }
+
+    try
+    {
+        watch_id_ = FileWatcherService::get_instance().add_watch(
+            file_path_,
+            [this](const std::string& /* file_name */)
+            {
+                file_closed_();
+            },
+            FileWatchTrigger::complete_write);
+    }
+    catch (const std::exception& e)
+    {
+        logError(UTILS_FILEWATCHER, "Error creating file content watcher: " << e.what());
+        return;
+    }
+
+    logInfo(UTILS_FILEWATCHER, "Start Watching content of file: " << file_path_);
+}
+
+void FileContentWatcherHandler::callback_unset_nts_() noexcept
+{
+    if (watch_id_ != 0)
+    {
+        // Once removed, the callback is not running and it will not be called again
+        FileWatcherService::get_instance().remove_watch(watch_id_);
+        watch_id_ = 0;
+
+        logInfo(UTILS_FILEWATCHER, "Stop Watching content of file: " << file_path_);
+    }
+}
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+#endif // if defined(__linux__)
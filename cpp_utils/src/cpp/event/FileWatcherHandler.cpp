@@ -22,7 +22,9 @@
 #include <cpp_utils/Formatter.hpp>
 #include <cpp_utils/event/FileWatcherHandler.hpp>
 
+#if !defined(__linux__)
 #include <event/FileWatcher.hpp>
+#endif // if !defined(__linux__)
 
 namespace eprosima {
 namespace utils {
@@ -32,6 +34,9 @@ FileWatcherHandler::FileWatcherHandler(
         std::string file_path)
     : EventHandler<std::string>()
     , file_path_(file_path)
+#if defined(__linux__)
+    , watch_id_(0)
+#endif // if defined(__linux__)
     , filewatcher_started_(false)
 {
     logDebug(
@@ -40,7 +45,7 @@ FileWatcherHandler::FileWatcherHandler(
 }
 
 FileWatcherHandler::FileWatcherHandler(
-        std::function<void(std::string)> callback,
+        std::function<void(const std::string&)> callback,
         std::string file_path)
     : FileWatcherHandler(file_path)
 {
@@ -56,6 +61,23 @@ void FileWatcherHandler::start_filewatcher_nts_()
 {
     logInfo(UTILS_FILEWATCHER, "Starting FileWatcher in file: " << file_path_);
 
+#if defined(__linux__)
+    try
+    {
+        watch_id_ = FileWatcherService::get_instance().add_watch(
+            file_path_,
+            [this](const std::string& path)
+            {
+                logInfo(UTILS_FILEWATCHER, "File: " << path << " modified.");
+                event_occurred_(path);
+            });
+    }
+    catch (const std::exception& e)
+    {
+        logError(UTILS_FILEWATCHER, "Error creating file watcher: " << e.what());
+        return;
+    }
+#else
     try
     {
         file_watch_handler_ = std::make_unique<FileWatcher>(
@@ -79,6 +101,7 @@ void FileWatcherHandler::start_filewatcher_nts_()
         utils::InitializationException(STR_ENTRY <<
                 "Error creating file watcher: " << e.what());
     }
+#endif // if defined(__linux__)
 
     filewatcher_started_.store(true);
 
@@ -87,7 +110,13 @@ void FileWatcherHandler::start_filewatcher_nts_()
 
 void FileWatcherHandler::stop_filewatcher_nts_()
 {
+#if defined(__linux__)
+    // Once removed, the callback is not running and it will not be called again
+    FileWatcherService::get_instance().remove_watch(watch_id_);
+    watch_id_ = 0;
+#else
     file_watch_handler_.reset();
+#endif // if defined(__linux__)
     filewatcher_started_.store(false);
 
     logInfo(UTILS_FILEWATCHER, "Stop Watching file: " << file_path_);
@@ -0,0 +1,298 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FileWatcherService.cpp
+ *
+ */
+
+#if defined(__linux__)
+
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <set>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <cpp_utils/event/FileWatcherService.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+//! Changes that call the callbacks of watches with trigger \c any_write , the ones filewatch notifies as modified.
+constexpr const uint32_t ANY_WRITE_CHANGES = IN_MODIFY;
+
+//! Changes that call the callbacks of watches with trigger \c complete_write .
+constexpr const uint32_t COMPLETE_WRITE_CHANGES = IN_CLOSE_WRITE | IN_MOVED_TO;
+
+//! Changes watched in every directory. It is the same for all of them, as watches of any trigger can share one.
+constexpr const uint32_t WATCHED_CHANGES = ANY_WRITE_CHANGES | COMPLETE_WRITE_CHANGES;
+
+FileWatcherService& FileWatcherService::get_instance() noexcept
+{
+    static FileWatcherService instance_;
+    return instance_;
+}
+
+FileWatcherService::FileWatcherService() noexcept
+    : last_id_(0)
+    , inotify_fd_(-1)
+    , wake_up_fd_(-1)
+    , stop_(false)
+{
+    inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_fd_ < 0)
+    {
+        logError(UTILS_FILEWATCHER, "Error creating inotify instance: " << std::strerror(errno) << ".");
+    }
+
+    wake_up_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wake_up_fd_ < 0)
+    {
+        logError(UTILS_FILEWATCHER,
+                "Error creating file watcher wake up descriptor: " << std::strerror(errno) << ".");
+    }
+
+    thread_ = std::thread(&FileWatcherService::thread_routine_, this);
+}
+
+FileWatcherService::~FileWatcherService() noexcept
+{
+    stop_.store(true);
+
+    const uint64_t one = 1;
+    if (write(wake_up_fd_, &one, sizeof(one)) < 0)
+    {
+        logWarning(UTILS_FILEWATCHER, "Error waking up file watcher: " << std::strerror(errno) << ".");
+    }
+    thread_.join();
+
+    // Closing the instance removes every watch descriptor
+    close(wake_up_fd_);
+    close(inotify_fd_);
+}
+
+FileWatchId FileWatcherService::add_watch(
+        const std::string& file_path,
+        FileChangeCallback callback,
+        FileWatchTrigger trigger /* = FileWatchTrigger::any_write */)
+{
+    const std::size_t separator = file_path.find_last_of('/');
+    const std::string directory = separator == std::string::npos ? "." :
+            (separator == 0 ? "/" : file_path.substr(0, separator));
+    const std::string file_name = separator == std::string::npos ? file_path : file_path.substr(separator + 1);
+
+    std::lock_guard<std::recursive_mutex> lock(watches_mutex_);
+
+    // Adding a directory already watched returns its same watch descriptor
+    const int watch_descriptor = inotify_add_watch(inotify_fd_, directory.c_str(), WATCHED_CHANGES);
+    if (watch_descriptor < 0)
+    {
+        throw utils::InitializationException(STR_ENTRY
+                      << "Error watching directory " << directory << ": " << std::strerror(errno) << ".");
+    }
+
+    ++directories_[watch_descriptor];
+
+    const FileWatchId id = ++last_id_;
+    watches_[id] = Watch{
+        watch_descriptor,
+        file_name,
+        trigger == FileWatchTrigger::complete_write ? COMPLETE_WRITE_CHANGES : ANY_WRITE_CHANGES,
+        std::move(callback)};
+
+    logDebug(UTILS_FILEWATCHER, "Watching file " << file_name << " in directory " << directory << ".");
+
+    return id;
+}
+
+void FileWatcherService::remove_watch(
+        FileWatchId id) noexcept
+{
+    // Taking the mutex waits for the callback if the dispatcher thread is running it
+    std::lock_guard<std::recursive_mutex> lock(watches_mutex_);
+
+    auto it = watches_.find(id);
+    if (it == watches_.end())
+    {
+        return;
+    }
+
+    // The directory could have been removed, and so its watch descriptor
+    auto directory = directories_.find(it->second.watch_descriptor);
+    if (directory != directories_.end() && --directory->second == 0)
+    {
+        inotify_rm_watch(inotify_fd_, directory->first);
+        directories_.erase(directory);
+    }
+
+    logDebug(UTILS_FILEWATCHER, "Stop watching file " << it->second.file_name << ".");
+
+    watches_.erase(it);
+}
+
+std::size_t FileWatcherService::size() const noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(watches_mutex_);
+    return watches_.size();
+}
+
+std::size_t FileWatcherService::directories() const noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(watches_mutex_);
+    return directories_.size();
+}
+
+void FileWatcherService::thread_routine_() noexcept
+{
+    pollfd fds[2];
+    fds[0].fd = wake_up_fd_;
+    fds[0].events = POLLIN;
+    fds[1].fd = inotify_fd_;
+    fds[1].events = POLLIN;
+
+    while (!stop_.load())
+    {
+        const int result = poll(fds, 2, -1);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            logError(UTILS_FILEWATCHER, "Error waiting for file changes: " << std::strerror(errno) << ".");
+            break;
+        }
+
+        if (stop_.load())
+        {
+            break;
+        }
+
+        if (fds[1].revents & POLLIN)
+        {
+            dispatch_();
+        }
+    }
+}
+
+void FileWatcherService::dispatch_() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(watches_mutex_);
+
+    // Each file is notified once however many changes are read
+    std::set<FileWatchId> changed;
+    alignas(inotify_event) char buffer[4096];
+
+    while (true)
+    {
+        const ssize_t bytes = read(inotify_fd_, buffer, sizeof(buffer));
+        if (bytes <= 0)
+        {
+            break;
+        }
+
+        for (ssize_t offset = 0; offset < bytes;)
+        {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            offset += sizeof(inotify_event) + event->len;
+
+            if (event->mask & IN_Q_OVERFLOW)
+            {
+                // Changes have been lost, so any file could have changed
+                logWarning(UTILS_FILEWATCHER, "File watcher queue overflowed, notifying every file watched.");
+                for (const auto& it : watches_)
+                {
+                    changed.insert(it.first);
+                }
+                continue;
+            }
+
+            if (event->mask & IN_IGNORED)
+            {
+                // Directory removed or unmounted. Its descriptor could be reused for other directory
+                if (directories_.erase(event->wd))
+                {
+                    logWarning(UTILS_FILEWATCHER, "Watched directory " << event->wd << " is no longer available.");
+                }
+                for (auto& it : watches_)
+                {
+                    if (it.second.watch_descriptor == event->wd)
+                    {
+                        it.second.watch_descriptor = -1;
+                    }
+                }
+                continue;
+            }
+
+            if (event->len == 0)
+            {
+                continue;
+            }
+
+            for (const auto& it : watches_)
+            {
+                if (it.second.watch_descriptor == event->wd && (event->mask & it.second.changes) &&
+                        it.second.file_name == event->name)
+                {
+                    changed.insert(it.first);
+                }
+            }
+        }
+    }
+
+    for (FileWatchId id : changed)
+    {
+        // The watch could have been removed by a previous callback
+        auto it = watches_.find(id);
+        if (it == watches_.end())
+        {
+            continue;
+        }
+
+        // Copy the callback and the name, as the callback could remove its own watch
+        FileChangeCallback callback = it->second.callback;
+        const std::string file_name = it->second.file_name;
+        try
+        {
+            callback(file_name);
+        }
+        catch (const std::exception& e)
+        {
+            logWarning(UTILS_FILEWATCHER,
+                    "Callback of file " << file_name << " threw an exception: " << e.what() << ".");
+        }
+        catch (...)
+        {
+            logWarning(UTILS_FILEWATCHER,
+                    "Callback of file " << file_name << " threw an unknown exception.");
+        }
+    }
+}
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+#endif // if defined(__linux__)
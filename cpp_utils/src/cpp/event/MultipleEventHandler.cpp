@@ -42,6 +42,16 @@ MultipleEventHandler::MultipleEventHandler()
 
 MultipleEventHandler::~MultipleEventHandler()
 {
+#if defined(__linux__)
+    // Stop reactor before destroying the sources it watches
+    if (reactor_)
+    {
+        reactor_->stop();
+        reactor_.reset();
+    }
+    fd_sources_registered_.clear();
+#endif // if defined(__linux__)
+
     // Destroy every object inside before this is destroyed, so in case a callback arise,
     // it does not call a deleted object
     for (std::unique_ptr<IBaseEventHandler>& event : handlers_registered_)
@@ -56,6 +66,47 @@ MultipleEventHandler::~MultipleEventHandler()
             "MultipleEventHandler has been destroyed.");
 }
 
+#if defined(__linux__)
+void MultipleEventHandler::register_fd_event_source(
+        std::unique_ptr<IFdEventSource> source)
+{
+    if (!reactor_)
+    {
+        reactor_ = std::make_unique<EventReactor>();
+        reactor_->start();
+    }
+
+    IFdEventSource* source_ptr = source.get();
+    EventReactor* reactor_ptr = reactor_.get();
+    fd_sources_registered_.push_back(std::move(source));
+
+    try
+    {
+        reactor_->add_source(
+            source_ptr->fd(),
+            [this, source_ptr, reactor_ptr]()
+            {
+                const uint32_t events = source_ptr->consume();
+                for (uint32_t i = 0; i < events; ++i)
+                {
+                    this->event_occurred_();
+                }
+
+                if (source_ptr->finished())
+                {
+                    reactor_ptr->remove_source(source_ptr->fd());
+                }
+            });
+    }
+    catch (...)
+    {
+        fd_sources_registered_.pop_back();
+        throw;
+    }
+}
+
+#endif // if defined(__linux__)
+
 } /* namespace event */
 } /* namespace utils */
 } /* namespace eprosima */
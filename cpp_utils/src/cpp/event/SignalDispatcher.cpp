@@ -0,0 +1,376 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SignalDispatcher.cpp
+ *
+ */
+
+#if defined(__linux__)
+
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <vector>
+
+#include <pthread.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <cpp_utils/event/reactor/EventReactor.hpp>
+#include <cpp_utils/event/reactor/FdEventSource.hpp>
+#include <cpp_utils/event/SignalDispatcher.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+// Only lock-free atomics can be used from a signal handler
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "Signal counters require lock-free atomics.");
+
+std::atomic<uint32_t> SignalDispatcher::signals_caught_[NSIG];
+
+std::atomic<int> SignalDispatcher::wake_up_fd_for_handler_(-1);
+
+namespace {
+
+//! Whether the current thread is dispatching signals, so it must not wait for the dispatcher.
+thread_local bool dispatching = false;
+
+} /* namespace */
+
+SignalDispatcher& SignalDispatcher::get_instance() noexcept
+{
+    static SignalDispatcher instance_;
+    return instance_;
+}
+
+SignalDispatcher::SignalDispatcher() noexcept
+    : wake_up_fd_(-1)
+    , dispatch_requests_(0)
+    , dispatched_requests_(0)
+{
+    sigemptyset(&signals_);
+
+    try
+    {
+        signal_source_.reset(new SignalFdEventSource(signals_));
+    }
+    catch (const std::exception& e)
+    {
+        logError(UTILS_SIGNALDISPATCHER, e.what());
+        return;
+    }
+
+    wake_up_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wake_up_fd_ < 0)
+    {
+        logError(UTILS_SIGNALDISPATCHER,
+                "Error creating signal dispatcher wake up descriptor: " << std::strerror(errno) << ".");
+        signal_source_.reset();
+        return;
+    }
+
+    try
+    {
+        reactor_.reset(new EventReactor());
+        reactor_->add_source(
+            signal_source_->fd(),
+            [this]()
+            {
+                consume();
+            });
+        reactor_->add_source(
+            wake_up_fd_,
+            [this]()
+            {
+                wake_up_routine_();
+            });
+
+        // The dispatcher thread never handles signals, so the kernel delivers them to other thread or to the
+        // descriptor. It inherits the mask of the thread that creates it
+        sigset_t all_signals;
+        sigset_t previous_mask;
+        sigfillset(&all_signals);
+        pthread_sigmask(SIG_BLOCK, &all_signals, &previous_mask);
+        reactor_->start();
+        pthread_sigmask(SIG_SETMASK, &previous_mask, nullptr);
+    }
+    catch (const std::exception& e)
+    {
+        logError(UTILS_SIGNALDISPATCHER, "Error starting signal dispatcher thread: " << e.what());
+        reactor_.reset();
+        close(wake_up_fd_);
+        wake_up_fd_ = -1;
+        signal_source_.reset();
+        return;
+    }
+
+    wake_up_fd_for_handler_.store(wake_up_fd_);
+}
+
+SignalDispatcher::~SignalDispatcher() noexcept
+{
+    // Stop the dispatcher thread before the descriptors it watches are closed
+    reactor_.reset();
+
+    {
+        std::lock_guard<std::recursive_mutex> lock(handlers_mutex_);
+        for (const auto& it : handlers_)
+        {
+            ::signal(it.first, SIG_DFL);
+        }
+        handlers_.clear();
+    }
+
+    wake_up_fd_for_handler_.store(-1);
+    if (wake_up_fd_ >= 0)
+    {
+        close(wake_up_fd_);
+    }
+    signal_source_.reset();
+}
+
+void SignalDispatcher::add_signal(
+        int signal,
+        SignalHandler handler)
+{
+    if (signal <= 0 || signal >= NSIG)
+    {
+        throw utils::InitializationException(STR_ENTRY << "Signal " << signal << " is not valid.");
+    }
+
+    if (!reactor_)
+    {
+        throw utils::InitializationException(STR_ENTRY << "Signal " << signal
+                                                       << " cannot be handled: signal dispatcher not initialized.");
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(handlers_mutex_);
+
+    sigset_t signals = signals_;
+    sigaddset(&signals, signal);
+    signal_source_->update_signals(signals);
+
+    handlers_[signal] = std::move(handler);
+    signals_ = signals;
+
+    struct sigaction action {};
+    action.sa_handler = &SignalDispatcher::signal_handler_function_;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    if (sigaction(signal, &action, nullptr) != 0)
+    {
+        throw utils::InitializationException(STR_ENTRY << "Error setting handler of signal " << signal << ": "
+                                                       << std::strerror(errno) << ".");
+    }
+
+    logDebug(UTILS_SIGNALDISPATCHER, "Dispatching signal " << signal << ".");
+}
+
+void SignalDispatcher::remove_signal(
+        int signal) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(handlers_mutex_);
+
+    if (!handlers_.erase(signal))
+    {
+        return;
+    }
+
+    ::signal(signal, SIG_DFL);
+    sigdelset(&signals_, signal);
+    try
+    {
+        signal_source_->update_signals(signals_);
+    }
+    catch (const std::exception& e)
+    {
+        // The signal has no handler anymore, so if it is still read from the descriptor it is ignored
+        logWarning(UTILS_SIGNALDISPATCHER, e.what());
+    }
+    signals_caught_[signal].store(0);
+
+    logDebug(UTILS_SIGNALDISPATCHER, "Stop dispatching signal " << signal << ".");
+}
+
+void SignalDispatcher::block_signals() noexcept
+{
+    sigset_t signals;
+    {
+        std::lock_guard<std::recursive_mutex> lock(handlers_mutex_);
+        signals = signals_;
+    }
+
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+}
+
+int SignalDispatcher::fd() const noexcept
+{
+    return signal_source_ ? signal_source_->fd() : -1;
+}
+
+uint32_t SignalDispatcher::consume() noexcept
+{
+    if (!signal_source_)
+    {
+        return 0;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(handlers_mutex_);
+
+    const bool was_dispatching = dispatching;
+    dispatching = true;
+
+    // Signals queued in the descriptor
+    uint32_t dispatched = 0;
+    signal_source_->consume(
+        [this, &dispatched](int signal)
+        {
+            dispatched += call_handler_nts_(signal, 1);
+        });
+
+    // Signals caught by the handler. Handlers could remove signals, so the list is copied before calling them
+    std::vector<int> signals;
+    for (const auto& it : handlers_)
+    {
+        signals.push_back(it.first);
+    }
+
+    for (int signal : signals)
+    {
+        const uint32_t times = signals_caught_[signal].exchange(0);
+        if (times > 0)
+        {
+            dispatched += call_handler_nts_(signal, times);
+        }
+    }
+
+    dispatching = was_dispatching;
+
+    return dispatched;
+}
+
+void SignalDispatcher::wait_dispatched() noexcept
+{
+    if (!reactor_ || dispatching)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(dispatch_mutex_);
+
+    const uint64_t request = ++dispatch_requests_;
+
+    const uint64_t one = 1;
+    if (write(wake_up_fd_, &one, sizeof(one)) < 0)
+    {
+        logWarning(UTILS_SIGNALDISPATCHER,
+                "Error waking up signal dispatcher: " << std::strerror(errno) << ".");
+        return;
+    }
+
+    dispatch_cv_.wait(
+        lock,
+        [this, request]()
+        {
+            return dispatched_requests_ >= request;
+        });
+}
+
+void SignalDispatcher::wake_up_routine_() noexcept
+{
+    uint64_t value;
+    while (read(wake_up_fd_, &value, sizeof(value)) > 0)
+    {
+        // Drain every wake up
+    }
+
+    // Requests done before draining are answered by this dispatch. Later ones wake up this routine again
+    uint64_t requests;
+    {
+        std::lock_guard<std::mutex> lock(dispatch_mutex_);
+        requests = dispatch_requests_;
+    }
+
+    consume();
+
+    {
+        std::lock_guard<std::mutex> lock(dispatch_mutex_);
+        dispatched_requests_ = requests;
+    }
+    dispatch_cv_.notify_all();
+}
+
+uint32_t SignalDispatcher::call_handler_nts_(
+        int signal,
+        uint32_t times) noexcept
+{
+    auto it = handlers_.find(signal);
+    if (it == handlers_.end())
+    {
+        return 0;
+    }
+
+    // Copy the handler, as it could remove itself while being called
+    SignalHandler handler = it->second;
+    for (uint32_t i = 0; i < times; ++i)
+    {
+        try
+        {
+            handler();
+        }
+        catch (const std::exception& e)
+        {
+            logWarning(UTILS_SIGNALDISPATCHER,
+                    "Handler of signal " << signal << " threw an exception: " << e.what() << ".");
+        }
+        catch (...)
+        {
+            logWarning(UTILS_SIGNALDISPATCHER,
+                    "Handler of signal " << signal << " threw an unknown exception.");
+        }
+    }
+
+    return times;
+}
+
+void SignalDispatcher::signal_handler_function_(
+        int signal) noexcept
+{
+    // Only async-signal-safe operations are allowed here: no locks, no allocations and no logging
+    const int saved_errno = errno;
+
+    signals_caught_[signal].fetch_add(1);
+
+    const int fd = wake_up_fd_for_handler_.load();
+    if (fd >= 0)
+    {
+        const uint64_t one = 1;
+        ssize_t result = write(fd, &one, sizeof(one));
+        static_cast<void>(result);
+    }
+
+    errno = saved_errno;
+}
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+#endif // if defined(__linux__)
@@ -23,17 +23,29 @@ namespace utils {
 namespace event {
 
 StdinEventHandler::StdinEventHandler(
-        std::function<void(std::string)> callback,
+        std::function<void(const std::string&)> callback,
         const bool read_lines /* = true */,
         const int lines_to_read /* = 0 */,
         std::istream& source /* = std::cin */)
     : activation_times_(0, lines_to_read, false)
-    , source_(source)
+    , source_(&source)
     , read_lines_(read_lines)
 {
     set_callback(callback);
 }
 
+StdinEventHandler::StdinEventHandler(
+        std::function<void(const std::string&)> callback,
+        std::unique_ptr<FdLineReader> reader,
+        const int lines_to_read /* = 0 */)
+    : activation_times_(0, lines_to_read, false)
+    , source_(nullptr)
+    , reader_(std::move(reader))
+    , read_lines_(true)
+{
+    set_callback(callback);
+}
+
 StdinEventHandler::~StdinEventHandler()
 {
     unset_callback();
@@ -46,19 +58,27 @@ void StdinEventHandler::read_one_more_line()
 
 void StdinEventHandler::stdin_listener_thread_routine_() noexcept
 {
+    // String reused for every line, so its memory is not allocated each time
+    std::string read_str;
+
     auto awake_reason = activation_times_.wait_and_decrement();
     while (awake_reason == AwakeReason::condition_met)
     {
-        std::string read_str;
+        // If the stream has already failed, it is not cleared by getline nor operator >>
+        read_str.clear();
 
         // Read lines or separated by spaces
-        if (read_lines_)
+        if (reader_)
+        {
+            reader_->read_line(read_str);
+        }
+        else if (read_lines_)
         {
-            getline(source_, read_str);
+            getline(*source_, read_str);
         }
         else
         {
-            source_ >> read_str;
+            *source_ >> read_str;
         }
         event_occurred_(read_str);
 
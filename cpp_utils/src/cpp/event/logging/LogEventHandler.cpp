@@ -17,6 +17,8 @@
  *
  */
 
+#include <algorithm>
+
 #include <cpp_utils/Log.hpp>
 #include <cpp_utils/event/LogEventHandler.hpp>
 #include <cpp_utils/exception/InitializationException.hpp>
@@ -27,7 +29,11 @@ namespace eprosima {
 namespace utils {
 namespace event {
 
-LogEventHandler::LogEventHandler()
+constexpr std::size_t LogEventHandler::DEFAULT_MAX_ENTRIES;
+
+LogEventHandler::LogEventHandler(
+        LogRetention retention /* = LogRetention::last_entries */,
+        std::size_t max_entries /* = DEFAULT_MAX_ENTRIES */)
     : EventHandler<utils::Log::Entry>()
     , connection_callback_(
         new LogConsumerConnectionCallbackType(
@@ -36,14 +42,25 @@ LogEventHandler::LogEventHandler()
             {
                 this->consume_(entry);
             }))
+    // A ring of no entries keeps nothing
+    , retention_(retention == LogRetention::last_entries && max_entries == 0 ? LogRetention::none : retention)
+    , n_entries_consumed_(0)
 {
+    // Allocate the ring once
+    if (retention_ == LogRetention::last_entries)
+    {
+        entries_consumed_.resize(max_entries);
+    }
+
     // Create LogConsumer and register it
     Log::RegisterConsumer(std::make_unique<LogConsumerConnection>(connection_callback_.lease()));
 }
 
 LogEventHandler::LogEventHandler(
-        std::function<void(utils::Log::Entry)> callback)
-    : LogEventHandler()
+        std::function<void(const utils::Log::Entry&)> callback,
+        LogRetention retention /* = LogRetention::last_entries */,
+        std::size_t max_entries /* = DEFAULT_MAX_ENTRIES */)
+    : LogEventHandler(retention, max_entries)
 {
     // Set callback
     set_callback(callback);
@@ -54,12 +71,56 @@ LogEventHandler::~LogEventHandler()
     unset_callback();
 }
 
+std::vector<utils::Log::Entry> LogEventHandler::retained_entries() const
+{
+    std::lock_guard<std::mutex> lock(entries_mutex_);
+
+    if (retention_ != LogRetention::last_entries || n_entries_consumed_ <= entries_consumed_.size())
+    {
+        return std::vector<utils::Log::Entry>(
+            entries_consumed_.begin(),
+            entries_consumed_.begin() + static_cast<std::ptrdiff_t>(
+                std::min<uint64_t>(n_entries_consumed_, entries_consumed_.size())));
+    }
+
+    // The ring is full: the oldest entry is the next one to overwrite
+    const auto oldest = entries_consumed_.begin() +
+            static_cast<std::ptrdiff_t>(n_entries_consumed_ % entries_consumed_.size());
+
+    std::vector<utils::Log::Entry> entries;
+    entries.reserve(entries_consumed_.size());
+    entries.insert(entries.end(), oldest, entries_consumed_.end());
+    entries.insert(entries.end(), entries_consumed_.begin(), oldest);
+    return entries;
+}
+
+uint64_t LogEventHandler::consumed_entries() const noexcept
+{
+    std::lock_guard<std::mutex> lock(entries_mutex_);
+    return n_entries_consumed_;
+}
+
 void LogEventHandler::consume_(
         const utils::Log::Entry& entry)
 {
     {
-        std::lock_guard<SharedAtomicable<std::vector<utils::Log::Entry>>> lock(entries_consumed_);
-        entries_consumed_.push_back(entry);
+        std::lock_guard<std::mutex> lock(entries_mutex_);
+
+        switch (retention_)
+        {
+            case LogRetention::last_entries:
+                entries_consumed_[n_entries_consumed_ % entries_consumed_.size()] = entry;
+                break;
+
+            case LogRetention::unbounded:
+                entries_consumed_.push_back(entry);
+                break;
+
+            default:
+                break;
+        }
+
+        n_entries_consumed_++;
     }
 
     event_occurred_(entry);
@@ -24,9 +24,11 @@ namespace utils {
 namespace event {
 
 LogSevereEventHandler::LogSevereEventHandler(
-        std::function<void(utils::Log::Entry)> callback,
-        utils::Log::Kind threshold /* = utils::Log::Kind::Warning */)
-    : LogEventHandler(callback)
+        std::function<void(const utils::Log::Entry&)> callback,
+        utils::Log::Kind threshold /* = utils::Log::Kind::Warning */,
+        LogRetention retention /* = LogRetention::last_entries */,
+        std::size_t max_entries /* = DEFAULT_MAX_ENTRIES */)
+    : LogEventHandler(callback, retention, max_entries)
     , threshold_(threshold)
 {
     // If threshold is lower than default log level (ERROR) set the filter lower
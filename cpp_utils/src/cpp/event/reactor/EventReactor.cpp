@@ -0,0 +1,256 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file EventReactor.cpp
+ *
+ */
+
+#if defined(__linux__)
+
+#include <cerrno>
+#include <cstring>
+#include <exception>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/exception/ValueNotAllowedException.hpp>
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <cpp_utils/event/reactor/EventReactor.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+//! Maximum number of descriptors dispatched per wake up of the reactor thread.
+constexpr const int MAX_EVENTS_PER_WAIT = 16;
+
+EventReactor::EventReactor()
+    : epoll_fd_(-1)
+    , wakeup_fd_(-1)
+    , running_fd_(-1)
+    , removers_waiting_(0)
+    , running_(false)
+{
+    epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd_ < 0)
+    {
+        throw utils::InitializationException(STR_ENTRY
+                      << "Error creating epoll instance: " << std::strerror(errno) << ".");
+    }
+
+    wakeup_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeup_fd_ < 0)
+    {
+        close(epoll_fd_);
+        throw utils::InitializationException(STR_ENTRY
+                      << "Error creating reactor wake up descriptor: " << std::strerror(errno) << ".");
+    }
+
+    epoll_event event {};
+    event.events = EPOLLIN;
+    event.data.fd = wakeup_fd_;
+    if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wakeup_fd_, &event) < 0)
+    {
+        close(wakeup_fd_);
+        close(epoll_fd_);
+        throw utils::InitializationException(STR_ENTRY
+                      << "Error watching reactor wake up descriptor: " << std::strerror(errno) << ".");
+    }
+
+    logDebug(UTILS_EVENTREACTOR, "Event Reactor created.");
+}
+
+EventReactor::~EventReactor()
+{
+    stop();
+
+    close(wakeup_fd_);
+    close(epoll_fd_);
+
+    logDebug(UTILS_EVENTREACTOR, "Event Reactor destroyed.");
+}
+
+void EventReactor::add_source(
+        int fd,
+        std::function<void()> on_readable)
+{
+    std::lock_guard<std::mutex> lock(sources_mutex_);
+
+    if (sources_.find(fd) != sources_.end())
+    {
+        throw utils::ValueNotAllowedException(STR_ENTRY << "Descriptor " << fd << " already registered in reactor.");
+    }
+
+    epoll_event event {};
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+    if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) < 0)
+    {
+        throw utils::InitializationException(STR_ENTRY
+                      << "Error watching descriptor " << fd << ": " << std::strerror(errno) << ".");
+    }
+
+    sources_[fd] = std::make_shared<const std::function<void()>>(std::move(on_readable));
+
+    logDebug(UTILS_EVENTREACTOR, "Descriptor " << fd << " registered in Event Reactor.");
+}
+
+void EventReactor::remove_source(
+        int fd) noexcept
+{
+    std::unique_lock<std::mutex> lock(sources_mutex_);
+
+    auto it = sources_.find(fd);
+    if (it == sources_.end())
+    {
+        return;
+    }
+
+    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+    sources_.erase(it);
+
+    // Wait for the routine if the reactor thread is running it, unless this is called from the routine itself
+    if (std::this_thread::get_id() != thread_.get_id())
+    {
+        // Counted before checking running_fd_, so the reactor thread notifies if it clears it afterwards
+        removers_waiting_++;
+        routine_finished_cv_.wait(lock, [this, fd]()
+                {
+                    return running_fd_.load() != fd;
+                });
+        removers_waiting_--;
+    }
+
+    logDebug(UTILS_EVENTREACTOR, "Descriptor " << fd << " removed from Event Reactor.");
+}
+
+void EventReactor::start()
+{
+    if (!running_.exchange(true))
+    {
+        thread_ = std::thread(&EventReactor::run_, this);
+    }
+}
+
+void EventReactor::stop() noexcept
+{
+    if (running_.exchange(false))
+    {
+        // Wake up reactor thread so it sees it must stop
+        const uint64_t wakeup = 1;
+        if (write(wakeup_fd_, &wakeup, sizeof(wakeup)) < 0)
+        {
+            logWarning(UTILS_EVENTREACTOR, "Error waking up Event Reactor thread: " << std::strerror(errno) << ".");
+        }
+
+        thread_.join();
+    }
+}
+
+std::size_t EventReactor::size() const noexcept
+{
+    std::lock_guard<std::mutex> lock(sources_mutex_);
+    return sources_.size();
+}
+
+void EventReactor::run_() noexcept
+{
+    epoll_event events[MAX_EVENTS_PER_WAIT];
+
+    while (running_.load())
+    {
+        const int n_events = epoll_wait(epoll_fd_, events, MAX_EVENTS_PER_WAIT, -1);
+
+        if (n_events < 0)
+        {
+            if (errno != EINTR)
+            {
+                logError(UTILS_EVENTREACTOR, "Error waiting in Event Reactor: " << std::strerror(errno) << ".");
+                return;
+            }
+            continue;
+        }
+
+        for (int i = 0; i < n_events && running_.load(); ++i)
+        {
+            const int fd = events[i].data.fd;
+
+            if (fd == wakeup_fd_)
+            {
+                uint64_t value;
+                if (read(wakeup_fd_, &value, sizeof(value)) < 0)
+                {
+                    // Already consumed, nothing to do
+                }
+                continue;
+            }
+
+            // Take a reference to the routine, as it runs without the lock and it could remove its own source
+            std::shared_ptr<const std::function<void()>> routine;
+            {
+                std::lock_guard<std::mutex> lock(sources_mutex_);
+
+                // The source could have been removed after epoll_wait returned
+                auto it = sources_.find(fd);
+                if (it == sources_.end())
+                {
+                    continue;
+                }
+
+                routine = it->second;
+                running_fd_.store(fd);
+            }
+
+            try
+            {
+                (*routine)();
+            }
+            catch (const std::exception& e)
+            {
+                logWarning(UTILS_EVENTREACTOR,
+                        "Routine of descriptor " << fd << " threw an exception: " << e.what() << ".");
+            }
+            catch (...)
+            {
+                logWarning(UTILS_EVENTREACTOR,
+                        "Routine of descriptor " << fd << " threw an unknown exception.");
+            }
+
+            // Release the reference before clearing running_fd_, so a removed routine does not outlive remove_source
+            routine.reset();
+            running_fd_.store(-1);
+
+            // Only lock and notify if some remove_source is waiting for this routine
+            if (removers_waiting_.load() != 0)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(sources_mutex_);
+                }
+                routine_finished_cv_.notify_all();
+            }
+        }
+    }
+}
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+#endif // if defined(__linux__)
@@ -0,0 +1,303 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FdEventSource.cpp
+ *
+ */
+
+#if defined(__linux__)
+
+#include <cerrno>
+#include <climits>
+#include <csignal>
+#include <cstring>
+
+#include <pthread.h>
+#include <sys/inotify.h>
+#include <sys/signalfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <cpp_utils/event/reactor/FdEventSource.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+
+/////////////////////////
+// TIMER
+/////////////////////////
+
+TimerFdEventSource::TimerFdEventSource(
+        utils::Duration_ms period_time)
+    : fd_(-1)
+{
+    if (period_time <= 0)
+    {
+        throw utils::InitializationException("Timer event source could no be created with period time 0");
+    }
+
+    fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (fd_ < 0)
+    {
+        throw utils::InitializationException(STR_ENTRY << "Error creating timer: " << std::strerror(errno) << ".");
+    }
+
+    itimerspec period {};
+    period.it_interval.tv_sec = period_time / 1000;
+    period.it_interval.tv_nsec = (period_time % 1000) * 1000000L;
+    period.it_value = period.it_interval;
+
+    if (timerfd_settime(fd_, 0, &period, nullptr) < 0)
+    {
+        close(fd_);
+        throw utils::InitializationException(STR_ENTRY << "Error starting timer: " << std::strerror(errno) << ".");
+    }
+}
+
+TimerFdEventSource::~TimerFdEventSource()
+{
+    close(fd_);
+}
+
+int TimerFdEventSource::fd() const noexcept
+{
+    return fd_;
+}
+
+uint32_t TimerFdEventSource::consume() noexcept
+{
+    uint64_t expirations = 0;
+    if (read(fd_, &expirations, sizeof(expirations)) != sizeof(expirations))
+    {
+        return 0;
+    }
+    return expirations > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(expirations);
+}
+
+/////////////////////////
+// SIGNAL
+/////////////////////////
+
+SignalFdEventSource::SignalFdEventSource(
+        Signal signal)
+    : fd_(-1)
+{
+    sigset_t mask;
+    sigemptyset(&mask);
+    sigaddset(&mask, static_cast<SignalType>(signal));
+
+    // Signal must be blocked so it is not handled by the default handler but queued in the descriptor
+    int result = pthread_sigmask(SIG_BLOCK, &mask, nullptr);
+    if (result != 0)
+    {
+        throw utils::InitializationException(STR_ENTRY << "Error blocking signal " << static_cast<SignalType>(signal)
+                                                       << ": " << std::strerror(result) << ".");
+    }
+
+    fd_ = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+    if (fd_ < 0)
+    {
+        throw utils::InitializationException(STR_ENTRY << "Error creating descriptor for signal "
+                                                       << static_cast<SignalType>(signal) << ": "
+                                                       << std::strerror(errno) << ".");
+    }
+}
+
+SignalFdEventSource::SignalFdEventSource(
+        const sigset_t& signals)
+    : fd_(-1)
+{
+    fd_ = signalfd(-1, &signals, SFD_NONBLOCK | SFD_CLOEXEC);
+    if (fd_ < 0)
+    {
+        throw utils::InitializationException(STR_ENTRY << "Error creating signal descriptor: "
+                                                       << std::strerror(errno) << ".");
+    }
+}
+
+SignalFdEventSource::~SignalFdEventSource()
+{
+    close(fd_);
+}
+
+int SignalFdEventSource::fd() const noexcept
+{
+    return fd_;
+}
+
+uint32_t SignalFdEventSource::consume() noexcept
+{
+    return consume(nullptr);
+}
+
+uint32_t SignalFdEventSource::consume(
+        const std::function<void(int signal)>& on_signal) noexcept
+{
+    uint32_t signals = 0;
+    signalfd_siginfo info[8];
+
+    while (true)
+    {
+        const ssize_t bytes = read(fd_, info, sizeof(info));
+        if (bytes <= 0)
+        {
+            break;
+        }
+
+        const std::size_t n_signals = static_cast<std::size_t>(bytes) / sizeof(signalfd_siginfo);
+        if (on_signal)
+        {
+            for (std::size_t i = 0; i < n_signals; ++i)
+            {
+                on_signal(static_cast<int>(info[i].ssi_signo));
+            }
+        }
+        signals += static_cast<uint32_t>(n_signals);
+    }
+
+    return signals;
+}
+
+void SignalFdEventSource::update_signals(
+        const sigset_t& signals)
+{
+    // The descriptor is always valid here, so this never creates a new one
+    if (signalfd(fd_, &signals, 0) < 0)
+    {
+        throw utils::InitializationException(STR_ENTRY << "Error updating signals of descriptor " << fd_ << ": "
+                                                       << std::strerror(errno) << ".");
+    }
+}
+
+/////////////////////////
+// STDIN
+/////////////////////////
+
+StdinFdEventSource::StdinFdEventSource(
+        int fd /* = 0 */)
+    : fd_(fd)
+    , finished_(false)
+{
+}
+
+int StdinFdEventSource::fd() const noexcept
+{
+    return fd_;
+}
+
+uint32_t StdinFdEventSource::consume() noexcept
+{
+    // Only one read is done, as the descriptor may be blocking. If more data is available, it is readable again
+    char buffer[4096];
+    const ssize_t bytes = read(fd_, buffer, sizeof(buffer));
+
+    if (bytes <= 0)
+    {
+        finished_ = bytes == 0 || (errno != EINTR && errno != EAGAIN);
+        return 0;
+    }
+
+    uint32_t lines = 0;
+    for (ssize_t i = 0; i < bytes; ++i)
+    {
+        if (buffer[i] == '\n')
+        {
+            ++lines;
+        }
+    }
+    return lines;
+}
+
+bool StdinFdEventSource::finished() const noexcept
+{
+    return finished_;
+}
+
+/////////////////////////
+// INOTIFY
+/////////////////////////
+
+InotifyFdEventSource::InotifyFdEventSource(
+        const std::string& file_path)
+    : fd_(-1)
+{
+    const std::size_t separator = file_path.find_last_of('/');
+    const std::string directory = separator == std::string::npos ? "." :
+            (separator == 0 ? "/" : file_path.substr(0, separator));
+    file_name_ = separator == std::string::npos ? file_path : file_path.substr(separator + 1);
+
+    fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd_ < 0)
+    {
+        throw utils::InitializationException(STR_ENTRY
+                      << "Error creating inotify instance: " << std::strerror(errno) << ".");
+    }
+
+    if (inotify_add_watch(fd_, directory.c_str(), IN_MODIFY | IN_CREATE | IN_MOVED_TO) < 0)
+    {
+        close(fd_);
+        throw utils::InitializationException(STR_ENTRY
+                      << "Error watching directory " << directory << ": " << std::strerror(errno) << ".");
+    }
+}
+
+InotifyFdEventSource::~InotifyFdEventSource()
+{
+    close(fd_);
+}
+
+int InotifyFdEventSource::fd() const noexcept
+{
+    return fd_;
+}
+
+uint32_t InotifyFdEventSource::consume() noexcept
+{
+    // Several modifications read at once (e.g. a file written in chunks) are notified as a single event
+    bool modified = false;
+    alignas(inotify_event) char buffer[4096];
+
+    while (true)
+    {
+        const ssize_t bytes = read(fd_, buffer, sizeof(buffer));
+        if (bytes <= 0)
+        {
+            break;
+        }
+
+        for (ssize_t offset = 0; offset < bytes;)
+        {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            if (event->len > 0 && file_name_ == event->name)
+            {
+                modified = true;
+            }
+            offset += sizeof(inotify_event) + event->len;
+        }
+    }
+
+    return modified ? 1 : 0;
+}
+
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+#endif // if defined(__linux__)
@@ -0,0 +1,185 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FdLineReader.cpp
+ */
+
+#include <cerrno>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif // if defined(_WIN32)
+
+#include <cpp_utils/file/FdLineReader.hpp>
+
+namespace eprosima {
+namespace utils {
+
+constexpr std::size_t FdLineReader::DEFAULT_CHUNK_SIZE;
+
+FdLineReader::FdLineReader(
+        int fd /* = 0 */,
+        std::size_t chunk_size /* = DEFAULT_CHUNK_SIZE */)
+    : fd_(fd)
+    , chunk_size_(chunk_size > 0 ? chunk_size : DEFAULT_CHUNK_SIZE)
+    , buffer_(chunk_size_)
+    , begin_(0)
+    , end_(0)
+    , end_of_stream_(false)
+{
+}
+
+bool FdLineReader::next_line(
+        const char*& data,
+        std::size_t& size)
+{
+    // Bytes after begin_ already searched for a line break, so they are not searched again after reading more
+    std::size_t searched = 0;
+
+    while (true)
+    {
+        const char* line = buffer_.data() + begin_;
+        const void* line_break = std::memchr(line + searched, '\n', end_ - begin_ - searched);
+
+        if (line_break != nullptr)
+        {
+            data = line;
+            size = static_cast<const char*>(line_break) - line;
+            begin_ += size + 1;
+            return true;
+        }
+
+        searched = end_ - begin_;
+
+        if (end_of_stream_ || !fill_buffer_())
+        {
+            // Last line without line break
+            if (begin_ < end_)
+            {
+                data = buffer_.data() + begin_;
+                size = end_ - begin_;
+                begin_ = end_;
+                return true;
+            }
+            return false;
+        }
+    }
+}
+
+bool FdLineReader::read_line(
+        std::string& line)
+{
+    const char* data;
+    std::size_t size;
+
+    if (!next_line(data, size))
+    {
+        line.clear();
+        return false;
+    }
+
+    line.assign(data, size);
+    return true;
+}
+
+bool FdLineReader::finished() const noexcept
+{
+    return end_of_stream_ && begin_ == end_;
+}
+
+bool FdLineReader::fill_buffer_()
+{
+    // Move the data not given yet (at most a partial line) to the beginning, to read after it
+    if (begin_ > 0)
+    {
+        std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+        end_ -= begin_;
+        begin_ = 0;
+    }
+
+    // A line longer than the buffer
+    if (end_ == buffer_.size())
+    {
+        buffer_.resize(buffer_.size() * 2);
+    }
+
+    const std::size_t available = buffer_.size() - end_;
+    const std::size_t to_read = available < chunk_size_ ? available : chunk_size_;
+
+    while (true)
+    {
+#if defined(_WIN32)
+        const int bytes = _read(fd_, buffer_.data() + end_, static_cast<unsigned int>(to_read));
+#else
+        const ssize_t bytes = read(fd_, buffer_.data() + end_, to_read);
+#endif // if defined(_WIN32)
+
+        if (bytes > 0)
+        {
+            end_ += static_cast<std::size_t>(bytes);
+            return true;
+        }
+
+        if (bytes < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        end_of_stream_ = true;
+        return false;
+    }
+}
+
+std::size_t split_line(
+        const char* data,
+        std::size_t size,
+        char delimiter,
+        std::vector<std::string>& tokens)
+{
+    std::size_t n_tokens = 0;
+    const char* const end = data + size;
+    const char* start = data;
+
+    while (true)
+    {
+        const void* found = std::memchr(start, delimiter, end - start);
+        const char* token_end = found != nullptr ? static_cast<const char*>(found) : end;
+
+        if (n_tokens < tokens.size())
+        {
+            tokens[n_tokens].assign(start, token_end - start);
+        }
+        else
+        {
+            tokens.emplace_back(start, token_end - start);
+        }
+        ++n_tokens;
+
+        if (found == nullptr)
+        {
+            break;
+        }
+        start = token_end + 1;
+    }
+
+    tokens.resize(n_tokens);
+    return n_tokens;
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -18,9 +18,24 @@
 
 #include <iostream> // TODO remove
 #include <fstream>
+#include <iterator>
+#include <vector>
+
+#if defined(_WIN32)
+#include <sys/stat.h>
+#include <sys/types.h>
+#else
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // if defined(_WIN32)
 
 #include <cpp_utils/exception/PreconditionNotMet.hpp>
 #include <cpp_utils/file/file_utils.hpp>
+#include <cpp_utils/math/math_extension.hpp>
 #include <cpp_utils/utils.hpp>
 
 namespace eprosima {
@@ -74,5 +89,105 @@ std::vector<std::string> file_to_strings(
     return result;
 }
 
+#if defined(_WIN32)
+
+FileSnapshot file_to_snapshot(
+        const char* file_name)
+{
+    struct _stat64 status;
+    std::ifstream file(file_name, std::ios::binary);
+
+    if (!file.is_open() || _stat64(file_name, &status) != 0)
+    {
+        throw PreconditionNotMet(
+                  STR_ENTRY << "File <" << file_name << "> could not be read.");
+    }
+
+    const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    FileSnapshot snapshot;
+    snapshot.content_hash = hash_64(content.data(), content.size());
+    snapshot.size = content.size();
+    snapshot.modification_time = std::chrono::system_clock::from_time_t(status.st_mtime);
+    return snapshot;
+}
+
+#else
+
+FileSnapshot file_to_snapshot(
+        const char* file_name)
+{
+    // Hash and metadata are read from the same descriptor, so they belong to the same file even if it is replaced
+    const int fd = open(file_name, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        throw PreconditionNotMet(
+                  STR_ENTRY << "File <" << file_name << "> could not be read: " << std::strerror(errno) << ".");
+    }
+
+    struct stat status;
+    if (fstat(fd, &status) != 0)
+    {
+        const int error = errno;
+        close(fd);
+        throw PreconditionNotMet(
+                  STR_ENTRY << "File <" << file_name << "> could not be read: " << std::strerror(error) << ".");
+    }
+
+    FileSnapshot snapshot;
+
+#if defined(__APPLE__)
+    const struct timespec& modification = status.st_mtimespec;
+#else
+    const struct timespec& modification = status.st_mtim;
+#endif // if defined(__APPLE__)
+    snapshot.modification_time = Timestamp(std::chrono::duration_cast<Timestamp::duration>(
+                        std::chrono::seconds(modification.tv_sec) + std::chrono::nanoseconds(modification.tv_nsec)));
+
+    // Read until the end of the file, whatever its size is now, in a buffer kept for the next calls.
+    // One more byte than its size is reserved, so reading the end of a file that has not grown does not resize it
+    thread_local std::vector<char> content;
+    const std::size_t expected_size = static_cast<std::size_t>(status.st_size) + 1;
+    if (content.size() < expected_size)
+    {
+        content.resize(expected_size);
+    }
+
+    std::size_t length = 0;
+    while (true)
+    {
+        if (length == content.size())
+        {
+            content.resize(content.size() * 2);
+        }
+
+        const ssize_t read_bytes = read(fd, content.data() + length, content.size() - length);
+        if (read_bytes < 0)
+        {
+            const int error = errno;
+            if (error == EINTR)
+            {
+                continue;
+            }
+            close(fd);
+            throw PreconditionNotMet(
+                      STR_ENTRY << "File <" << file_name << "> could not be read: " << std::strerror(error) << ".");
+        }
+        if (read_bytes == 0)
+        {
+            break;
+        }
+        length += static_cast<std::size_t>(read_bytes);
+    }
+    close(fd);
+
+    snapshot.content_hash = hash_64(content.data(), length);
+    snapshot.size = length;
+
+    return snapshot;
+}
+
+#endif // if defined(_WIN32)
+
 } /* namespace utils */
 } /* namespace eprosima */
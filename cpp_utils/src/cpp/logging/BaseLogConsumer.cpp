@@ -17,33 +17,108 @@
  *
  */
 
-#include <regex>
+#include <algorithm>
+#include <cstring>
 
 #include <cpp_utils/logging/BaseLogConsumer.hpp>
 
 namespace eprosima {
 namespace utils {
 
+namespace {
+
+//! Characters with a special meaning in ECMAScript regex. Filters without them are matched as substrings.
+constexpr const char* REGEX_METACHARACTERS = "^$\\.*+?()[]{}|";
+
+} /* namespace */
+
+BaseLogConsumer::CompiledFilter::CompiledFilter(
+        const std::string& pattern)
+    : mode(Mode::regex)
+    , pattern(pattern)
+{
+    if (pattern.empty())
+    {
+        mode = Mode::match_all;
+    }
+    else if (pattern.find_first_of(REGEX_METACHARACTERS) == std::string::npos)
+    {
+        mode = Mode::substring;
+    }
+    else
+    {
+        regex = std::regex(pattern);
+    }
+}
+
+bool BaseLogConsumer::CompiledFilter::matches(
+        const char* begin,
+        const char* end) const
+{
+    switch (mode)
+    {
+        case Mode::match_all:
+            return true;
+
+        case Mode::substring:
+            return std::search(begin, end, pattern.begin(), pattern.end()) != end;
+
+        default:
+            return std::regex_search(begin, end, regex);
+    }
+}
+
 BaseLogConsumer::BaseLogConsumer(
         const BaseLogConfiguration* log_configuration)
     : filter_(log_configuration->filter)
+    , compiled_filter_(compile_filter_(log_configuration->filter))
     , verbosity_(log_configuration->verbosity)
 {
 }
 
+void BaseLogConsumer::set_filter(
+        const LogFilter& filter)
+{
+    // Compile before changing anything, so an invalid regex leaves the filter as it was
+    std::shared_ptr<const CompiledLogFilter> compiled_filter = compile_filter_(filter);
+
+    filter_ = filter;
+    std::atomic_store(&compiled_filter_, compiled_filter);
+}
+
+std::shared_ptr<const BaseLogConsumer::CompiledLogFilter> BaseLogConsumer::compile_filter_(
+        const LogFilter& filter)
+{
+    auto compiled_filter = std::make_shared<CompiledLogFilter>();
+    for (const auto& it : filter)
+    {
+        compiled_filter->emplace(it.first, CompiledFilter(it.second.get_value()));
+    }
+    return compiled_filter;
+}
+
 bool BaseLogConsumer::accept_entry_(
         const Log::Entry& entry)
 {
-    // Filter by regex
-    std::regex filter_regex(filter_[entry.kind].get_value());
-    const bool is_category_valid = std::regex_search(entry.context.category, filter_regex);
-    const bool is_message_valid = std::regex_search(entry.message, filter_regex);
-    const bool is_content_valid = is_category_valid || is_message_valid;
+    // Filter by kind first, as it is the cheapest check
+    if (entry.kind > verbosity_)
+    {
+        return false;
+    }
+
+    // Filter by content
+    const std::shared_ptr<const CompiledLogFilter> compiled_filter = std::atomic_load(&compiled_filter_);
+    const auto it = compiled_filter->find(entry.kind);
+    if (it == compiled_filter->end())
+    {
+        return true;
+    }
+    const CompiledFilter& filter = it->second;
 
-    // Filter by kind
-    const bool is_kind_valid = entry.kind <= verbosity_;
+    const char* category = entry.context.category != nullptr ? entry.context.category : "";
+    const bool is_category_valid = filter.matches(category, category + std::strlen(category));
 
-    return is_kind_valid && is_content_valid;
+    return is_category_valid || filter.matches(entry.message.data(), entry.message.data() + entry.message.size());
 }
 
 } /* namespace utils */
@@ -0,0 +1,300 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BinaryLog.cpp
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/logging/BinaryLog.hpp>
+
+namespace eprosima {
+namespace utils {
+
+namespace {
+
+//! State shared by every thread writing in the binary log.
+struct BinaryLogState
+{
+    //! Sites registered, by identifier. Guarded by \c sites_mutex
+    std::vector<BinaryLogSite> sites;
+
+    //! Protects \c sites .
+    std::mutex sites_mutex;
+
+    //! File where records are written. Guarded by \c file_mutex
+    std::ofstream file;
+
+    //! Number of sites already described in the current file. Guarded by \c file_mutex
+    std::size_t sites_written = 0;
+
+    //! Protects \c file and \c sites_written .
+    std::mutex file_mutex;
+
+    //! Buffers of the threads alive. Guarded by \c buffers_mutex
+    std::vector<std::shared_ptr<BinaryLogBuffer>> buffers;
+
+    //! Number of buffers created, used to give each thread an index. Guarded by \c buffers_mutex
+    uint32_t buffers_created = 0;
+
+    //! Protects \c buffers and \c buffers_created .
+    std::mutex buffers_mutex;
+
+    //! Whether the file is open.
+    std::atomic<bool> enabled{false};
+
+    //! Size of the buffers from which they are written in the file.
+    std::atomic<std::size_t> buffer_size{BinaryLog::DEFAULT_BUFFER_SIZE};
+};
+
+/**
+ * @brief State of the binary log.
+ *
+ * It is never destroyed, so threads ending after the static objects are destroyed can still flush their buffers.
+ */
+BinaryLogState& state()
+{
+    static BinaryLogState* binary_log_state = new BinaryLogState();
+    return *binary_log_state;
+}
+
+//! Write \c value in \c file with its native representation.
+template <typename T>
+void write_value(
+        std::ofstream& file,
+        const T& value)
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+//! Write \c value in \c file preceded by its size.
+void write_string(
+        std::ofstream& file,
+        const std::string& value)
+{
+    write_value(file, static_cast<uint32_t>(value.size()));
+    file.write(value.data(), value.size());
+}
+
+/**
+ * @brief Write the records of \c buffer in the file, and empty it.
+ *
+ * It must be guarded by the mutex of \c buffer .
+ */
+void write_buffer(
+        BinaryLogBuffer& buffer)
+{
+    if (buffer.used == 0)
+    {
+        return;
+    }
+
+    BinaryLogState& binary_log_state = state();
+    std::lock_guard<std::mutex> lock(binary_log_state.file_mutex);
+
+    // Records are discarded if the log is not open
+    if (binary_log_state.file.is_open())
+    {
+        // Describe the sites registered since the last block, so every record written refers to a known site
+        {
+            std::lock_guard<std::mutex> sites_lock(binary_log_state.sites_mutex);
+            for (; binary_log_state.sites_written < binary_log_state.sites.size(); ++binary_log_state.sites_written)
+            {
+                const BinaryLogSite& site = binary_log_state.sites[binary_log_state.sites_written];
+                binary_log_state.file.put(BinaryLog::SITE_BLOCK);
+                write_value(binary_log_state.file, static_cast<BinaryLogSiteId>(binary_log_state.sites_written));
+                write_value(binary_log_state.file, static_cast<uint8_t>(site.kind));
+                write_value(binary_log_state.file, site.line);
+                write_string(binary_log_state.file, site.file);
+                write_string(binary_log_state.file, site.category);
+                write_string(binary_log_state.file, site.format);
+            }
+        }
+
+        binary_log_state.file.put(BinaryLog::RECORDS_BLOCK);
+        write_value(binary_log_state.file, buffer.thread_index);
+        write_value(binary_log_state.file, static_cast<uint32_t>(buffer.used));
+        binary_log_state.file.write(buffer.bytes.data(), buffer.used);
+        binary_log_state.file.flush();
+    }
+
+    buffer.used = 0;
+}
+
+/**
+ * @brief Buffer of a thread, that writes its records when the thread ends.
+ */
+struct ThreadBufferHolder
+{
+    ~ThreadBufferHolder()
+    {
+        if (!buffer)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            write_buffer(*buffer);
+        }
+
+        BinaryLogState& binary_log_state = state();
+        std::lock_guard<std::mutex> lock(binary_log_state.buffers_mutex);
+        binary_log_state.buffers.erase(
+            std::remove(binary_log_state.buffers.begin(), binary_log_state.buffers.end(), buffer),
+            binary_log_state.buffers.end());
+    }
+
+    std::shared_ptr<BinaryLogBuffer> buffer;
+};
+
+} /* namespace */
+
+constexpr std::size_t BinaryLog::DEFAULT_BUFFER_SIZE;
+constexpr const char* BinaryLog::FILE_MAGIC;
+constexpr uint32_t BinaryLog::FILE_VERSION;
+constexpr uint32_t BinaryLog::BYTE_ORDER_MARK;
+constexpr char BinaryLog::SITE_BLOCK;
+constexpr char BinaryLog::RECORDS_BLOCK;
+
+void BinaryLog::open(
+        const std::string& file_path,
+        std::size_t buffer_size /* = DEFAULT_BUFFER_SIZE */)
+{
+    close();
+
+    BinaryLogState& binary_log_state = state();
+    std::lock_guard<std::mutex> lock(binary_log_state.file_mutex);
+
+    binary_log_state.file.open(file_path, std::ios::binary | std::ios::trunc);
+    if (!binary_log_state.file.is_open())
+    {
+        throw utils::InitializationException(STR_ENTRY
+                      << "Error opening binary log file " << file_path << ".");
+    }
+
+    binary_log_state.file.write(FILE_MAGIC, std::strlen(FILE_MAGIC));
+    write_value(binary_log_state.file, FILE_VERSION);
+    write_value(binary_log_state.file, BYTE_ORDER_MARK);
+    binary_log_state.file.flush();
+
+    binary_log_state.sites_written = 0;
+    binary_log_state.buffer_size = buffer_size > 0 ? buffer_size : DEFAULT_BUFFER_SIZE;
+    binary_log_state.enabled = true;
+}
+
+void BinaryLog::close()
+{
+    BinaryLogState& binary_log_state = state();
+    binary_log_state.enabled = false;
+
+    flush();
+
+    std::lock_guard<std::mutex> lock(binary_log_state.file_mutex);
+    if (binary_log_state.file.is_open())
+    {
+        binary_log_state.file.close();
+    }
+}
+
+void BinaryLog::flush()
+{
+    BinaryLogState& binary_log_state = state();
+    std::lock_guard<std::mutex> lock(binary_log_state.buffers_mutex);
+
+    for (const std::shared_ptr<BinaryLogBuffer>& buffer : binary_log_state.buffers)
+    {
+        std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+        flush_buffer_nts_(*buffer);
+    }
+}
+
+bool BinaryLog::enabled() noexcept
+{
+    return state().enabled.load(std::memory_order_relaxed);
+}
+
+BinaryLogSiteId BinaryLog::register_site_(
+        BinaryLogSite&& site)
+{
+    BinaryLogState& binary_log_state = state();
+    std::lock_guard<std::mutex> lock(binary_log_state.sites_mutex);
+
+    binary_log_state.sites.push_back(std::move(site));
+    return static_cast<BinaryLogSiteId>(binary_log_state.sites.size() - 1);
+}
+
+BinaryLogBuffer& BinaryLog::thread_buffer_()
+{
+    static thread_local ThreadBufferHolder holder;
+
+    if (!holder.buffer)
+    {
+        BinaryLogState& binary_log_state = state();
+        auto buffer = std::make_shared<BinaryLogBuffer>();
+        buffer->bytes.resize(binary_log_state.buffer_size * 2);
+
+        std::lock_guard<std::mutex> lock(binary_log_state.buffers_mutex);
+        buffer->thread_index = binary_log_state.buffers_created++;
+        binary_log_state.buffers.push_back(buffer);
+        holder.buffer = buffer;
+    }
+
+    return *holder.buffer;
+}
+
+std::size_t BinaryLog::begin_record_(
+        BinaryLogBuffer& buffer,
+        BinaryLogSiteId site)
+{
+    const int64_t timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    const uint32_t payload_size = 0;
+
+    // Record header: site, timestamp and size of the arguments, set once they are encoded
+    const std::size_t begin = buffer.used;
+    buffer.append(&site, sizeof(site));
+    buffer.append(&timestamp, sizeof(timestamp));
+    buffer.append(&payload_size, sizeof(payload_size));
+    return begin;
+}
+
+void BinaryLog::end_record_(
+        BinaryLogBuffer& buffer,
+        std::size_t begin)
+{
+    constexpr std::size_t HEADER_SIZE = sizeof(BinaryLogSiteId) + sizeof(int64_t) + sizeof(uint32_t);
+    const uint32_t payload_size = static_cast<uint32_t>(buffer.used - begin - HEADER_SIZE);
+    std::memcpy(buffer.bytes.data() + begin + HEADER_SIZE - sizeof(payload_size), &payload_size, sizeof(payload_size));
+
+    if (buffer.used >= state().buffer_size.load(std::memory_order_relaxed))
+    {
+        flush_buffer_nts_(buffer);
+    }
+}
+
+void BinaryLog::flush_buffer_nts_(
+        BinaryLogBuffer& buffer)
+{
+    write_buffer(buffer);
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,358 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BinaryLogReader.cpp
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#include <cpp_utils/exception/InconsistencyException.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/logging/BinaryLogReader.hpp>
+
+namespace eprosima {
+namespace utils {
+
+namespace {
+
+//! Size of the header of a record: site, timestamp and size of the arguments.
+constexpr std::size_t RECORD_HEADER_SIZE = sizeof(BinaryLogSiteId) + sizeof(int64_t) + sizeof(uint32_t);
+
+//! Copy a value of type \c T from \c data .
+template <typename T>
+T read_value(
+        const char* data)
+{
+    T value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+} /* namespace */
+
+BinaryLogReader::BinaryLogReader(
+        const std::string& file_path)
+    : file_(file_path, std::ios::binary)
+    , block_position_(0)
+    , block_thread_index_(0)
+    , truncated_(false)
+{
+    if (!file_.is_open())
+    {
+        throw utils::InitializationException(STR_ENTRY
+                      << "Error opening binary log file " << file_path << ".");
+    }
+
+    const std::size_t magic_size = std::strlen(BinaryLog::FILE_MAGIC);
+    std::string magic(magic_size, '\0');
+    uint32_t version = 0;
+    uint32_t byte_order_mark = 0;
+
+    if (!read_(&magic[0], magic_size) || magic != BinaryLog::FILE_MAGIC ||
+            !read_(&version, sizeof(version)) || !read_(&byte_order_mark, sizeof(byte_order_mark)))
+    {
+        throw utils::InitializationException(STR_ENTRY
+                      << "File " << file_path << " is not a binary log.");
+    }
+
+    if (version != BinaryLog::FILE_VERSION)
+    {
+        throw utils::InitializationException(STR_ENTRY
+                      << "Binary log " << file_path << " has version " << version << ", but only version "
+                      << BinaryLog::FILE_VERSION << " is supported.");
+    }
+
+    if (byte_order_mark != BinaryLog::BYTE_ORDER_MARK)
+    {
+        throw utils::InitializationException(STR_ENTRY
+                      << "Binary log " << file_path << " was written with a different byte order.");
+    }
+}
+
+bool BinaryLogReader::next(
+        BinaryLogEntry& entry)
+{
+    while (block_position_ + RECORD_HEADER_SIZE > block_.size())
+    {
+        if (!read_records_block_())
+        {
+            return false;
+        }
+    }
+
+    const char* record = block_.data() + block_position_;
+    const BinaryLogSiteId site_id = read_value<BinaryLogSiteId>(record);
+    const int64_t timestamp = read_value<int64_t>(record + sizeof(BinaryLogSiteId));
+    const uint32_t payload_size = read_value<uint32_t>(record + sizeof(BinaryLogSiteId) + sizeof(int64_t));
+
+    if (block_position_ + RECORD_HEADER_SIZE + payload_size > block_.size())
+    {
+        if (truncated_)
+        {
+            return false;
+        }
+        throw utils::InconsistencyException(STR_ENTRY
+                      << "Binary log record of site " << site_id << " exceeds its block.");
+    }
+
+    const auto site = sites_.find(site_id);
+    if (site == sites_.end())
+    {
+        throw utils::InconsistencyException(STR_ENTRY
+                      << "Binary log record of unknown site " << site_id << ".");
+    }
+
+    const char* payload = record + RECORD_HEADER_SIZE;
+    entry.timestamp = Timestamp(std::chrono::duration_cast<Timestamp::duration>(std::chrono::nanoseconds(timestamp)));
+    entry.thread_index = block_thread_index_;
+    entry.site = site->second;
+    entry.message = render_(site->second, payload, payload + payload_size);
+
+    block_position_ += RECORD_HEADER_SIZE + payload_size;
+    return true;
+}
+
+std::vector<BinaryLogEntry> BinaryLogReader::read_all_sorted()
+{
+    std::vector<BinaryLogEntry> entries;
+    BinaryLogEntry entry;
+    while (next(entry))
+    {
+        entries.push_back(entry);
+    }
+
+    // Records of each thread are already sorted, so keep their order when timestamps are equal
+    std::stable_sort(
+        entries.begin(),
+        entries.end(),
+        [](const BinaryLogEntry& lhs, const BinaryLogEntry& rhs)
+        {
+            return lhs.timestamp < rhs.timestamp;
+        });
+
+    return entries;
+}
+
+bool BinaryLogReader::read_records_block_()
+{
+    char tag;
+    while (read_(&tag, sizeof(tag)))
+    {
+        if (tag == BinaryLog::SITE_BLOCK)
+        {
+            BinaryLogSiteId id;
+            uint8_t kind;
+            BinaryLogSite site;
+            if (!read_(&id, sizeof(id)) || !read_(&kind, sizeof(kind)) || !read_(&site.line, sizeof(site.line)) ||
+                    !read_string_(site.file) || !read_string_(site.category) || !read_string_(site.format))
+            {
+                return false;
+            }
+            site.kind = static_cast<VerbosityKind>(kind);
+            sites_[id] = std::move(site);
+        }
+        else if (tag == BinaryLog::RECORDS_BLOCK)
+        {
+            uint32_t size;
+            if (!read_(&block_thread_index_, sizeof(block_thread_index_)) || !read_(&size, sizeof(size)))
+            {
+                return false;
+            }
+
+            block_.resize(size);
+            block_position_ = 0;
+
+            // Keep the complete records of a block cut at the end of the file
+            if (!read_(block_.data(), size))
+            {
+                block_.resize(static_cast<std::size_t>(file_.gcount()));
+                truncated_ = true;
+            }
+            return true;
+        }
+        else
+        {
+            throw utils::InconsistencyException(STR_ENTRY
+                          << "Unknown block in binary log: " << static_cast<int>(tag) << ".");
+        }
+    }
+
+    return false;
+}
+
+bool BinaryLogReader::read_(
+        void* data,
+        std::size_t size)
+{
+    file_.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+    return static_cast<std::size_t>(file_.gcount()) == size;
+}
+
+bool BinaryLogReader::read_string_(
+        std::string& value)
+{
+    uint32_t size;
+    if (!read_(&size, sizeof(size)))
+    {
+        return false;
+    }
+
+    value.resize(size);
+    return size == 0 || read_(&value[0], size);
+}
+
+std::string BinaryLogReader::render_(
+        const BinaryLogSite& site,
+        const char* begin,
+        const char* end)
+{
+    // Render each argument as text
+    std::vector<std::string> arguments;
+    const char* position = begin;
+    while (position < end)
+    {
+        const BinaryLogArgumentType type = static_cast<BinaryLogArgumentType>(*position++);
+        std::ostringstream argument;
+        std::size_t size;
+
+        switch (type)
+        {
+            case BinaryLogArgumentType::signed_integer:
+                size = sizeof(int64_t);
+                if (position + size <= end)
+                {
+                    argument << read_value<int64_t>(position);
+                }
+                break;
+
+            case BinaryLogArgumentType::unsigned_integer:
+                size = sizeof(uint64_t);
+                if (position + size <= end)
+                {
+                    argument << read_value<uint64_t>(position);
+                }
+                break;
+
+            case BinaryLogArgumentType::floating_point:
+                size = sizeof(double);
+                if (position + size <= end)
+                {
+                    argument << read_value<double>(position);
+                }
+                break;
+
+            case BinaryLogArgumentType::boolean:
+                size = 1;
+                if (position + size <= end)
+                {
+                    argument << (*position != 0 ? "true" : "false");
+                }
+                break;
+
+            case BinaryLogArgumentType::character:
+                size = 1;
+                if (position + size <= end)
+                {
+                    argument << *position;
+                }
+                break;
+
+            case BinaryLogArgumentType::string:
+                size = sizeof(uint32_t);
+                if (position + size <= end)
+                {
+                    const uint32_t string_size = read_value<uint32_t>(position);
+                    if (position + size + string_size <= end)
+                    {
+                        argument.write(position + size, string_size);
+                    }
+                    size += string_size;
+                }
+                break;
+
+            default:
+                throw utils::InconsistencyException(STR_ENTRY
+                              << "Unknown argument type " << static_cast<int>(type) << " in record of site "
+                              << site.file << ":" << site.line << ".");
+        }
+
+        if (position + size > end)
+        {
+            throw utils::InconsistencyException(STR_ENTRY
+                          << "Truncated argument in record of site " << site.file << ":" << site.line << ".");
+        }
+
+        arguments.push_back(argument.str());
+        position += size;
+    }
+
+    // Replace each {} with the next argument, and append the arguments left
+    std::string message;
+    std::size_t next_argument = 0;
+    std::size_t start = 0;
+    std::size_t placeholder;
+    while ((placeholder = site.format.find("{}", start)) != std::string::npos && next_argument < arguments.size())
+    {
+        message.append(site.format, start, placeholder - start);
+        message += arguments[next_argument++];
+        start = placeholder + 2;
+    }
+    message.append(site.format, start, std::string::npos);
+
+    for (; next_argument < arguments.size(); ++next_argument)
+    {
+        message += " " + arguments[next_argument];
+    }
+
+    return message;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const BinaryLogEntry& entry)
+{
+    const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        entry.timestamp.time_since_epoch()).count() % 1000000000;
+
+    os << timestamp_to_string(entry.timestamp, "%Y-%m-%d %H:%M:%S") << "."
+       << std::setw(9) << std::setfill('0') << nanoseconds << std::setfill(' ')
+       << " [" << entry.site.category << " ";
+
+    switch (entry.site.kind)
+    {
+        case VerbosityKind::Error:
+            os << "Error";
+            break;
+
+        case VerbosityKind::Warning:
+            os << "Warning";
+            break;
+
+        default:
+            os << "Info";
+            break;
+    }
+
+    os << "] " << entry.message << " (" << entry.site.file << ":" << entry.site.line << ")";
+    return os;
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
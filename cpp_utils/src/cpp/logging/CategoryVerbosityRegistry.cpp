@@ -0,0 +1,119 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CategoryVerbosityRegistry.cpp
+ *
+ */
+
+#include <algorithm>
+#include <tuple>
+
+#include <cpp_utils/logging/CategoryVerbosityRegistry.hpp>
+#include <cpp_utils/utils.hpp>
+
+namespace eprosima {
+namespace utils {
+
+CategoryVerbosityRegistry& CategoryVerbosityRegistry::get_instance() noexcept
+{
+    // Never destroyed, as log call sites keep references to its levels until the process ends
+    static CategoryVerbosityRegistry* instance_ = new CategoryVerbosityRegistry();
+    return *instance_;
+}
+
+const std::atomic<CategoryVerbosityRegistry::Kind>& CategoryVerbosityRegistry::register_category(
+        const std::string& category)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = categories_.find(category);
+    if (it == categories_.end())
+    {
+        it = categories_.emplace(
+            std::piecewise_construct,
+            std::forward_as_tuple(category),
+            std::forward_as_tuple(verbosity_nts_(category))).first;
+    }
+
+    return it->second;
+}
+
+void CategoryVerbosityRegistry::set_verbosity(
+        const std::string& category_pattern,
+        Kind verbosity)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    patterns_.erase(
+        std::remove_if(
+            patterns_.begin(),
+            patterns_.end(),
+            [&category_pattern](const std::pair<std::string, Kind>& pattern)
+            {
+                return pattern.first == category_pattern;
+            }),
+        patterns_.end());
+    patterns_.emplace_back(category_pattern, verbosity);
+
+    // Match the pattern now, so log calls only read the level
+    for (auto& category : categories_)
+    {
+        if (category.first == category_pattern || match_pattern(category_pattern, category.first))
+        {
+            category.second.store(verbosity, std::memory_order_relaxed);
+        }
+    }
+}
+
+void CategoryVerbosityRegistry::reset() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    patterns_.clear();
+    for (auto& category : categories_)
+    {
+        category.second.store(Kind::Info, std::memory_order_relaxed);
+    }
+}
+
+CategoryVerbosityRegistry::Kind CategoryVerbosityRegistry::verbosity(
+        const std::string& category) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const auto it = categories_.find(category);
+    if (it != categories_.end())
+    {
+        return it->second.load(std::memory_order_relaxed);
+    }
+    return verbosity_nts_(category);
+}
+
+CategoryVerbosityRegistry::Kind CategoryVerbosityRegistry::verbosity_nts_(
+        const std::string& category) const
+{
+    // The last pattern set that matches wins
+    for (auto it = patterns_.rbegin(); it != patterns_.rend(); ++it)
+    {
+        if (it->first == category || match_pattern(it->first, category))
+        {
+            return it->second;
+        }
+    }
+    return Kind::Info;
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
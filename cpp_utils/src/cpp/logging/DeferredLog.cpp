@@ -0,0 +1,448 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file DeferredLog.cpp
+ *
+ */
+
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/logging/DeferredLog.hpp>
+#include <cpp_utils/logging/LogStaging.hpp>
+
+namespace eprosima {
+namespace utils {
+
+namespace {
+
+//! Slot of the queue of entries.
+struct DeferredLogSlot
+{
+    /**
+     * @brief Position in the queue the slot is ready for.
+     *
+     * For a slot whose position is \c n : \c n while free, \c n+1 once its entry is queued, and \c n+size once the
+     * log thread has taken it (so it is free for the next round).
+     */
+    std::atomic<uint64_t> sequence{0};
+
+    //! Whether the entry was given up after taking the slot, so it is skipped.
+    bool cancelled = false;
+
+    //! Entry of the slot.
+    DeferredLogEntry entry;
+};
+
+/**
+ * @brief State shared by the threads that log and the log thread.
+ *
+ * Threads that log take a slot with an atomic ticket and fill it without any lock, so copying their arguments
+ * does not block other threads (nor the same one, if copying an argument logs too). The log thread takes the
+ * entries in ticket order, so it waits for a slot taken until its entry is queued.
+ */
+struct DeferredLogState
+{
+    //! Slots of the queue. The entry of ticket \c n is in slot \c n % slots_size .
+    std::unique_ptr<DeferredLogSlot[]> slots;
+
+    //! Number of slots.
+    uint64_t slots_size = 0;
+
+    //! Number of entries taken by the log thread and already formatted.
+    std::atomic<uint64_t> head{0};
+
+    //! Next ticket, i.e. number of slots taken by the threads that log.
+    std::atomic<uint64_t> tail{0};
+
+    //! Whether new entries must be dropped, as the log thread is stopping or not started.
+    std::atomic<bool> stop{true};
+
+    //! Number of threads writing an entry. Slots are not taken while \c stop is set and this is 0.
+    std::atomic<uint32_t> writers{0};
+
+    //! Whether the log thread is waiting for an entry to be queued.
+    std::atomic<bool> sleeping{false};
+
+    //! Number of threads waiting in \c flush , that the log thread notifies of each entry formatted.
+    std::atomic<uint32_t> flushing{0};
+
+    //! Whether the log thread must finish, once every slot taken is queued. Guarded by \c mutex
+    bool finish = false;
+
+    //! Protects the waits of the log thread and of \c flush . It is not taken to queue entries.
+    std::mutex mutex;
+
+    //! Notifies the log thread of entries queued while sleeping, or of finish.
+    std::condition_variable queued_cv;
+
+    //! Notifies \c flush of entries formatted.
+    std::condition_variable formatted_cv;
+
+    //! Thread that formats the entries.
+    std::thread thread;
+
+    //! Protects \c start and \c stop against each other.
+    std::mutex thread_mutex;
+
+    //! Whether the log thread is running.
+    std::atomic<bool> enabled{false};
+
+    //! Number of entries dropped because the queue was full.
+    std::atomic<uint64_t> dropped_entries{0};
+
+    //! Number of entries not formatted because their kind was not accepted any more.
+    std::atomic<uint64_t> filtered_entries{0};
+};
+
+/**
+ * @brief State of the deferred log.
+ *
+ * It is never destroyed, so the log thread can still be running while the static objects are destroyed.
+ */
+DeferredLogState& state()
+{
+    static DeferredLogState* deferred_log_state = new DeferredLogState();
+    return *deferred_log_state;
+}
+
+//! Format \c entry and pass it to Fast DDS Log, if its kind is still accepted, and destroy its arguments.
+void consume_entry(
+        DeferredLogEntry& entry,
+        std::string& message)
+{
+    if (Log::GetVerbosity() >= entry.kind &&
+            CategoryVerbosityRegistry::is_enabled(*entry.category_verbosity, entry.kind))
+    {
+        message.clear();
+        entry.format_function(entry, message);
+        Log::QueueLog(message, entry.context, entry.kind);
+    }
+    else
+    {
+        state().filtered_entries++;
+    }
+
+    entry.destroy_function(entry);
+}
+
+//! Routine of the log thread: format the entries queued until finished.
+void run()
+{
+    DeferredLogState& deferred_log_state = state();
+
+    // Reused for every message, so it only allocates for messages longer than any before
+    std::string message;
+
+    uint64_t head = deferred_log_state.head.load();
+    while (true)
+    {
+        DeferredLogSlot& slot = deferred_log_state.slots[head % deferred_log_state.slots_size];
+        const auto queued = [&slot, head]()
+                {
+                    return slot.sequence.load(std::memory_order_acquire) == head + 1;
+                };
+
+        if (queued())
+        {
+            if (!slot.cancelled)
+            {
+                consume_entry(slot.entry, message);
+            }
+            slot.sequence.store(head + deferred_log_state.slots_size, std::memory_order_release);
+            deferred_log_state.head.store(++head);
+
+            if (deferred_log_state.flushing.load() != 0)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(deferred_log_state.mutex);
+                }
+                deferred_log_state.formatted_cv.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(deferred_log_state.mutex);
+
+        // Threads that log only take the lock to wake this one up if it is sleeping
+        deferred_log_state.sleeping.store(true);
+        deferred_log_state.queued_cv.wait(lock, [&deferred_log_state, &queued]()
+                {
+                    return queued() || deferred_log_state.finish;
+                });
+        deferred_log_state.sleeping.store(false);
+
+        if (!queued())
+        {
+            // Finished, and as no thread is writing, every slot taken is formatted
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Format the entries queued and stop the log thread, if running.
+ *
+ * It must be guarded by \c thread_mutex .
+ */
+void stop_thread_nts()
+{
+    DeferredLogState& deferred_log_state = state();
+
+    if (!deferred_log_state.thread.joinable())
+    {
+        return;
+    }
+
+    // New entries are formatted in their thread from now on, and those already checking it are dropped
+    deferred_log_state.enabled.store(false);
+    deferred_log_state.stop.store(true);
+
+    // Let the threads writing an entry queue it, so the log thread does not wait for a slot taken forever
+    while (deferred_log_state.writers.load() != 0)
+    {
+        std::this_thread::yield();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(deferred_log_state.mutex);
+        deferred_log_state.finish = true;
+    }
+    deferred_log_state.queued_cv.notify_one();
+    deferred_log_state.formatted_cv.notify_all();
+    deferred_log_state.thread.join();
+}
+
+} /* namespace */
+
+constexpr std::size_t DeferredLogEntry::ARGUMENTS_CAPACITY;
+constexpr std::size_t DeferredLog::DEFAULT_QUEUE_SIZE;
+
+void DeferredLog::start(
+        std::size_t queue_size /* = DEFAULT_QUEUE_SIZE */)
+{
+    if (queue_size == 0)
+    {
+        throw InitializationException(STR_ENTRY
+                      << "Deferred log requires a queue of at least 1 entry.");
+    }
+
+    DeferredLogState& deferred_log_state = state();
+    std::lock_guard<std::mutex> thread_lock(deferred_log_state.thread_mutex);
+
+    stop_thread_nts();
+
+    // No slot is taken while stopped, so they can be replaced
+    deferred_log_state.slots.reset(new DeferredLogSlot[queue_size]);
+    deferred_log_state.slots_size = queue_size;
+    for (uint64_t n = 0; n < queue_size; ++n)
+    {
+        deferred_log_state.slots[n].sequence.store(n);
+    }
+    deferred_log_state.head.store(0);
+    deferred_log_state.tail.store(0);
+    {
+        std::lock_guard<std::mutex> lock(deferred_log_state.mutex);
+        deferred_log_state.finish = false;
+    }
+    deferred_log_state.stop.store(false);
+
+    deferred_log_state.thread = std::thread(run);
+    deferred_log_state.enabled.store(true);
+}
+
+void DeferredLog::stop()
+{
+    DeferredLogState& deferred_log_state = state();
+
+    {
+        std::lock_guard<std::mutex> thread_lock(deferred_log_state.thread_mutex);
+        stop_thread_nts();
+    }
+
+    // Entries staged meanwhile by other macros reach Fast DDS Log too, and it is flushed
+    LogStaging::flush();
+}
+
+void DeferredLog::flush()
+{
+    DeferredLogState& deferred_log_state = state();
+
+    {
+        std::unique_lock<std::mutex> lock(deferred_log_state.mutex);
+        const uint64_t queued = deferred_log_state.tail.load();
+        deferred_log_state.flushing++;
+        deferred_log_state.formatted_cv.wait(lock, [&deferred_log_state, queued]()
+                {
+                    return deferred_log_state.head.load() >= queued || deferred_log_state.finish;
+                });
+        deferred_log_state.flushing--;
+    }
+
+    LogStaging::flush();
+}
+
+bool DeferredLog::enabled() noexcept
+{
+    return state().enabled.load(std::memory_order_relaxed);
+}
+
+uint64_t DeferredLog::dropped_entries() noexcept
+{
+    return state().dropped_entries.load();
+}
+
+uint64_t DeferredLog::filtered_entries() noexcept
+{
+    return state().filtered_entries.load();
+}
+
+DeferredLogEntry* DeferredLog::begin_entry_(
+        uint64_t& ticket)
+{
+    DeferredLogState& deferred_log_state = state();
+
+    // Counted before checking stop, so stop waits for this entry if it takes a slot
+    deferred_log_state.writers.fetch_add(1);
+    if (deferred_log_state.stop.load())
+    {
+        deferred_log_state.writers.fetch_sub(1);
+        deferred_log_state.dropped_entries++;
+        return nullptr;
+    }
+
+    ticket = deferred_log_state.tail.load(std::memory_order_relaxed);
+    while (true)
+    {
+        DeferredLogSlot& slot = deferred_log_state.slots[ticket % deferred_log_state.slots_size];
+        const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+
+        if (sequence == ticket)
+        {
+            // Free slot: take it, unless another thread has just taken it
+            if (deferred_log_state.tail.compare_exchange_weak(ticket, ticket + 1, std::memory_order_relaxed))
+            {
+                slot.cancelled = false;
+                return &slot.entry;
+            }
+        }
+        else if (sequence < ticket)
+        {
+            // The entry of the previous round is not formatted yet: the queue is full
+            deferred_log_state.writers.fetch_sub(1);
+            deferred_log_state.dropped_entries++;
+            return nullptr;
+        }
+        else
+        {
+            ticket = deferred_log_state.tail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void DeferredLog::end_entry_(
+        uint64_t ticket,
+        bool cancel)
+{
+    DeferredLogState& deferred_log_state = state();
+    DeferredLogSlot& slot = deferred_log_state.slots[ticket % deferred_log_state.slots_size];
+
+    slot.cancelled = cancel;
+    slot.sequence.store(ticket + 1);
+
+    // Checked after queuing the entry, so either the log thread sees it before sleeping or it is woken up
+    if (deferred_log_state.sleeping.load())
+    {
+        {
+            std::lock_guard<std::mutex> lock(deferred_log_state.mutex);
+        }
+        deferred_log_state.queued_cv.notify_one();
+    }
+
+    deferred_log_state.writers.fetch_sub(1);
+}
+
+DeferredLogString DeferredLog::capture_argument_(
+        DeferredLogEntry& entry,
+        const char* arg)
+{
+    if (arg == nullptr)
+    {
+        return {static_cast<uint32_t>(entry.arguments_size), 0};
+    }
+
+    const std::size_t size = std::strlen(arg);
+    if (entry.arguments_size + size > DeferredLogEntry::ARGUMENTS_CAPACITY)
+    {
+        entry.overflow = true;
+        return {0, 0};
+    }
+
+    const DeferredLogString text{static_cast<uint32_t>(entry.arguments_size), static_cast<uint32_t>(size)};
+    std::memcpy(entry.arguments + entry.arguments_size, arg, size);
+    entry.arguments_size += size;
+    return text;
+}
+
+DeferredLogString DeferredLog::capture_argument_(
+        DeferredLogEntry& entry,
+        const std::string& arg)
+{
+    if (entry.arguments_size + arg.size() > DeferredLogEntry::ARGUMENTS_CAPACITY)
+    {
+        entry.overflow = true;
+        return {0, 0};
+    }
+
+    const DeferredLogString text{static_cast<uint32_t>(entry.arguments_size), static_cast<uint32_t>(arg.size())};
+    std::memcpy(entry.arguments + entry.arguments_size, arg.data(), arg.size());
+    entry.arguments_size += arg.size();
+    return text;
+}
+
+void DeferredLog::append_argument_(
+        const DeferredLogString& arg,
+        const char* buffer,
+        std::string& message)
+{
+    message.append(buffer + arg.offset, arg.size);
+}
+
+void DeferredLog::append_argument_(
+        const char* arg,
+        const char* /* buffer */,
+        std::string& message)
+{
+    if (arg != nullptr)
+    {
+        message.append(arg);
+    }
+}
+
+void DeferredLog::append_argument_(
+        const std::string& arg,
+        const char* /* buffer */,
+        std::string& message)
+{
+    message.append(arg);
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
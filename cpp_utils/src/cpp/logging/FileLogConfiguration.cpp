@@ -0,0 +1,65 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FileLogConfiguration.cpp
+ *
+ */
+
+#include <cpp_utils/logging/FileLogConfiguration.hpp>
+
+namespace eprosima {
+namespace utils {
+
+FileLogConfiguration::FileLogConfiguration()
+    : BaseLogConfiguration()
+    , max_file_size(0)
+    , max_rotated_files(5)
+    , flush_interval(1000)
+    , buffer_size(64 * 1024)
+    , queue_size(16)
+{
+}
+
+bool FileLogConfiguration::is_valid(
+        Formatter& error_msg) const noexcept
+{
+    if (!BaseLogConfiguration::is_valid(error_msg))
+    {
+        return false;
+    }
+
+    if (file_path.empty())
+    {
+        error_msg << "File path of the log consumer must be set.";
+        return false;
+    }
+
+    if (flush_interval == 0)
+    {
+        error_msg << "Flush interval of the log consumer must be higher than 0.";
+        return false;
+    }
+
+    if (buffer_size == 0 || queue_size == 0)
+    {
+        error_msg << "Buffer size and queue size of the log consumer must be higher than 0.";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,386 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FileLogConsumer.cpp
+ *
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <climits>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif // if defined(_WIN32)
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/logging/FileLogConsumer.hpp>
+
+namespace eprosima {
+namespace utils {
+
+void FileLogConsumer::StringAppendBuffer::set_target(
+        std::string* target) noexcept
+{
+    target_ = target;
+}
+
+int FileLogConsumer::StringAppendBuffer::overflow(
+        int c)
+{
+    if (c != traits_type::eof())
+    {
+        target_->push_back(static_cast<char>(c));
+    }
+    return traits_type::not_eof(c);
+}
+
+std::streamsize FileLogConsumer::StringAppendBuffer::xsputn(
+        const char* s,
+        std::streamsize n)
+{
+    target_->append(s, static_cast<std::size_t>(n));
+    return n;
+}
+
+FileLogConsumer::FileLogConsumer(
+        const FileLogConfiguration* log_configuration)
+    : BaseLogConsumer(log_configuration)
+    , configuration_(*log_configuration)
+    , format_stream_(&format_buffer_)
+    , buffers_queued_(0)
+    , buffers_written_(0)
+    , dropped_entries_(0)
+    , stop_(false)
+    , fd_(-1)
+    , file_size_(0)
+    , dropped_entries_reported_(0)
+{
+    Formatter error_msg;
+    if (!configuration_.is_valid(error_msg))
+    {
+        throw utils::InitializationException(STR_ENTRY
+                      << "Invalid configuration of file log consumer: " << error_msg << ".");
+    }
+
+    if (!open_file_())
+    {
+        throw utils::InitializationException(STR_ENTRY
+                      << "Error opening log file " << configuration_.file_path << ": " << std::strerror(errno) << ".");
+    }
+
+    // An entry may be formatted in a buffer just before it reaches the size to be queued
+    current_buffer_.reserve(configuration_.buffer_size * 2);
+    format_buffer_.set_target(&current_buffer_);
+    queued_buffers_.reserve(configuration_.queue_size + 1);
+
+    thread_ = std::thread(&FileLogConsumer::thread_routine_, this);
+}
+
+FileLogConsumer::~FileLogConsumer()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    writer_cv_.notify_one();
+    thread_.join();
+
+    if (fd_ >= 0)
+    {
+#if defined(_WIN32)
+        _close(fd_);
+#else
+        close(fd_);
+#endif // if defined(_WIN32)
+    }
+}
+
+void FileLogConsumer::Consume(
+        const Log::Entry& entry)
+{
+    if (!accept_entry_(entry))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // The current buffer could not be queued before because the queue was full
+    if (current_buffer_.size() >= configuration_.buffer_size)
+    {
+        if (queued_buffers_.size() >= configuration_.queue_size)
+        {
+            dropped_entries_++;
+            return;
+        }
+        queue_current_buffer_nts_();
+    }
+
+    print_timestamp(format_stream_, entry, false);
+    print_header(format_stream_, entry, false);
+    print_message(format_stream_, entry, false);
+    print_context(format_stream_, entry, false);
+    print_new_line(format_stream_, false);
+
+    if (current_buffer_.size() >= configuration_.buffer_size &&
+            queued_buffers_.size() < configuration_.queue_size)
+    {
+        queue_current_buffer_nts_();
+    }
+}
+
+void FileLogConsumer::flush()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    queue_current_buffer_nts_();
+    const uint64_t buffers_to_write = buffers_queued_;
+
+    written_cv_.wait(
+        lock,
+        [this, buffers_to_write]()
+        {
+            return buffers_written_ >= buffers_to_write;
+        });
+}
+
+uint64_t FileLogConsumer::dropped_entries() const noexcept
+{
+    return dropped_entries_.load();
+}
+
+void FileLogConsumer::queue_current_buffer_nts_()
+{
+    if (current_buffer_.empty())
+    {
+        return;
+    }
+
+    queued_buffers_.push_back(std::move(current_buffer_));
+
+    if (!free_buffers_.empty())
+    {
+        current_buffer_ = std::move(free_buffers_.back());
+        free_buffers_.pop_back();
+    }
+    else
+    {
+        current_buffer_ = std::string();
+        current_buffer_.reserve(configuration_.buffer_size * 2);
+    }
+
+    buffers_queued_++;
+    writer_cv_.notify_one();
+}
+
+void FileLogConsumer::thread_routine_() noexcept
+{
+    std::vector<std::string> buffers;
+    buffers.reserve(configuration_.queue_size + 1);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true)
+    {
+        const bool queued = writer_cv_.wait_for(
+            lock,
+            std::chrono::milliseconds(configuration_.flush_interval),
+            [this]()
+            {
+                return stop_ || !queued_buffers_.empty();
+            });
+
+        // Entries that have waited the flush interval (or that are left when stopping) are written anyway
+        if (!queued || stop_)
+        {
+            queue_current_buffer_nts_();
+        }
+
+        const bool stop = stop_;
+        const uint64_t buffers_queued = buffers_queued_;
+        buffers.swap(queued_buffers_);
+
+        lock.unlock();
+        write_buffers_(buffers);
+        lock.lock();
+
+        // Keep the memory of the buffers written to reuse it
+        for (std::string& buffer : buffers)
+        {
+            buffer.clear();
+            free_buffers_.push_back(std::move(buffer));
+        }
+        buffers.clear();
+
+        buffers_written_ = buffers_queued;
+        written_cv_.notify_all();
+
+        if (stop)
+        {
+            break;
+        }
+    }
+}
+
+void FileLogConsumer::write_buffers_(
+        const std::vector<std::string>& buffers) noexcept
+{
+    std::string dropped_notice;
+    const uint64_t dropped_entries = dropped_entries_.load();
+    if (dropped_entries > dropped_entries_reported_)
+    {
+        dropped_notice = "FileLogConsumer dropped " + std::to_string(dropped_entries - dropped_entries_reported_)
+                + " log entries because its queue was full.\n";
+        dropped_entries_reported_ = dropped_entries;
+    }
+
+    if (fd_ < 0 || (buffers.empty() && dropped_notice.empty()))
+    {
+        return;
+    }
+
+#if defined(_WIN32)
+    auto write_buffer = [this](const std::string& buffer)
+            {
+                std::size_t written = 0;
+                while (written < buffer.size())
+                {
+                    const int bytes =
+                            _write(fd_, buffer.data() + written, static_cast<unsigned int>(buffer.size() - written));
+                    if (bytes <= 0)
+                    {
+                        break;
+                    }
+                    written += static_cast<std::size_t>(bytes);
+                }
+                file_size_ += written;
+            };
+
+    for (const std::string& buffer : buffers)
+    {
+        write_buffer(buffer);
+    }
+    write_buffer(dropped_notice);
+#else
+    std::vector<iovec> iov;
+    iov.reserve(buffers.size() + 1);
+    for (const std::string& buffer : buffers)
+    {
+        iov.push_back({const_cast<char*>(buffer.data()), buffer.size()});
+    }
+    if (!dropped_notice.empty())
+    {
+        iov.push_back({const_cast<char*>(dropped_notice.data()), dropped_notice.size()});
+    }
+
+    std::size_t index = 0;
+    while (index < iov.size())
+    {
+        const int count = static_cast<int>(std::min<std::size_t>(iov.size() - index, IOV_MAX));
+        ssize_t written = writev(fd_, &iov[index], count);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+        file_size_ += static_cast<uint64_t>(written);
+
+        // Skip what has been written, so a partial write continues where it stopped
+        while (index < iov.size() && static_cast<std::size_t>(written) >= iov[index].iov_len)
+        {
+            written -= static_cast<ssize_t>(iov[index].iov_len);
+            index++;
+        }
+        if (index < iov.size())
+        {
+            iov[index].iov_base = static_cast<char*>(iov[index].iov_base) + written;
+            iov[index].iov_len -= static_cast<std::size_t>(written);
+        }
+    }
+#endif // if defined(_WIN32)
+
+    if (configuration_.max_file_size > 0 && file_size_ >= configuration_.max_file_size)
+    {
+        rotate_();
+    }
+}
+
+void FileLogConsumer::rotate_() noexcept
+{
+#if defined(_WIN32)
+    _close(fd_);
+#else
+    close(fd_);
+#endif // if defined(_WIN32)
+    fd_ = -1;
+
+    const std::string& file_path = configuration_.file_path;
+    const uint32_t max_rotated_files = configuration_.max_rotated_files;
+
+    if (max_rotated_files == 0)
+    {
+        std::remove(file_path.c_str());
+    }
+    else
+    {
+        // file.N-1 -> file.N, ..., file -> file.1
+        std::remove((file_path + "." + std::to_string(max_rotated_files)).c_str());
+        for (uint32_t i = max_rotated_files - 1; i > 0; --i)
+        {
+            std::rename(
+                (file_path + "." + std::to_string(i)).c_str(),
+                (file_path + "." + std::to_string(i + 1)).c_str());
+        }
+        std::rename(file_path.c_str(), (file_path + ".1").c_str());
+    }
+
+    // If it could not be opened, entries are not written anymore
+    open_file_();
+}
+
+bool FileLogConsumer::open_file_() noexcept
+{
+#if defined(_WIN32)
+    fd_ = _open(configuration_.file_path.c_str(), _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    fd_ = open(configuration_.file_path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+#endif // if defined(_WIN32)
+
+    if (fd_ < 0)
+    {
+        return false;
+    }
+
+    struct stat file_stat;
+    file_size_ = fstat(fd_, &file_stat) == 0 ? static_cast<uint64_t>(file_stat.st_size) : 0;
+    return true;
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
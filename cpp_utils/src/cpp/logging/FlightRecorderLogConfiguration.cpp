@@ -0,0 +1,57 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file FlightRecorderLogConfiguration.cpp
+ *
+ */
+
+#include <cpp_utils/logging/FlightRecorderFormat.hpp>
+#include <cpp_utils/logging/FlightRecorderLogConfiguration.hpp>
+
+namespace eprosima {
+namespace utils {
+
+FlightRecorderLogConfiguration::FlightRecorderLogConfiguration()
+    : BaseLogConfiguration()
+    , ring_size(4 * 1024 * 1024)
+{
+}
+
+bool FlightRecorderLogConfiguration::is_valid(
+        Formatter& error_msg) const noexcept
+{
+    if (!BaseLogConfiguration::is_valid(error_msg))
+    {
+        return false;
+    }
+
+    if (file_path.empty())
+    {
+        error_msg << "File path of the flight recorder must be set.";
+        return false;
+    }
+
+    if (ring_size < 4 * 1024 || ring_size % FlightRecorderFormat::RECORD_ALIGNMENT != 0)
+    {
+        error_msg << "Ring size of the flight recorder must be a multiple of 8 of at least 4096 bytes.";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,198 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file FlightRecorderLogConsumer.cpp
+ *
+ */
+
+#if !defined(_WIN32)
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/logging/FlightRecorderLogConsumer.hpp>
+
+namespace eprosima {
+namespace utils {
+
+namespace {
+
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t),
+        "Head of the ring must be accessed atomically in the file header");
+
+//! Maximum size of the strings whose size is written in 16 bits.
+constexpr std::size_t MAX_SHORT_STRING_SIZE = 0xFFFF;
+
+} /* namespace */
+
+FlightRecorderLogConsumer::FlightRecorderLogConsumer(
+        const FlightRecorderLogConfiguration* log_configuration)
+    : BaseLogConsumer(log_configuration)
+    , file_path_(log_configuration->file_path)
+    , ring_size_(log_configuration->ring_size)
+    , mapped_(nullptr)
+    , mapped_size_(static_cast<std::size_t>(FlightRecorderFormat::FILE_HEADER_SIZE + ring_size_))
+    , header_(nullptr)
+    , head_(nullptr)
+    , ring_(nullptr)
+{
+    Formatter error_msg;
+    if (!log_configuration->is_valid(error_msg))
+    {
+        throw InitializationException(STR_ENTRY
+                      << "Invalid flight recorder configuration: " << error_msg << ".");
+    }
+
+    const int fd = open(file_path_.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+    {
+        throw InitializationException(STR_ENTRY
+                      << "Error opening flight recorder file " << file_path_ << ": " << std::strerror(errno) << ".");
+    }
+
+    struct stat file_stat;
+    const bool same_size = fstat(fd, &file_stat) == 0 && static_cast<uint64_t>(file_stat.st_size) == mapped_size_;
+
+    // A file of another size is replaced by an empty one, filled with zeros
+    if (!same_size && (ftruncate(fd, 0) != 0 || ftruncate(fd, static_cast<off_t>(mapped_size_)) != 0))
+    {
+        const int error = errno;
+        ::close(fd);
+        throw InitializationException(STR_ENTRY
+                      << "Error resizing flight recorder file " << file_path_ << ": " << std::strerror(error) << ".");
+    }
+
+    void* mapped = mmap(nullptr, mapped_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    const int error = errno;
+
+    // The mapping keeps the file open
+    ::close(fd);
+
+    if (mapped == MAP_FAILED)
+    {
+        throw InitializationException(STR_ENTRY
+                      << "Error mapping flight recorder file " << file_path_ << ": " << std::strerror(error) << ".");
+    }
+
+    mapped_ = static_cast<char*>(mapped);
+    header_ = reinterpret_cast<FlightRecorderFormat::FileHeader*>(mapped_);
+    head_ = reinterpret_cast<std::atomic<uint64_t>*>(&header_->head);
+    ring_ = mapped_ + FlightRecorderFormat::FILE_HEADER_SIZE;
+
+    if (!is_ring_reusable_())
+    {
+        std::memset(mapped_, 0, mapped_size_);
+        std::memcpy(header_->magic, FlightRecorderFormat::FILE_MAGIC, sizeof(header_->magic));
+        header_->version = FlightRecorderFormat::FILE_VERSION;
+        header_->byte_order_mark = FlightRecorderFormat::BYTE_ORDER_MARK;
+        header_->ring_size = ring_size_;
+        head_->store(0);
+    }
+}
+
+FlightRecorderLogConsumer::~FlightRecorderLogConsumer()
+{
+    munmap(mapped_, mapped_size_);
+}
+
+void FlightRecorderLogConsumer::Consume(
+        const Log::Entry& entry)
+{
+    if (!accept_entry_(entry))
+    {
+        return;
+    }
+
+    const char* category = entry.context.category != nullptr ? entry.context.category : "";
+    const char* file_name = entry.context.filename != nullptr ? entry.context.filename : "";
+
+    FlightRecorderFormat::RecordHeader record{};
+    record.line = static_cast<uint32_t>(entry.context.line);
+    record.kind = static_cast<uint8_t>(entry.kind);
+    record.timestamp_size = static_cast<uint16_t>(std::min(entry.timestamp.size(), MAX_SHORT_STRING_SIZE));
+    record.category_size = static_cast<uint16_t>(std::min(std::strlen(category), MAX_SHORT_STRING_SIZE));
+    record.file_size = static_cast<uint16_t>(std::min(std::strlen(file_name), MAX_SHORT_STRING_SIZE));
+
+    // Truncate the message so the record does not take more than a quarter of the ring
+    const uint64_t fixed_size = FlightRecorderFormat::RECORD_HEADER_SIZE + record.timestamp_size +
+            record.category_size + record.file_size;
+    const uint64_t max_size = ring_size_ / 4 - FlightRecorderFormat::RECORD_ALIGNMENT;
+    if (fixed_size > max_size)
+    {
+        return;
+    }
+    record.message_size = static_cast<uint32_t>(std::min<uint64_t>(entry.message.size(), max_size - fixed_size));
+    record.size = static_cast<uint32_t>(fixed_size + record.message_size);
+
+    // Reserve the space of the record
+    const uint64_t position = head_->fetch_add(FlightRecorderFormat::align(record.size), std::memory_order_relaxed);
+
+    // Write the header without commit first, so the record overwritten in that position is not valid anymore
+    uint64_t offset = position;
+    write_(offset, &record, FlightRecorderFormat::RECORD_HEADER_SIZE);
+    offset += FlightRecorderFormat::RECORD_HEADER_SIZE;
+    write_(offset, entry.timestamp.data(), record.timestamp_size);
+    offset += record.timestamp_size;
+    write_(offset, category, record.category_size);
+    offset += record.category_size;
+    write_(offset, file_name, record.file_size);
+    offset += record.file_size;
+    write_(offset, entry.message.data(), record.message_size);
+
+    // Commit the record. It is aligned, so it never wraps around the ring
+    reinterpret_cast<std::atomic<uint64_t>*>(ring_ + position % ring_size_)->store(
+        position ^ FlightRecorderFormat::RECORD_MARK, std::memory_order_release);
+}
+
+void FlightRecorderLogConsumer::flush() noexcept
+{
+    msync(mapped_, mapped_size_, MS_SYNC);
+}
+
+void FlightRecorderLogConsumer::write_(
+        uint64_t position,
+        const void* data,
+        std::size_t size) noexcept
+{
+    const std::size_t offset = static_cast<std::size_t>(position % ring_size_);
+    const std::size_t first_part = std::min<std::size_t>(size, static_cast<std::size_t>(ring_size_ - offset));
+
+    std::memcpy(ring_ + offset, data, first_part);
+    if (first_part < size)
+    {
+        std::memcpy(ring_, static_cast<const char*>(data) + first_part, size - first_part);
+    }
+}
+
+bool FlightRecorderLogConsumer::is_ring_reusable_() const noexcept
+{
+    return std::memcmp(header_->magic, FlightRecorderFormat::FILE_MAGIC, sizeof(header_->magic)) == 0 &&
+           header_->version == FlightRecorderFormat::FILE_VERSION &&
+           header_->byte_order_mark == FlightRecorderFormat::BYTE_ORDER_MARK &&
+           header_->ring_size == ring_size_;
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
+
+#endif // if !defined(_WIN32)
@@ -0,0 +1,190 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file FlightRecorderReader.cpp
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/logging/FlightRecorderReader.hpp>
+
+namespace eprosima {
+namespace utils {
+
+constexpr const char* FlightRecorderFormat::FILE_MAGIC;
+constexpr uint32_t FlightRecorderFormat::FILE_VERSION;
+constexpr uint32_t FlightRecorderFormat::BYTE_ORDER_MARK;
+constexpr uint64_t FlightRecorderFormat::RECORD_MARK;
+constexpr std::size_t FlightRecorderFormat::RECORD_ALIGNMENT;
+constexpr std::size_t FlightRecorderFormat::FILE_HEADER_SIZE;
+constexpr std::size_t FlightRecorderFormat::RECORD_HEADER_SIZE;
+
+FlightRecorderReader::FlightRecorderReader(
+        const std::string& file_path)
+    : position_(0)
+    , head_(0)
+{
+    std::ifstream file(file_path, std::ios::binary);
+    if (!file.is_open())
+    {
+        throw InitializationException(STR_ENTRY
+                      << "Error opening flight recorder file " << file_path << ".");
+    }
+
+    FlightRecorderFormat::FileHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            std::memcmp(header.magic, FlightRecorderFormat::FILE_MAGIC, sizeof(header.magic)) != 0)
+    {
+        throw InitializationException(STR_ENTRY
+                      << "File " << file_path << " is not a flight recorder ring.");
+    }
+
+    if (header.version != FlightRecorderFormat::FILE_VERSION ||
+            header.byte_order_mark != FlightRecorderFormat::BYTE_ORDER_MARK)
+    {
+        throw InitializationException(STR_ENTRY
+                      << "Flight recorder file " << file_path << " has version " << header.version
+                      << " or was written with another byte order.");
+    }
+
+    if (header.ring_size == 0 || header.ring_size % FlightRecorderFormat::RECORD_ALIGNMENT != 0)
+    {
+        throw InitializationException(STR_ENTRY
+                      << "Flight recorder file " << file_path << " has an invalid ring size.");
+    }
+
+    ring_.resize(static_cast<std::size_t>(header.ring_size));
+    if (!file.read(ring_.data(), static_cast<std::streamsize>(ring_.size())))
+    {
+        throw InitializationException(STR_ENTRY
+                      << "Flight recorder file " << file_path << " is shorter than its ring.");
+    }
+
+    // Only the last ring size bytes before the head have not been overwritten
+    head_ = header.head;
+    position_ = head_ > header.ring_size ? FlightRecorderFormat::align(head_ - header.ring_size) : 0;
+}
+
+bool FlightRecorderReader::next(
+        FlightRecorderEntry& entry)
+{
+    const uint64_t ring_size = ring_.size();
+
+    while (position_ + FlightRecorderFormat::RECORD_HEADER_SIZE <= head_)
+    {
+        FlightRecorderFormat::RecordHeader record;
+        read_(position_, &record, sizeof(record));
+
+        const uint64_t record_size = record.size;
+        const bool valid =
+                record.commit == (position_ ^ FlightRecorderFormat::RECORD_MARK) &&
+                record_size == FlightRecorderFormat::RECORD_HEADER_SIZE + record.timestamp_size +
+                record.category_size + record.file_size + static_cast<uint64_t>(record.message_size) &&
+                record_size <= ring_size &&
+                position_ + record_size <= head_;
+
+        if (!valid)
+        {
+            // Not committed or overwritten: look for the next record in the next aligned position
+            position_ += FlightRecorderFormat::RECORD_ALIGNMENT;
+            continue;
+        }
+
+        uint64_t offset = position_ + FlightRecorderFormat::RECORD_HEADER_SIZE;
+        read_string_(offset, record.timestamp_size, entry.timestamp);
+        offset += record.timestamp_size;
+        read_string_(offset, record.category_size, entry.category);
+        offset += record.category_size;
+        read_string_(offset, record.file_size, entry.file_name);
+        offset += record.file_size;
+        read_string_(offset, record.message_size, entry.message);
+        entry.kind = static_cast<VerbosityKind>(record.kind);
+        entry.line = record.line;
+
+        position_ += FlightRecorderFormat::align(record_size);
+        return true;
+    }
+
+    return false;
+}
+
+bool FlightRecorderReader::is_flight_recorder_file(
+        const std::string& file_path)
+{
+    std::ifstream file(file_path, std::ios::binary);
+    char magic[8];
+    return file.read(magic, sizeof(magic)) &&
+           std::memcmp(magic, FlightRecorderFormat::FILE_MAGIC, sizeof(magic)) == 0;
+}
+
+void FlightRecorderReader::read_(
+        uint64_t position,
+        void* data,
+        std::size_t size) const
+{
+    const std::size_t offset = static_cast<std::size_t>(position % ring_.size());
+    const std::size_t first_part = std::min(size, ring_.size() - offset);
+
+    std::memcpy(data, ring_.data() + offset, first_part);
+    if (first_part < size)
+    {
+        std::memcpy(static_cast<char*>(data) + first_part, ring_.data(), size - first_part);
+    }
+}
+
+void FlightRecorderReader::read_string_(
+        uint64_t position,
+        std::size_t size,
+        std::string& value) const
+{
+    value.resize(size);
+    if (size > 0)
+    {
+        read_(position, &value[0], size);
+    }
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const FlightRecorderEntry& entry)
+{
+    os << entry.timestamp << " [" << entry.category << " ";
+
+    switch (entry.kind)
+    {
+        case VerbosityKind::Error:
+            os << "Error";
+            break;
+
+        case VerbosityKind::Warning:
+            os << "Warning";
+            break;
+
+        default:
+            os << "Info";
+            break;
+    }
+
+    os << "] " << entry.message << " (" << entry.file_name << ":" << entry.line << ")";
+    return os;
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,469 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file LogStaging.cpp
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/logging/LogStaging.hpp>
+
+namespace eprosima {
+namespace utils {
+
+using Log = eprosima::fastdds::dds::Log;
+
+namespace {
+
+//! Entry staged, waiting to be passed to Fast DDS Log.
+struct StagedEntry
+{
+    //! Message of the entry.
+    std::string message;
+
+    //! File, line, function and category of the entry.
+    Log::Context context;
+
+    //! Kind of the entry.
+    Log::Kind kind;
+
+    //! When the entry was logged, in nanoseconds of \c std::chrono::steady_clock .
+    int64_t timestamp;
+};
+
+/**
+ * @brief Ring buffer of the entries of a single thread.
+ *
+ * Entries are in slot \c n % size , for \c n in [head, tail).
+ * Only the thread of the buffer moves \c tail , and only the collector thread moves \c head .
+ */
+struct StagingBuffer
+{
+    StagingBuffer(
+            std::size_t size)
+        : entries(size)
+    {
+    }
+
+    //! Slots of the ring.
+    std::vector<StagedEntry> entries;
+
+    //! Number of entries passed to Fast DDS Log.
+    std::atomic<uint64_t> head{0};
+
+    //! Number of entries staged.
+    std::atomic<uint64_t> tail{0};
+
+    //! Whether the thread of the buffer is alive. Once it ends, the buffer is removed after being drained.
+    std::atomic<bool> thread_alive{true};
+};
+
+//! State shared by the threads that log and the collector thread.
+struct LogStagingState
+{
+    //! Buffers of the threads that have staged entries. Guarded by \c buffers_mutex
+    std::vector<std::shared_ptr<StagingBuffer>> buffers;
+
+    //! Protects \c buffers .
+    std::mutex buffers_mutex;
+
+    //! Number of flushes requested. Guarded by \c mutex
+    uint64_t flushes_requested = 0;
+
+    //! Number of flushes done. Guarded by \c mutex
+    uint64_t flushes_done = 0;
+
+    //! Whether the collector thread must stop. Guarded by \c mutex
+    bool stop = false;
+
+    //! Whether the collector thread is waiting, so threads that stage entries must wake it up.
+    std::atomic<bool> collector_waiting{false};
+
+    //! Protects the flushes, stop and the waits of the collector thread.
+    std::mutex mutex;
+
+    //! Notifies the collector thread of entries staged, flushes requested or stop.
+    std::condition_variable collector_cv;
+
+    //! Notifies flushes done.
+    std::condition_variable flushed_cv;
+
+    //! Collector thread.
+    std::thread thread;
+
+    //! Identifier of the collector thread, to be read without \c thread_mutex .
+    std::atomic<std::thread::id> collector_id;
+
+    //! Protects \c start and \c stop against each other.
+    std::mutex thread_mutex;
+
+    //! Whether the collector thread is running.
+    std::atomic<bool> enabled{false};
+
+    //! Number of threads staging an entry. The last drain waits until it is 0 once \c enabled is cleared.
+    std::atomic<uint32_t> stagers{0};
+
+    //! Size of the buffers created.
+    std::atomic<std::size_t> buffer_size{LogStaging::DEFAULT_BUFFER_SIZE};
+
+    //! Number of entries passed from their thread because its buffer was full.
+    std::atomic<uint64_t> overflow_entries{0};
+};
+
+/**
+ * @brief State of the staging layer.
+ *
+ * It is never destroyed, so threads ending after the static objects are destroyed can still release their buffers.
+ */
+LogStagingState& state()
+{
+    static LogStagingState* log_staging_state = new LogStagingState();
+    return *log_staging_state;
+}
+
+//! Owner of the buffer of a thread, that marks it as orphan when the thread ends.
+struct ThreadBuffer
+{
+    ~ThreadBuffer()
+    {
+        if (buffer)
+        {
+            buffer->thread_alive.store(false);
+        }
+    }
+
+    std::shared_ptr<StagingBuffer> buffer;
+};
+
+//! Buffer of this thread, created and registered the first time it is used.
+StagingBuffer& thread_buffer()
+{
+    thread_local ThreadBuffer thread_buffer;
+
+    if (!thread_buffer.buffer)
+    {
+        LogStagingState& log_staging_state = state();
+        thread_buffer.buffer = std::make_shared<StagingBuffer>(log_staging_state.buffer_size.load());
+
+        std::lock_guard<std::mutex> lock(log_staging_state.buffers_mutex);
+        log_staging_state.buffers.push_back(thread_buffer.buffer);
+    }
+
+    return *thread_buffer.buffer;
+}
+
+//! Wake the collector thread up if it is waiting, so staging an entry does not take any lock otherwise.
+void wake_collector()
+{
+    LogStagingState& log_staging_state = state();
+
+    if (log_staging_state.collector_waiting.load() && log_staging_state.collector_waiting.exchange(false))
+    {
+        std::lock_guard<std::mutex> lock(log_staging_state.mutex);
+        log_staging_state.collector_cv.notify_one();
+    }
+}
+
+//! Timestamp of an entry logged now.
+int64_t now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Pass the entries staged in every buffer to Fast DDS Log, by their timestamp, and remove the buffers
+ * of threads that have ended once they are empty.
+ *
+ * It is only called from the collector thread.
+ */
+void drain()
+{
+    LogStagingState& log_staging_state = state();
+
+    // Buffers are taken out of the lock, so threads can register theirs while entries are passed to Fast DDS Log
+    std::vector<std::shared_ptr<StagingBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(log_staging_state.buffers_mutex);
+        buffers = log_staging_state.buffers;
+    }
+
+    // Entries staged so far in each buffer
+    std::vector<uint64_t> ends(buffers.size());
+    for (std::size_t i = 0; i < buffers.size(); ++i)
+    {
+        ends[i] = buffers[i]->tail.load(std::memory_order_acquire);
+    }
+
+    // Merge the buffers, each already in order, taking the oldest first entry each time
+    while (true)
+    {
+        StagingBuffer* oldest = nullptr;
+        int64_t oldest_timestamp = 0;
+        for (std::size_t i = 0; i < buffers.size(); ++i)
+        {
+            StagingBuffer& buffer = *buffers[i];
+            const uint64_t head = buffer.head.load(std::memory_order_relaxed);
+            if (head == ends[i])
+            {
+                continue;
+            }
+
+            const int64_t timestamp = buffer.entries[head % buffer.entries.size()].timestamp;
+            if (oldest == nullptr || timestamp < oldest_timestamp)
+            {
+                oldest = &buffer;
+                oldest_timestamp = timestamp;
+            }
+        }
+
+        if (oldest == nullptr)
+        {
+            break;
+        }
+
+        const uint64_t head = oldest->head.load(std::memory_order_relaxed);
+        const StagedEntry& entry = oldest->entries[head % oldest->entries.size()];
+        Log::QueueLog(entry.message, entry.context, entry.kind);
+
+        // The slot is free for the thread of the buffer again
+        oldest->head.store(head + 1, std::memory_order_release);
+    }
+
+    std::lock_guard<std::mutex> lock(log_staging_state.buffers_mutex);
+    for (auto it = log_staging_state.buffers.begin(); it != log_staging_state.buffers.end();)
+    {
+        StagingBuffer& buffer = **it;
+        if (!buffer.thread_alive.load() && buffer.head.load() == buffer.tail.load())
+        {
+            it = log_staging_state.buffers.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+//! Whether any buffer has entries staged.
+bool pending()
+{
+    LogStagingState& log_staging_state = state();
+    std::lock_guard<std::mutex> lock(log_staging_state.buffers_mutex);
+
+    for (const std::shared_ptr<StagingBuffer>& buffer : log_staging_state.buffers)
+    {
+        if (buffer->head.load() != buffer->tail.load())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//! Routine of the collector thread: drain the buffers until stopped.
+void run()
+{
+    // Time after which buffers are drained even if no thread has woken the collector up
+    constexpr std::chrono::milliseconds MAX_WAIT(100);
+
+    LogStagingState& log_staging_state = state();
+    log_staging_state.collector_id.store(std::this_thread::get_id());
+
+    std::unique_lock<std::mutex> lock(log_staging_state.mutex);
+    while (true)
+    {
+        // Entries staged before the flush was requested (or before stop) are drained in this iteration
+        const uint64_t flushes_requested = log_staging_state.flushes_requested;
+        const bool stop = log_staging_state.stop;
+
+        lock.unlock();
+        drain();
+        lock.lock();
+
+        log_staging_state.flushes_done = flushes_requested;
+        log_staging_state.flushed_cv.notify_all();
+
+        if (stop)
+        {
+            return;
+        }
+
+        // Wait unless something was requested or staged meanwhile
+        log_staging_state.collector_waiting.store(true);
+        if (log_staging_state.stop || log_staging_state.flushes_requested != log_staging_state.flushes_done ||
+                pending())
+        {
+            log_staging_state.collector_waiting.store(false);
+            continue;
+        }
+
+        log_staging_state.collector_cv.wait_for(lock, MAX_WAIT, [&log_staging_state]()
+                {
+                    return log_staging_state.stop ||
+                    log_staging_state.flushes_requested != log_staging_state.flushes_done ||
+                    !log_staging_state.collector_waiting.load();
+                });
+        log_staging_state.collector_waiting.store(false);
+    }
+}
+
+/**
+ * @brief Pass every entry staged to Fast DDS Log and stop the collector thread, if running.
+ *
+ * It must be guarded by \c thread_mutex .
+ */
+void stop_thread_nts()
+{
+    LogStagingState& log_staging_state = state();
+
+    if (!log_staging_state.thread.joinable())
+    {
+        return;
+    }
+
+    // New entries are passed from their thread from now on
+    log_staging_state.enabled.store(false);
+
+    // Let the threads that saw it enabled stage their entry, so the last drain passes it
+    while (log_staging_state.stagers.load() != 0)
+    {
+        std::this_thread::yield();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(log_staging_state.mutex);
+        log_staging_state.stop = true;
+    }
+    log_staging_state.collector_cv.notify_one();
+    log_staging_state.thread.join();
+}
+
+} /* namespace */
+
+constexpr std::size_t LogStaging::DEFAULT_BUFFER_SIZE;
+
+void LogStaging::start(
+        std::size_t buffer_size /* = DEFAULT_BUFFER_SIZE */)
+{
+    LogStagingState& log_staging_state = state();
+    std::lock_guard<std::mutex> thread_lock(log_staging_state.thread_mutex);
+
+    stop_thread_nts();
+
+    {
+        std::lock_guard<std::mutex> lock(log_staging_state.mutex);
+        log_staging_state.stop = false;
+    }
+
+    log_staging_state.buffer_size.store(buffer_size > 0 ? buffer_size : 1);
+    log_staging_state.thread = std::thread(run);
+    log_staging_state.enabled.store(true);
+}
+
+void LogStaging::stop()
+{
+    LogStagingState& log_staging_state = state();
+
+    {
+        std::lock_guard<std::mutex> thread_lock(log_staging_state.thread_mutex);
+        stop_thread_nts();
+    }
+
+    Log::Flush();
+}
+
+void LogStaging::flush()
+{
+    LogStagingState& log_staging_state = state();
+
+    if (log_staging_state.enabled.load() && std::this_thread::get_id() != log_staging_state.collector_id.load())
+    {
+        std::unique_lock<std::mutex> lock(log_staging_state.mutex);
+        const uint64_t flush = ++log_staging_state.flushes_requested;
+        log_staging_state.collector_cv.notify_one();
+        log_staging_state.flushed_cv.wait(lock, [&log_staging_state, flush]()
+                {
+                    return log_staging_state.flushes_done >= flush || log_staging_state.stop;
+                });
+    }
+
+    Log::Flush();
+}
+
+bool LogStaging::enabled() noexcept
+{
+    return state().enabled.load(std::memory_order_relaxed);
+}
+
+uint64_t LogStaging::overflow_entries() noexcept
+{
+    return state().overflow_entries.load();
+}
+
+void LogStaging::queue_log(
+        std::string&& message,
+        const Log::Context& context,
+        Log::Kind kind)
+{
+    LogStagingState& log_staging_state = state();
+
+    // Counted before checking enabled, so stop waits for this entry if it is staged
+    log_staging_state.stagers.fetch_add(1);
+    if (!log_staging_state.enabled.load())
+    {
+        log_staging_state.stagers.fetch_sub(1);
+        Log::QueueLog(message, context, kind);
+        return;
+    }
+
+    StagingBuffer& buffer = thread_buffer();
+    const uint64_t tail = buffer.tail.load(std::memory_order_relaxed);
+    if (tail - buffer.head.load(std::memory_order_acquire) >= buffer.entries.size())
+    {
+        // Wait until the entries of this thread are passed, so this one does not overtake them
+        wake_collector();
+        while (buffer.head.load(std::memory_order_acquire) != tail)
+        {
+            std::this_thread::yield();
+        }
+
+        log_staging_state.overflow_entries++;
+        Log::QueueLog(message, context, kind);
+        log_staging_state.stagers.fetch_sub(1);
+        return;
+    }
+
+    StagedEntry& entry = buffer.entries[tail % buffer.entries.size()];
+    entry.message.swap(message);
+    entry.context = context;
+    entry.kind = kind;
+    entry.timestamp = now();
+    buffer.tail.store(tail + 1, std::memory_order_seq_cst);
+
+    wake_collector();
+    log_staging_state.stagers.fetch_sub(1);
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
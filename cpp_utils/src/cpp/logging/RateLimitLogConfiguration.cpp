@@ -0,0 +1,54 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file RateLimitLogConfiguration.cpp
+ *
+ */
+
+#include <cpp_utils/logging/RateLimitLogConfiguration.hpp>
+#include <cpp_utils/math/math_extension.hpp>
+
+namespace eprosima {
+namespace utils {
+
+RateLimitLogConfiguration::RateLimitLogConfiguration()
+    : entries_per_second(10)
+    , burst(20)
+    , suppress_duplicates(true)
+    , table_size(1024)
+{
+}
+
+bool RateLimitLogConfiguration::is_valid(
+        Formatter& error_msg) const noexcept
+{
+    if (!(entries_per_second > 0) || burst == 0)
+    {
+        error_msg << "Rate and burst of the rate limit must be higher than 0.";
+        return false;
+    }
+
+    if (!is_power_of_2(table_size))
+    {
+        error_msg << "Table size of the rate limit must be a power of 2.";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
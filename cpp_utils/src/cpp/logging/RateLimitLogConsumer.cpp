@@ -0,0 +1,188 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file RateLimitLogConsumer.cpp
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/logging/RateLimitLogConsumer.hpp>
+#include <cpp_utils/math/math_extension.hpp>
+
+namespace eprosima {
+namespace utils {
+
+constexpr uint32_t RateLimitLogConsumer::MAX_PROBES;
+
+RateLimitLogConsumer::RateLimitLogConsumer(
+        std::unique_ptr<LogConsumer> consumer,
+        const RateLimitLogConfiguration& configuration /* = RateLimitLogConfiguration() */)
+    : consumer_(std::move(consumer))
+    , suppressed_entries_(0)
+{
+    Formatter error_msg;
+    if (!configuration.is_valid(error_msg))
+    {
+        throw InitializationException(STR_ENTRY
+                      << "Invalid rate limit configuration: " << error_msg << ".");
+    }
+
+    if (!consumer_)
+    {
+        throw InitializationException(STR_ENTRY
+                      << "Rate limit log consumer requires a consumer to pass entries on to.");
+    }
+
+    suppress_duplicates_ = configuration.suppress_duplicates;
+    entry_interval_ = static_cast<int64_t>(1e9 / configuration.entries_per_second);
+    burst_tolerance_ = entry_interval_ * (static_cast<int64_t>(configuration.burst) - 1);
+    table_mask_ = configuration.table_size - 1;
+    table_.reset(new SiteState[configuration.table_size]);
+}
+
+void RateLimitLogConsumer::Consume(
+        const Log::Entry& entry)
+{
+    SiteState* site = find_site_(site_key_(entry));
+    if (site == nullptr)
+    {
+        consumer_->Consume(entry);
+        return;
+    }
+
+    const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    uint64_t message = 0;
+    if (suppress_duplicates_)
+    {
+        message = hash_64(entry.message.data(), entry.message.size());
+
+        // Once the window is over, the repeat is passed on (if there is a token), with the count of the previous ones
+        if (message == site->last_message.load(std::memory_order_relaxed) &&
+                now - site->last_message_time.load(std::memory_order_relaxed) < entry_interval_)
+        {
+            site->repeated.fetch_add(1, std::memory_order_relaxed);
+            suppressed_entries_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    if (!take_token_(*site, now))
+    {
+        site->dropped.fetch_add(1, std::memory_order_relaxed);
+        suppressed_entries_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    report_suppressed_(*site, entry);
+    site->last_message.store(message, std::memory_order_relaxed);
+    site->last_message_time.store(now, std::memory_order_relaxed);
+    consumer_->Consume(entry);
+}
+
+uint64_t RateLimitLogConsumer::suppressed_entries() const noexcept
+{
+    return suppressed_entries_.load(std::memory_order_relaxed);
+}
+
+uint64_t RateLimitLogConsumer::site_key_(
+        const Log::Entry& entry) noexcept
+{
+    const char* category = entry.context.category != nullptr ? entry.context.category : "";
+    const char* file_name = entry.context.filename != nullptr ? entry.context.filename : "";
+
+    uint64_t key = hash_64(file_name, std::strlen(file_name), static_cast<uint64_t>(entry.context.line));
+    key = hash_64(category, std::strlen(category), key);
+
+    // 0 marks free positions
+    return key != 0 ? key : 1;
+}
+
+RateLimitLogConsumer::SiteState* RateLimitLogConsumer::find_site_(
+        uint64_t key) noexcept
+{
+    for (uint64_t probe = 0; probe < MAX_PROBES; ++probe)
+    {
+        SiteState& site = table_[(key + probe) & table_mask_];
+
+        uint64_t site_key = site.key.load(std::memory_order_acquire);
+        if (site_key == 0 && site.key.compare_exchange_strong(site_key, key, std::memory_order_acq_rel))
+        {
+            return &site;
+        }
+
+        // Either it was taken already, or another thread has just taken it
+        if (site_key == key)
+        {
+            return &site;
+        }
+    }
+
+    return nullptr;
+}
+
+bool RateLimitLogConsumer::take_token_(
+        SiteState& site,
+        int64_t now) const noexcept
+{
+    int64_t next_entry_time = site.next_entry_time.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        // The site is ahead of its rate by more than its burst
+        if (next_entry_time > now + burst_tolerance_)
+        {
+            return false;
+        }
+
+        const int64_t new_next_entry_time = std::max(next_entry_time, now) + entry_interval_;
+        if (site.next_entry_time.compare_exchange_weak(next_entry_time, new_next_entry_time,
+                std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+}
+
+void RateLimitLogConsumer::report_suppressed_(
+        SiteState& site,
+        const Log::Entry& entry)
+{
+    const uint64_t repeated = site.repeated.exchange(0, std::memory_order_relaxed);
+    const uint64_t dropped = site.dropped.exchange(0, std::memory_order_relaxed);
+
+    if (repeated > 0)
+    {
+        Log::Entry report(entry);
+        report.message = "Previous message repeated " + std::to_string(repeated) + " times.";
+        consumer_->Consume(report);
+    }
+
+    if (dropped > 0)
+    {
+        Log::Entry report(entry);
+        report.message = std::to_string(dropped) + " messages held back by the rate limit.";
+        consumer_->Consume(report);
+    }
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -18,12 +18,64 @@
  */
 
 #include <assert.h>
+#include <cstring>
 
 #include <cpp_utils/math/math_extension.hpp>
 
 namespace eprosima {
 namespace utils {
 
+namespace {
+
+constexpr const uint64_t HASH_PRIME_1 = 0x9E3779B185EBCA87ULL;
+constexpr const uint64_t HASH_PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr const uint64_t HASH_PRIME_3 = 0x165667B19E3779F9ULL;
+constexpr const uint64_t HASH_PRIME_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr const uint64_t HASH_PRIME_5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t rotate_left(
+        uint64_t value,
+        unsigned int bits) noexcept
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+// Unaligned little endian reads. memcpy is optimized by the compiler into a single load
+inline uint64_t read_64(
+        const unsigned char* data) noexcept
+{
+    uint64_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+inline uint32_t read_32(
+        const unsigned char* data) noexcept
+{
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+inline uint64_t hash_round(
+        uint64_t accumulator,
+        uint64_t input) noexcept
+{
+    accumulator += input * HASH_PRIME_2;
+    accumulator = rotate_left(accumulator, 31);
+    return accumulator * HASH_PRIME_1;
+}
+
+inline uint64_t hash_merge_round(
+        uint64_t accumulator,
+        uint64_t value) noexcept
+{
+    accumulator ^= hash_round(0, value);
+    return accumulator * HASH_PRIME_1 + HASH_PRIME_4;
+}
+
+} /* namespace */
+
 bool is_even(
         unsigned int number) noexcept
 {
@@ -141,5 +193,79 @@ unsigned int fast_exponential(
     }
 }
 
+uint64_t hash_64(
+        const void* data,
+        std::size_t size,
+        uint64_t seed /* = 0 */) noexcept
+{
+    const unsigned char* position = static_cast<const unsigned char*>(data);
+    const unsigned char* const end = position + size;
+
+    uint64_t hash;
+
+    if (size >= 32)
+    {
+        // Four independent accumulators, so the rounds of each stripe can run in parallel
+        uint64_t v1 = seed + HASH_PRIME_1 + HASH_PRIME_2;
+        uint64_t v2 = seed + HASH_PRIME_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - HASH_PRIME_1;
+
+        const unsigned char* const limit = end - 32;
+        do
+        {
+            v1 = hash_round(v1, read_64(position));
+            v2 = hash_round(v2, read_64(position + 8));
+            v3 = hash_round(v3, read_64(position + 16));
+            v4 = hash_round(v4, read_64(position + 24));
+            position += 32;
+        } while (position <= limit);
+
+        hash = rotate_left(v1, 1) + rotate_left(v2, 7) + rotate_left(v3, 12) + rotate_left(v4, 18);
+        hash = hash_merge_round(hash, v1);
+        hash = hash_merge_round(hash, v2);
+        hash = hash_merge_round(hash, v3);
+        hash = hash_merge_round(hash, v4);
+    }
+    else
+    {
+        hash = seed + HASH_PRIME_5;
+    }
+
+    hash += static_cast<uint64_t>(size);
+
+    // Remaining bytes
+    while (position + 8 <= end)
+    {
+        hash ^= hash_round(0, read_64(position));
+        hash = rotate_left(hash, 27) * HASH_PRIME_1 + HASH_PRIME_4;
+        position += 8;
+    }
+
+    if (position + 4 <= end)
+    {
+        hash ^= static_cast<uint64_t>(read_32(position)) * HASH_PRIME_1;
+        hash = rotate_left(hash, 23) * HASH_PRIME_2 + HASH_PRIME_3;
+        position += 4;
+    }
+
+    while (position < end)
+    {
+        hash ^= static_cast<uint64_t>(*position) * HASH_PRIME_5;
+        hash = rotate_left(hash, 11) * HASH_PRIME_1;
+        ++position;
+    }
+
+    // Avalanche
+    hash ^= hash >> 33;
+    hash *= HASH_PRIME_2;
+    hash ^= hash >> 29;
+    hash *= HASH_PRIME_3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
+
 } /* namespace utils */
 } /* namespace eprosima */
@@ -0,0 +1,302 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TaskGraph.cpp
+ *
+ * This file contains class TaskGraph implementation.
+ */
+
+#include <cpp_utils/exception/PreconditionNotMet.hpp>
+#include <cpp_utils/exception/ValueNotAllowedException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <cpp_utils/thread_pool/graph/TaskGraph.hpp>
+
+namespace eprosima {
+namespace utils {
+
+TaskGraph::TaskGraph(
+        SlotThreadPool& thread_pool)
+    : thread_pool_(thread_pool)
+    , modified_(false)
+    , running_(false)
+    , nodes_remaining_(0)
+    , failed_(false)
+    , exception_(nullptr)
+    , finished_(true)
+{
+}
+
+TaskGraph::~TaskGraph()
+{
+    // Slots reference this graph, so they must not be executed once it is destroyed
+    for (const TaskNode& node : nodes_)
+    {
+        if (node.registered)
+        {
+            thread_pool_.unslot(node.task_id);
+        }
+    }
+}
+
+TaskNodeId TaskGraph::add_task(
+        Task&& task)
+{
+    check_not_running_();
+
+    nodes_.emplace_back();
+    nodes_.back().task = std::move(task);
+    modified_ = true;
+
+    return nodes_.size() - 1;
+}
+
+void TaskGraph::add_dependency(
+        TaskNodeId predecessor,
+        TaskNodeId successor)
+{
+    check_not_running_();
+
+    if (predecessor >= nodes_.size() || successor >= nodes_.size())
+    {
+        throw utils::ValueNotAllowedException(STR_ENTRY
+                      << "Dependency " << predecessor << " -> " << successor << " references a task not in graph.");
+    }
+
+    if (predecessor == successor)
+    {
+        throw utils::ValueNotAllowedException(STR_ENTRY << "Task " << predecessor << " cannot depend on itself.");
+    }
+
+    nodes_[predecessor].successors.push_back(successor);
+    nodes_[successor].predecessors++;
+    modified_ = true;
+}
+
+void TaskGraph::run()
+{
+    if (running_.exchange(true))
+    {
+        throw utils::PreconditionNotMet("Task Graph is already running.");
+    }
+
+    // Tasks are only executed by the threads of the pool, so the run would never finish
+    if (!thread_pool_.enabled())
+    {
+        running_.store(false);
+        throw utils::PreconditionNotMet("Task Graph cannot run in a Thread Pool not enabled.");
+    }
+
+    try
+    {
+        prepare_();
+    }
+    catch (...)
+    {
+        running_.store(false);
+        throw;
+    }
+
+    if (nodes_.empty())
+    {
+        running_.store(false);
+        return;
+    }
+
+    // Reset the state of the run
+    for (TaskNode& node : nodes_)
+    {
+        node.pending_predecessors.store(node.predecessors, std::memory_order_relaxed);
+    }
+    nodes_remaining_.store(nodes_.size(), std::memory_order_relaxed);
+    failed_.store(false, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(finished_mutex_);
+        finished_ = false;
+        exception_ = nullptr;
+    }
+
+    logDebug(UTILS_THREAD_POOL, "Running Task Graph with " << nodes_.size() << " tasks.");
+
+    // Emit the nodes without dependencies, the rest are emitted by their predecessors
+    for (TaskNodeId root : roots_)
+    {
+        emit_node_(nodes_[root]);
+    }
+
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> lock(finished_mutex_);
+        finished_cv_.wait(
+            lock,
+            [this]
+            {
+                return finished_;
+            });
+        exception = exception_;
+    }
+
+    running_.store(false);
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+std::size_t TaskGraph::size() const noexcept
+{
+    return nodes_.size();
+}
+
+void TaskGraph::prepare_()
+{
+    if (!modified_)
+    {
+        return;
+    }
+
+    // Check there are no cycles by removing nodes without pending predecessors (Kahn's algorithm)
+    std::vector<unsigned int> pending(nodes_.size());
+    std::vector<TaskNodeId> ready;
+    roots_.clear();
+
+    for (TaskNodeId i = 0; i < nodes_.size(); ++i)
+    {
+        pending[i] = nodes_[i].predecessors;
+        if (pending[i] == 0)
+        {
+            roots_.push_back(i);
+            ready.push_back(i);
+        }
+    }
+
+    std::size_t visited = 0;
+    while (!ready.empty())
+    {
+        TaskNodeId current = ready.back();
+        ready.pop_back();
+        visited++;
+
+        for (TaskNodeId successor : nodes_[current].successors)
+        {
+            if (--pending[successor] == 0)
+            {
+                ready.push_back(successor);
+            }
+        }
+    }
+
+    if (visited != nodes_.size())
+    {
+        throw utils::PreconditionNotMet(STR_ENTRY
+                      << "Task Graph has a cycle: " << nodes_.size() - visited << " tasks could never run.");
+    }
+
+    // Register new nodes in the pool
+    for (TaskNode& node : nodes_)
+    {
+        if (!node.registered)
+        {
+            node.task_id = new_unique_task_id();
+            TaskNode* node_ptr = &node;
+            thread_pool_.slot(
+                node.task_id,
+                [this, node_ptr]
+                    ()
+                {
+                    this->execute_node_(*node_ptr);
+                });
+            node.registered = true;
+        }
+    }
+
+    modified_ = false;
+}
+
+void TaskGraph::execute_node_(
+        TaskNode& node) noexcept
+{
+    // Once a task has failed, the rest of the run is only traversed to release every node
+    if (!failed_.load(std::memory_order_acquire))
+    {
+        try
+        {
+            node.task();
+        }
+        catch (...)
+        {
+            fail_(std::current_exception());
+        }
+    }
+
+    // Release successors whose last dependency was this node
+    for (TaskNodeId successor : node.successors)
+    {
+        if (nodes_[successor].pending_predecessors.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            emit_node_(nodes_[successor]);
+        }
+    }
+
+    if (nodes_remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        // Notify with mutex taken, as the graph could be destroyed as soon as run() sees it finished
+        std::lock_guard<std::mutex> lock(finished_mutex_);
+        finished_ = true;
+        finished_cv_.notify_all();
+    }
+}
+
+void TaskGraph::emit_node_(
+        TaskNode& node) noexcept
+{
+    try
+    {
+        thread_pool_.emit(node.task_id);
+        return;
+    }
+    catch (...)
+    {
+        fail_(std::current_exception());
+    }
+
+    // The pool will never execute this node, so it is traversed here (skipping its task, as the run has failed)
+    execute_node_(node);
+}
+
+void TaskGraph::fail_(
+        std::exception_ptr exception) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(finished_mutex_);
+        if (!exception_)
+        {
+            exception_ = exception;
+        }
+    }
+    failed_.store(true, std::memory_order_release);
+}
+
+void TaskGraph::check_not_running_() const
+{
+    if (running_.load())
+    {
+        throw utils::PreconditionNotMet("Task Graph cannot be modified while running.");
+    }
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -0,0 +1,214 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ParallelExecutor.cpp
+ *
+ * This file contains class ParallelExecutor implementation.
+ */
+
+#include <algorithm>
+
+#include <cpp_utils/Log.hpp>
+
+#include <cpp_utils/thread_pool/parallel/ParallelExecutor.hpp>
+
+namespace eprosima {
+namespace utils {
+
+ParallelJob::ParallelJob(
+        std::size_t n_chunks,
+        void (* invoke)(void*, std::size_t),
+        void* context) noexcept
+    : n_chunks(n_chunks)
+    , next_chunk(0)
+    , invoke(invoke)
+    , context(context)
+    , helpers_active(0)
+    , exception(nullptr)
+    , next(nullptr)
+{
+}
+
+void ParallelJobQueue::push(
+        ParallelJob& job) noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Jobs are appended at the end, so helpers serve the oldest one first
+    ParallelJob** last = &head_;
+    while (*last != nullptr)
+    {
+        last = &(*last)->next;
+    }
+    *last = &job;
+}
+
+void ParallelJobQueue::remove_and_wait(
+        ParallelJob& job) noexcept
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    // Unlink job so no new helper joins it
+    for (ParallelJob** it = &head_; *it != nullptr; it = &(*it)->next)
+    {
+        if (*it == &job)
+        {
+            *it = job.next;
+            break;
+        }
+    }
+
+    // Wait for the helpers that are still executing its last chunks
+    helper_left_cv_.wait(
+        lock,
+        [&job]
+        {
+            return job.helpers_active == 0;
+        });
+}
+
+void ParallelJobQueue::help() noexcept
+{
+    ParallelJob* job;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // Join the oldest job that still has chunks to take
+        job = head_;
+        while (job != nullptr && job->next_chunk.load(std::memory_order_relaxed) >= job->n_chunks)
+        {
+            job = job->next;
+        }
+
+        if (job == nullptr)
+        {
+            // The job this task was emitted for has already finished
+            return;
+        }
+
+        ++job->helpers_active;
+    }
+
+    execute_chunks(*job);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --job->helpers_active;
+    }
+    helper_left_cv_.notify_all();
+}
+
+void ParallelJobQueue::execute_chunks(
+        ParallelJob& job) noexcept
+{
+    while (true)
+    {
+        const std::size_t chunk = job.next_chunk.fetch_add(1, std::memory_order_relaxed);
+        if (chunk >= job.n_chunks)
+        {
+            return;
+        }
+
+        try
+        {
+            job.invoke(job.context, chunk);
+        }
+        catch (...)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!job.exception)
+                {
+                    job.exception = std::current_exception();
+                }
+            }
+
+            // Skip every chunk not started yet
+            job.next_chunk.store(job.n_chunks, std::memory_order_relaxed);
+        }
+    }
+}
+
+ParallelExecutor::ParallelExecutor(
+        SlotThreadPool& thread_pool)
+    : thread_pool_(thread_pool)
+    , task_id_(new_unique_task_id())
+    , jobs_(std::make_shared<ParallelJobQueue>())
+{
+    // The slot holds its own reference to the queue, so it is safe to execute it after this object is destroyed
+    std::shared_ptr<ParallelJobQueue> jobs = jobs_;
+    thread_pool_.slot(
+        task_id_,
+        [jobs]
+            ()
+        {
+            jobs->help();
+        });
+
+    logDebug(UTILS_THREAD_POOL, "Parallel Executor created with slot " << task_id_ << ".");
+}
+
+ParallelExecutor::~ParallelExecutor()
+{
+    // Helpers emitted and not executed yet are skipped by the pool, and those running find an empty queue
+    thread_pool_.unslot(task_id_);
+}
+
+unsigned int ParallelExecutor::concurrency() const noexcept
+{
+    return thread_pool_.number_of_threads() + 1;
+}
+
+void ParallelExecutor::start_(
+        ParallelJob& job)
+{
+    // The calling thread executes chunks as well, so more helpers than chunks - 1 would never find work
+    const std::size_t helpers = std::min<std::size_t>(job.n_chunks - 1, thread_pool_.number_of_threads());
+    if (helpers == 0)
+    {
+        return;
+    }
+
+    jobs_->push(job);
+    try
+    {
+        for (std::size_t i = 0; i < helpers; ++i)
+        {
+            thread_pool_.emit(task_id_);
+        }
+    }
+    catch (...)
+    {
+        // The job lives in the stack being unwound: skip its chunks not started and wait for its helpers to leave
+        job.next_chunk.store(job.n_chunks, std::memory_order_relaxed);
+        jobs_->remove_and_wait(job);
+        throw;
+    }
+}
+
+void ParallelExecutor::finish_(
+        ParallelJob& job)
+{
+    jobs_->remove_and_wait(job);
+
+    if (job.exception)
+    {
+        std::rethrow_exception(job.exception);
+    }
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -27,6 +27,13 @@
 namespace eprosima {
 namespace utils {
 
+namespace {
+
+//! Slot whose task this thread is executing, if any.
+thread_local const void* executing_slot = nullptr;
+
+} /* namespace */
+
 SlotThreadPool::SlotThreadPool(
         const uint32_t n_threads)
     : number_of_threads_(n_threads)
@@ -85,7 +92,7 @@ void SlotThreadPool::emit(
 
     auto it = slots_.find(task_id);
 
-    if (it == slots_.end())
+    if (it == slots_.end() || it->second.removed)
     {
         throw utils::ValueNotAllowedException(STR_ENTRY << "Slot " << task_id << " not registered.");
     }
@@ -110,16 +117,60 @@ void SlotThreadPool::slot(
     }
     else
     {
-        slots_.insert(std::make_pair(task_id, std::move(task)));
+        slots_.emplace(task_id, std::move(task));
     }
 }
 
+void SlotThreadPool::unslot(
+        const TaskId& task_id)
+{
+    // Lock to access the slot map
+    std::unique_lock<std::mutex> lock(slots_mutex_);
+
+    auto it = slots_.find(task_id);
+
+    if (it == slots_.end() || it->second.removed)
+    {
+        throw utils::ValueNotAllowedException(STR_ENTRY << "Slot " << task_id << " not registered.");
+    }
+
+    // No thread starts the task from now on
+    it->second.removed = true;
+
+    if (it->second.running == 0)
+    {
+        slots_.erase(it);
+        return;
+    }
+
+    // Called from the task itself, the last execution erases the slot once it returns
+    if (executing_slot == &it->second)
+    {
+        return;
+    }
+
+    slots_cv_.wait(lock, [this, &task_id]()
+            {
+                return slots_.find(task_id) == slots_.end();
+            });
+}
+
 utils::event::AwakeReason SlotThreadPool::wait_all_consumed(
         const utils::Duration_ms& timeout /* = 0 */)
 {
     return task_queue_.wait_all_consumed(timeout);
 }
 
+bool SlotThreadPool::enabled() const noexcept
+{
+    return enabled_.load();
+}
+
+unsigned int SlotThreadPool::number_of_threads() const noexcept
+{
+    return number_of_threads_;
+}
+
 void SlotThreadPool::thread_routine_()
 {
     logDebug(UTILS_THREAD_POOL, "Starting thread routine: " << std::this_thread::get_id() << ".");
@@ -132,21 +183,54 @@ void SlotThreadPool::thread_routine_()
             TaskId task_id = task_queue_.consume();
 
             // Lock to access the slot map
-            slots_mutex_.lock();
+            std::unique_lock<std::mutex> lock(slots_mutex_);
 
             auto it = slots_.find(task_id);
-            // Check the slot is correct
-            if (it == slots_.end())
+            // The slot may have been removed after its id was added to the queue
+            if (it == slots_.end() || it->second.removed)
             {
-                utils::tsnh(STR_ENTRY << "Slot in Queue must be stored in slots register");
+                logDebug(UTILS_THREAD_POOL, "Slot " << task_id << " removed, skipping it.");
+                continue;
             }
 
-            Task& task = it->second;
+            // The slot is not erased while running, as unslot waits for it
+            it->second.running++;
+
+            lock.unlock();
 
-            slots_mutex_.unlock();
+            //! Marks the slot as executed by this thread, until the task returns or throws.
+            struct RunningSlot
+            {
+                RunningSlot(
+                        SlotThreadPool& slot_pool,
+                        std::map<TaskId, Slot>::iterator slot_it)
+                    : pool(slot_pool)
+                    , it(slot_it)
+                    , previous_slot(executing_slot)
+                {
+                    executing_slot = &it->second;
+                }
+
+                ~RunningSlot()
+                {
+                    executing_slot = previous_slot;
+
+                    std::lock_guard<std::mutex> lock(pool.slots_mutex_);
+                    if (--it->second.running == 0 && it->second.removed)
+                    {
+                        pool.slots_.erase(it);
+                        pool.slots_cv_.notify_all();
+                    }
+                }
+
+                SlotThreadPool& pool;
+                std::map<TaskId, Slot>::iterator it;
+                const void* previous_slot;
+            };
 
             logDebug(UTILS_THREAD_POOL, "Thread: " << std::this_thread::get_id() << " executing callback.");
-            task();
+            RunningSlot running_slot(*this, it);
+            it->second.task();
         }
     }
     catch (const utils::DisabledException& e)
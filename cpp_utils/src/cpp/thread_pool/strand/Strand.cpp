@@ -0,0 +1,190 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Strand.cpp
+ *
+ * This file contains class Strand implementation.
+ */
+
+#include <exception>
+#include <thread>
+
+#include <cpp_utils/Log.hpp>
+
+#include <cpp_utils/thread_pool/strand/Strand.hpp>
+
+namespace eprosima {
+namespace utils {
+
+StrandQueue::StrandQueue()
+    : head_(new Node())
+    , pending_(0)
+    , orphan_(false)
+    , released_(false)
+{
+    tail_.store(head_);
+}
+
+StrandQueue::~StrandQueue()
+{
+    Node* node = head_;
+    while (node != nullptr)
+    {
+        Node* next = node->next.load(std::memory_order_relaxed);
+        delete node;
+        node = next;
+    }
+}
+
+bool StrandQueue::push(
+        Task&& task)
+{
+    Node* node = new Node();
+    node->task = std::move(task);
+
+    // Link the node after the previous tail. Until the link is stored, the consumer cannot reach it
+    Node* previous = tail_.exchange(node, std::memory_order_acq_rel);
+    previous->next.store(node, std::memory_order_release);
+
+    // Count it only once it is linked, so the consumer never waits for a task counted but not appended
+    return pending_.fetch_add(1, std::memory_order_acq_rel) == 0;
+}
+
+bool StrandQueue::execute(
+        unsigned int max_tasks) noexcept
+{
+    for (unsigned int executed = 1;; ++executed)
+    {
+        Task task = pop_();
+
+        try
+        {
+            task();
+        }
+        catch (const std::exception& e)
+        {
+            logWarning(UTILS_THREAD_POOL, "Task in strand threw an exception: " << e.what() << ".");
+        }
+        catch (...)
+        {
+            logWarning(UTILS_THREAD_POOL, "Task in strand threw an unknown exception.");
+        }
+
+        if (pending_.fetch_sub(1) == 1)
+        {
+            // Queue is empty, next push schedules it again
+            return false;
+        }
+
+        if (executed >= max_tasks)
+        {
+            return true;
+        }
+    }
+}
+
+std::size_t StrandQueue::pending() const noexcept
+{
+    return pending_.load(std::memory_order_acquire);
+}
+
+bool StrandQueue::orphan() noexcept
+{
+    // Sequentially consistent with the checks in release, so one of both sees the queue orphan and empty
+    orphan_.store(true);
+    return pending_.load() == 0 && !released_.exchange(true);
+}
+
+bool StrandQueue::release() noexcept
+{
+    return orphan_.load() && pending_.load() == 0 && !released_.exchange(true);
+}
+
+Task StrandQueue::pop_() noexcept
+{
+    Node* next = head_->next.load(std::memory_order_acquire);
+
+    // A producer of an older node could have exchanged the tail but not linked it yet, which takes a few instructions
+    while (next == nullptr)
+    {
+        std::this_thread::yield();
+        next = head_->next.load(std::memory_order_acquire);
+    }
+
+    // The node taken becomes the new head, and the previous one is no longer referenced by anyone
+    Task task = std::move(next->task);
+    delete head_;
+    head_ = next;
+
+    return task;
+}
+
+constexpr unsigned int Strand::MAX_TASKS_PER_EMISSION;
+
+Strand::Strand(
+        SlotThreadPool& thread_pool)
+    : thread_pool_(thread_pool)
+    , task_id_(new_unique_task_id())
+    , queue_(std::make_shared<StrandQueue>())
+{
+    // The slot holds its own reference to the queue, so tasks posted are executed even after this object is destroyed
+    std::shared_ptr<StrandQueue> queue = queue_;
+    SlotThreadPool* pool = &thread_pool_;
+    TaskId task_id = task_id_;
+    thread_pool_.slot(
+        task_id_,
+        [queue, pool, task_id]
+            ()
+        {
+            if (queue->execute(MAX_TASKS_PER_EMISSION))
+            {
+                // Go back to the end of the pool queue so other slots are not starved
+                pool->emit(task_id);
+            }
+            else if (queue->release())
+            {
+                // The strand is destroyed and its last task has finished
+                pool->unslot(task_id);
+            }
+        });
+
+    logDebug(UTILS_THREAD_POOL, "Strand created with slot " << task_id_ << ".");
+}
+
+Strand::~Strand()
+{
+    // With tasks pending, the slot removes itself once they are finished
+    if (queue_->orphan())
+    {
+        thread_pool_.unslot(task_id_);
+    }
+}
+
+void Strand::post(
+        Task&& task)
+{
+    if (queue_->push(std::move(task)))
+    {
+        thread_pool_.emit(task_id_);
+    }
+}
+
+std::size_t Strand::pending() const noexcept
+{
+    return queue_->pending();
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
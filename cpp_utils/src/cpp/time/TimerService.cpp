@@ -0,0 +1,166 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TimerService.cpp
+ *
+ */
+
+#include <exception>
+
+#include <cpp_utils/Log.hpp>
+
+#include <cpp_utils/time/TimerService.hpp>
+
+namespace eprosima {
+namespace utils {
+
+TimerService::TimerService()
+    : running_task_(0)
+    , next_id_(1)
+    , stop_(false)
+{
+    thread_ = std::thread(&TimerService::thread_routine_, this);
+}
+
+TimerService::~TimerService()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_up_cv_.notify_all();
+
+    thread_.join();
+}
+
+TimerService& TimerService::shared()
+{
+    static TimerService service;
+    return service;
+}
+
+TimerTaskId TimerService::schedule(
+        Clock::time_point time,
+        std::function<void()> task)
+{
+    bool earliest;
+    TimerTaskId id;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        id = next_id_++;
+        auto it = tasks_.emplace(std::make_pair(time, id), std::move(task)).first;
+        task_times_[id] = time;
+
+        earliest = it == tasks_.begin();
+    }
+
+    // Only wake up the thread if it is sleeping until a later time
+    if (earliest)
+    {
+        wake_up_cv_.notify_all();
+    }
+
+    return id;
+}
+
+TimerTaskId TimerService::schedule(
+        Duration_ms delay,
+        std::function<void()> task)
+{
+    return schedule(Clock::now() + std::chrono::milliseconds(delay), std::move(task));
+}
+
+bool TimerService::cancel(
+        TimerTaskId id) noexcept
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    auto it = task_times_.find(id);
+    if (it != task_times_.end())
+    {
+        tasks_.erase(std::make_pair(it->second, id));
+        task_times_.erase(it);
+        return true;
+    }
+
+    // Task could be running: wait for it unless it is cancelling itself
+    if (id != 0 && std::this_thread::get_id() != thread_.get_id())
+    {
+        task_finished_cv_.wait(
+            lock,
+            [this, id]
+            {
+                return running_task_ != id;
+            });
+    }
+
+    return false;
+}
+
+std::size_t TimerService::size() const noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return tasks_.size();
+}
+
+void TimerService::thread_routine_() noexcept
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (!stop_)
+    {
+        if (tasks_.empty())
+        {
+            wake_up_cv_.wait(lock);
+            continue;
+        }
+
+        auto next = tasks_.begin();
+        if (next->first.first > Clock::now())
+        {
+            wake_up_cv_.wait_until(lock, next->first.first);
+            continue;
+        }
+
+        // Take the task and execute it without the mutex, so it can schedule or cancel tasks
+        std::function<void()> task = std::move(next->second);
+        running_task_ = next->first.second;
+        task_times_.erase(running_task_);
+        tasks_.erase(next);
+
+        lock.unlock();
+
+        try
+        {
+            task();
+        }
+        catch (const std::exception& e)
+        {
+            logWarning(UTILS_TIMERSERVICE, "Timer task threw an exception: " << e.what() << ".");
+        }
+
+        // Release the task before notifying, as its captures could be destroyed once cancel returns
+        task = nullptr;
+
+        lock.lock();
+        running_task_ = 0;
+        task_finished_cv_.notify_all();
+    }
+}
+
+} /* namespace utils */
+} /* namespace eprosima */
@@ -210,6 +210,8 @@ std::string from_bytes(
 void tsnh(
         const Formatter& formatter)
 {
+    // Entries staged before are passed first, so they are not lost when aborting
+    LogStaging::flush();
     logError(UTILS_TSNH, "This Should Not Have Happened: " << formatter.to_string());
     Log::Flush();
 
@@ -0,0 +1,403 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/collection/database/SafeDatabase.hpp>
+#include <cpp_utils/collection/database/ShardedSafeDatabase.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+#include <cpp_utils/wait/BooleanWaitHandler.hpp>
+
+namespace test {
+
+class Key
+{
+public:
+
+    Key(
+            const char* name)
+        : name_(name)
+    {
+    }
+
+    bool operator <(
+            const Key& other) const
+    {
+        return name_ < other.name();
+    }
+
+    std::string name() const
+    {
+        return name_;
+    }
+
+private:
+
+    std::string name_;
+};
+
+//! Hash of \c Key , by its name.
+struct KeyHash
+{
+    std::size_t operator ()(
+            const Key& key) const
+    {
+        return std::hash<std::string>()(key.name());
+    }
+};
+
+/**
+ * Time per write of \c n_threads threads adding, modifying and erasing keys of their own in \c db at once.
+ *
+ * @return nanoseconds per write
+ */
+template <typename Database>
+double write_time(
+        Database& db,
+        unsigned int n_threads,
+        unsigned int n_keys)
+{
+    std::vector<std::thread> threads;
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int t = 0; t < n_threads; ++t)
+    {
+        threads.emplace_back([&db, t, n_keys]()
+                {
+                    const int first = static_cast<int>(t * n_keys);
+                    for (int key = first; key < first + static_cast<int>(n_keys); ++key)
+                    {
+                        db.add(key, key);
+                        db.modify(key, key + 1);
+                    }
+                    for (int key = first; key < first + static_cast<int>(n_keys); ++key)
+                    {
+                        db.erase(key);
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / (3.0 * n_threads * n_keys);
+}
+
+} // namespace test
+
+using namespace eprosima::utils;
+
+/**
+ * Add values to a <int, int> database, and check they are found in their shards.
+ *
+ * STEPS:
+ * - add values
+ * - try to add an already existant value
+ * - check values exist and get them
+ * - find values
+ * - find a non existant value
+ */
+TEST(ShardedSafeDatabaseTest, add_find)
+{
+    ShardedSafeDatabase<int, int> db(4);
+    ASSERT_EQ(db.shards(), 4u);
+
+    // add values
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(db.add(i, i * 1000));
+    }
+
+    // try to add an already existant value
+    ASSERT_FALSE(db.add(1, 2));
+    int k = 3;
+    ASSERT_FALSE(db.add(k, 4000));
+
+    // check values exist and get them
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(db.is(i));
+        ASSERT_EQ(db.at(i), i * 1000);
+    }
+    ASSERT_FALSE(db.is(100));
+    ASSERT_THROW(db.at(100), std::out_of_range);
+
+    // find values
+    {
+        auto it = db.find(42);
+        ASSERT_EQ(it->first, 42);
+        ASSERT_EQ(it->second, 42000);
+
+        // The iteration goes on from the key found
+        ++it;
+        ASSERT_EQ(it->first, 43);
+    }
+
+    // find a non existant value
+    ASSERT_EQ(db.find(100), db.end());
+}
+
+/**
+ * Modify, add or modify and erase values of a <int, int> database, checking its size.
+ *
+ * STEPS:
+ * - add values
+ * - modify them, and try to modify a non existant value
+ * - add or modify values
+ * - erase values, and try to erase them again
+ */
+TEST(ShardedSafeDatabaseTest, modify_erase)
+{
+    ShardedSafeDatabase<int, int> db;
+    ASSERT_EQ(db.size(), 0u);
+
+    // add values
+    ASSERT_TRUE(db.add(1, 1000));
+    ASSERT_TRUE(db.add(2, 2000));
+    ASSERT_EQ(db.size(), 2u);
+
+    // modify them, and try to modify a non existant value
+    ASSERT_TRUE(db.modify(1, 1500));
+    ASSERT_FALSE(db.modify(3, 3000));
+    ASSERT_EQ(db.at(1), 1500);
+    ASSERT_EQ(db.size(), 2u);
+
+    // add or modify values
+    ASSERT_TRUE(db.add_or_modify(3, 3000));
+    int k = 2;
+    ASSERT_FALSE(db.add_or_modify(k, 2500));
+    ASSERT_EQ(db.at(2), 2500);
+    ASSERT_EQ(db.at(3), 3000);
+    ASSERT_EQ(db.size(), 3u);
+
+    // erase values, and try to erase them again
+    ASSERT_TRUE(db.erase(1));
+    ASSERT_TRUE(db.erase(3));
+    ASSERT_FALSE(db.erase(1));
+    ASSERT_FALSE(db.is(1));
+    ASSERT_TRUE(db.is(2));
+    ASSERT_EQ(db.size(), 1u);
+}
+
+/**
+ * Iteration merges the shards, giving every value once and in the order of the keys.
+ *
+ * CASES:
+ * - Empty database
+ * - Database of a single shard
+ * - Database of more shards than values
+ * - Custom key and hash
+ */
+TEST(ShardedSafeDatabaseTest, iterate)
+{
+    // Empty database
+    {
+        ShardedSafeDatabase<int, int> db;
+        ASSERT_EQ(db.begin(), db.end());
+    }
+
+    for (unsigned int shards : {1u, 8u, 1000u})
+    {
+        ShardedSafeDatabase<int, int> db(shards);
+        for (int i = 99; i >= 0; --i)
+        {
+            ASSERT_TRUE(db.add(i * 3, i));
+        }
+
+        int expected = 0;
+        for (const auto& kv : db)
+        {
+            ASSERT_EQ(kv.first, expected * 3);
+            ASSERT_EQ(kv.second, expected);
+            expected++;
+        }
+        ASSERT_EQ(expected, 100);
+    }
+
+    // Custom key and hash
+    {
+        ShardedSafeDatabase<test::Key, std::string, test::KeyHash> db;
+        ASSERT_TRUE(db.add("c", "3"));
+        ASSERT_TRUE(db.add("a", "1"));
+        ASSERT_TRUE(db.add("b", "2"));
+
+        std::string values;
+        auto it_end = db.end();
+        for (auto it = db.begin(); it != it_end; ++it)
+        {
+            values += it->first.name() + "=" + it->second + " ";
+        }
+        ASSERT_EQ(values, "a=1 b=2 c=3 ");
+    }
+}
+
+/**
+ * Access database from different threads at the same time, writing keys of the same and of different shards.
+ * Every value written is found afterwards, and the size matches them once every thread has finished.
+ */
+TEST(ShardedSafeDatabaseTest, test_thread_safe)
+{
+    constexpr int N_THREADS = 8;
+    constexpr int N_KEYS = 500;
+
+    ShardedSafeDatabase<int, int> db(4);
+
+    auto routine = [&db](int t)
+            {
+                for (int i = 0; i < N_KEYS; ++i)
+                {
+                    const int key = t * N_KEYS + i;
+                    ASSERT_TRUE(db.add(key, key));
+                    ASSERT_TRUE(db.is(key));
+                    ASSERT_TRUE(db.modify(key, key * 2));
+                    ASSERT_EQ(db.at(key), key * 2);
+                }
+
+                // Erase half of the keys, while others iterate
+                for (int i = 0; i < N_KEYS; i += 2)
+                {
+                    ASSERT_TRUE(db.erase(t * N_KEYS + i));
+                }
+
+                int previous = -1;
+                for (const auto& kv : db)
+                {
+                    ASSERT_LT(previous, kv.first);
+                    previous = kv.first;
+                }
+            };
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < N_THREADS; ++t)
+    {
+        threads.emplace_back(routine, t);
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(db.size(), static_cast<unsigned int>(N_THREADS * N_KEYS / 2));
+
+    int count = 0;
+    for (const auto& kv : db)
+    {
+        ASSERT_EQ(kv.first % 2, 1);
+        ASSERT_EQ(kv.second, kv.first * 2);
+        count++;
+    }
+    ASSERT_EQ(count, N_THREADS * N_KEYS / 2);
+}
+
+/**
+ * Check that iterating over the database maintains its status, even when adding values to any shard.
+ *
+ * STEPS:
+ * - Add some values
+ * - Start iteration
+ * - Give access to another thread to add a value
+ * - Wait to be sure the adding thread has awaken
+ * - Finish iteration and database should be kept intact
+ */
+TEST(ShardedSafeDatabaseTest, loop_while_insertion)
+{
+    ShardedSafeDatabase<int, int> db;
+
+    // Waiter to notify to add values
+    event::BooleanWaitHandler waiter_add(false, true);
+
+    // Add some values
+    db.add(1, 1000);
+    db.add(2, 2000);
+    db.add(3, 3000);
+    db.add(4, 4000);
+
+    std::thread addition_test(
+        [&db, &waiter_add]()
+        {
+            waiter_add.wait();
+            db.add(5, 5000);
+        }
+        );
+
+    {
+        int sum_key = 0;
+        int sum_value = 0;
+        int i = 0;
+
+        auto it_end = db.end();  // This is required due to windows handle of shared mutex
+        for (auto it = db.begin(); it != it_end; ++it)
+        {
+            if (i == 2)
+            {
+                waiter_add.open();
+                sleep_for(10);
+            }
+            sum_key += it->first;
+            sum_value += it->second;
+
+            i++;
+        }
+
+        ASSERT_EQ(sum_key, 10);
+        ASSERT_EQ(sum_value, 10000);
+    }
+
+    addition_test.join();
+
+    ASSERT_EQ(db.size(), 5u);
+}
+
+/**
+ * Measure the time per write of several threads writing keys of their own at once,
+ * in a \c SafeDatabase and in a \c ShardedSafeDatabase .
+ * It is reported as a property of the test, and printed.
+ */
+TEST(ShardedSafeDatabaseTest, write_scaling)
+{
+    constexpr unsigned int N_KEYS = 20000;
+
+    for (unsigned int n_threads : {1u, 4u})
+    {
+        SafeDatabase<int, int> safe_db;
+        ShardedSafeDatabase<int, int> sharded_db;
+
+        const double ns_safe = test::write_time(safe_db, n_threads, N_KEYS);
+        const double ns_sharded = test::write_time(sharded_db, n_threads, N_KEYS);
+        ASSERT_EQ(safe_db.size(), 0u);
+        ASSERT_EQ(sharded_db.size(), 0u);
+
+        const std::string threads = std::to_string(n_threads) + "_threads";
+        RecordProperty("ns_per_write_safe_" + threads, std::to_string(ns_safe));
+        RecordProperty("ns_per_write_sharded_" + threads, std::to_string(ns_sharded));
+        std::cout << "SafeDatabase write with " << n_threads << " threads: " << ns_safe << " ns" << std::endl;
+        std::cout << "ShardedSafeDatabase write with " << n_threads << " threads: " << ns_sharded << " ns" << std::endl;
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
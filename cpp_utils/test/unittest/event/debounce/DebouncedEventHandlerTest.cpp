@@ -0,0 +1,361 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/event/DebouncedEventHandler.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+namespace test {
+
+constexpr uint32_t N_EVENTS_IN_TEST = 20;
+
+/**
+ * EventHandler whose events are raised by the test.
+ */
+class MockEventHandler : public EventHandler<int, const std::string&>
+{
+public:
+
+    ~MockEventHandler()
+    {
+        unset_callback();
+    }
+
+    void raise(
+            int value)
+    {
+        event_occurred_(value, std::to_string(value));
+    }
+
+};
+
+/**
+ * Values received by the callback of a DebouncedEventHandler.
+ */
+struct Received
+{
+    void push(
+            int value,
+            const std::string& text)
+    {
+        ASSERT_EQ(std::to_string(value), text);
+        std::lock_guard<std::mutex> lock(mutex);
+        values.push_back(value);
+    }
+
+    std::vector<int> get()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return values;
+    }
+
+    std::mutex mutex;
+    std::vector<int> values;
+};
+
+} /* namespace test */
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils;
+using namespace eprosima::utils::event;
+
+/**
+ * Raise a burst of events and check only the last one is received, once the burst has finished.
+ */
+TEST(DebouncedEventHandlerTest, debounce_burst)
+{
+    test::MockEventHandler* source = new test::MockEventHandler();
+    test::Received received;
+
+    DebounceConfiguration configuration;
+    configuration.debounce_window = 50;
+
+    DebouncedEventHandler<int, const std::string&> handler(
+        [&received](int value, const std::string& text)
+        {
+            received.push(value, text);
+        },
+        std::unique_ptr<EventHandler<int, const std::string&>>(source),
+        configuration);
+
+    for (uint32_t i = 0; i < test::N_EVENTS_IN_TEST; ++i)
+    {
+        source->raise(i);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(received.get().empty());
+
+    ASSERT_TRUE(handler.wait_for_event(1));
+    ASSERT_EQ(received.get(), std::vector<int>{test::N_EVENTS_IN_TEST - 1});
+
+    // A new burst is received separately
+    source->raise(100);
+    ASSERT_TRUE(handler.wait_for_event(2));
+    ASSERT_EQ(received.get(), (std::vector<int>{test::N_EVENTS_IN_TEST - 1, 100}));
+}
+
+/**
+ * Raise a burst of events with throttle and check the first one is received at once and the last one later.
+ */
+TEST(DebouncedEventHandlerTest, throttle_leading_edge)
+{
+    test::MockEventHandler* source = new test::MockEventHandler();
+    test::Received received;
+
+    DebounceConfiguration configuration;
+    configuration.throttle_window = 100;
+
+    DebouncedEventHandler<int, const std::string&> handler(
+        [&received](int value, const std::string& text)
+        {
+            received.push(value, text);
+        },
+        std::unique_ptr<EventHandler<int, const std::string&>>(source),
+        configuration);
+
+    for (uint32_t i = 0; i < test::N_EVENTS_IN_TEST; ++i)
+    {
+        source->raise(i);
+    }
+
+    // First event is received in the raising thread
+    ASSERT_EQ(received.get(), std::vector<int>{0});
+
+    ASSERT_TRUE(handler.wait_for_event(2));
+    ASSERT_EQ(received.get(), (std::vector<int>{0, test::N_EVENTS_IN_TEST - 1}));
+}
+
+/**
+ * Raise events continuously and check max wait releases them even if the source never gets quiet.
+ */
+TEST(DebouncedEventHandlerTest, max_wait)
+{
+    test::MockEventHandler* source = new test::MockEventHandler();
+    test::Received received;
+
+    DebounceConfiguration configuration;
+    configuration.debounce_window = 50;
+    configuration.max_wait = 100;
+
+    DebouncedEventHandler<int, const std::string&> handler(
+        [&received](int value, const std::string& text)
+        {
+            received.push(value, text);
+        },
+        std::unique_ptr<EventHandler<int, const std::string&>>(source),
+        configuration);
+
+    // Events every 10ms during 400ms never leave the debounce window quiet
+    for (int i = 0; i < 40; ++i)
+    {
+        source->raise(i);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    std::vector<int> values = received.get();
+    ASSERT_GE(values.size(), 2u);
+    ASSERT_LE(values.size(), 5u);
+    for (std::size_t i = 1; i < values.size(); ++i)
+    {
+        ASSERT_LT(values[i - 1], values[i]);
+    }
+}
+
+/**
+ * Use an aggregator to sum the values of every event in a burst.
+ */
+TEST(DebouncedEventHandlerTest, aggregation)
+{
+    using Handler = DebouncedEventHandler<int, const std::string&>;
+
+    test::MockEventHandler* source = new test::MockEventHandler();
+    std::atomic<int> sum(0);
+
+    DebounceConfiguration configuration;
+    configuration.debounce_window = 50;
+
+    Handler handler(
+        [&sum](int value, const std::string&)
+        {
+            sum.store(value);
+        },
+        std::unique_ptr<EventHandler<int, const std::string&>>(source),
+        configuration,
+        [](Handler::Arguments& accumulated, const Handler::Arguments& latest)
+        {
+            std::get<0>(accumulated) += std::get<0>(latest);
+        });
+
+    int expected = 0;
+    for (uint32_t i = 0; i < test::N_EVENTS_IN_TEST; ++i)
+    {
+        source->raise(i);
+        expected += i;
+    }
+
+    ASSERT_TRUE(handler.wait_for_event(1));
+    ASSERT_EQ(sum.load(), expected);
+    ASSERT_EQ(handler.event_count(), 1u);
+}
+
+/**
+ * Use an aggregator that throws for odd values and check those events are skipped
+ * while the rest of the burst is still aggregated and released.
+ */
+TEST(DebouncedEventHandlerTest, aggregator_throws)
+{
+    using Handler = DebouncedEventHandler<int, const std::string&>;
+
+    test::MockEventHandler* source = new test::MockEventHandler();
+    std::atomic<int> sum(0);
+
+    DebounceConfiguration configuration;
+    configuration.debounce_window = 50;
+
+    Handler handler(
+        [&sum](int value, const std::string&)
+        {
+            sum.store(value);
+        },
+        std::unique_ptr<EventHandler<int, const std::string&>>(source),
+        configuration,
+        [](Handler::Arguments& accumulated, const Handler::Arguments& latest)
+        {
+            if (std::get<0>(latest) % 2 != 0)
+            {
+                throw std::runtime_error("odd value");
+            }
+            std::get<0>(accumulated) += std::get<0>(latest);
+        });
+
+    int expected = 0;
+    for (uint32_t i = 0; i < test::N_EVENTS_IN_TEST; ++i)
+    {
+        source->raise(i);
+        if (i % 2 == 0)
+        {
+            expected += i;
+        }
+    }
+
+    ASSERT_TRUE(handler.wait_for_event(1));
+    ASSERT_EQ(sum.load(), expected);
+    ASSERT_EQ(handler.event_count(), 1u);
+}
+
+/**
+ * Destroy handlers with events held and check their callbacks are never called.
+ */
+TEST(DebouncedEventHandlerTest, destroy_holding)
+{
+    TimerService timer_service;
+    std::atomic<int> calls(0);
+
+    DebounceConfiguration configuration;
+    configuration.debounce_window = 20;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        test::MockEventHandler* source = new test::MockEventHandler();
+        DebouncedEventHandler<int, const std::string&> handler(
+            [&calls](int, const std::string&)
+            {
+                calls++;
+            },
+            std::unique_ptr<EventHandler<int, const std::string&>>(source),
+            configuration,
+            nullptr,
+            timer_service);
+
+        source->raise(i);
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(calls.load(), 0);
+    ASSERT_EQ(timer_service.size(), 0u);
+}
+
+/**
+ * Check the callback of events released by the timer does not run in the timer thread,
+ * so a slow callback does not delay other tasks of the same TimerService.
+ */
+TEST(DebouncedEventHandlerTest, slow_callback_off_timer_thread)
+{
+    TimerService timer_service;
+    std::atomic<bool> callback_running(false);
+    std::thread::id callback_thread;
+
+    DebounceConfiguration configuration;
+    configuration.debounce_window = 10;
+
+    test::MockEventHandler* source = new test::MockEventHandler();
+    DebouncedEventHandler<int, const std::string&> handler(
+        [&](int, const std::string&)
+        {
+            callback_thread = std::this_thread::get_id();
+            callback_running = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        },
+        std::unique_ptr<EventHandler<int, const std::string&>>(source),
+        configuration,
+        nullptr,
+        timer_service);
+
+    source->raise(0);
+    while (!callback_running.load())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // Another task of the service runs while the callback is still running
+    std::atomic<bool> task_executed(false);
+    std::thread::id timer_thread;
+    timer_service.schedule(
+        Duration_ms(1),
+        [&]()
+        {
+            timer_thread = std::this_thread::get_id();
+            task_executed = true;
+        });
+    for (int i = 0; i < 200 && !task_executed.load(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(task_executed.load());
+    ASSERT_NE(callback_thread, timer_thread);
+
+    ASSERT_TRUE(handler.wait_for_event(1));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
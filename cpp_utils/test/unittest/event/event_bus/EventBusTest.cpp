@@ -0,0 +1,304 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/event/EventBus.hpp>
+#include <cpp_utils/event/PeriodicEventHandler.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+namespace test {
+
+constexpr uint32_t N_SUBSCRIBERS_IN_TEST = 4;
+constexpr uint32_t N_EVENTS_IN_TEST = 100;
+constexpr uint32_t N_THREADS_IN_TEST = 4;
+
+//! Wait until \c value reaches \c expected or a long timeout expires.
+bool wait_value(
+        const std::atomic<uint32_t>& value,
+        uint32_t expected)
+{
+    for (int i = 0; i < 5000 && value.load() < expected; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return value.load() >= expected;
+}
+
+} /* namespace test */
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils;
+using namespace eprosima::utils::event;
+
+/**
+ * Publish events to several subscribers in the publishing thread.
+ */
+TEST(EventBusTest, publish_subscribers)
+{
+    EventBus<int, std::string> bus;
+
+    std::vector<std::vector<int>> received(test::N_SUBSCRIBERS_IN_TEST);
+    std::vector<SubscriptionId> ids;
+    for (uint32_t i = 0; i < test::N_SUBSCRIBERS_IN_TEST; ++i)
+    {
+        ids.push_back(bus.subscribe([&received, i](int value, std::string text)
+                {
+                    ASSERT_EQ(std::to_string(value), text);
+                    received[i].push_back(value);
+                }));
+    }
+    ASSERT_EQ(bus.subscribers(), test::N_SUBSCRIBERS_IN_TEST);
+
+    for (uint32_t i = 0; i < test::N_EVENTS_IN_TEST; ++i)
+    {
+        bus.publish(i, std::to_string(i));
+    }
+
+    for (const auto& subscriber_received : received)
+    {
+        ASSERT_EQ(subscriber_received.size(), test::N_EVENTS_IN_TEST);
+        for (uint32_t i = 0; i < test::N_EVENTS_IN_TEST; ++i)
+        {
+            ASSERT_EQ(subscriber_received[i], static_cast<int>(i));
+        }
+    }
+    ASSERT_EQ(bus.event_count(), test::N_EVENTS_IN_TEST);
+}
+
+/**
+ * Unsubscribe subscribers, including one from its own callback.
+ */
+TEST(EventBusTest, unsubscribe)
+{
+    EventBus<int> bus;
+
+    uint32_t first_calls = 0;
+    uint32_t second_calls = 0;
+    uint32_t self_calls = 0;
+
+    SubscriptionId first = bus.subscribe([&first_calls](int)
+                    {
+                        first_calls++;
+                    });
+    bus.subscribe([&second_calls](int)
+            {
+                second_calls++;
+            });
+
+    SubscriptionId self = 0;
+    self = bus.subscribe([&](int)
+                    {
+                        self_calls++;
+                        bus.unsubscribe(self);
+                    });
+
+    bus.publish(0);
+    ASSERT_TRUE(bus.unsubscribe(first));
+    ASSERT_FALSE(bus.unsubscribe(first));
+    bus.publish(1);
+
+    ASSERT_EQ(first_calls, 1u);
+    ASSERT_EQ(second_calls, 2u);
+    ASSERT_EQ(self_calls, 1u);
+    ASSERT_EQ(bus.subscribers(), 1u);
+}
+
+/**
+ * Unsubscribe while the subscriber is running in other thread: it waits for it.
+ */
+TEST(EventBusTest, unsubscribe_waits_running)
+{
+    EventBus<int> bus;
+
+    std::atomic<bool> started(false);
+    std::atomic<bool> finished(false);
+
+    SubscriptionId id = bus.subscribe([&](int)
+                    {
+                        started = true;
+                        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                        finished = true;
+                    });
+
+    std::thread publisher([&bus]()
+            {
+                bus.publish(0);
+            });
+    while (!started)
+    {
+        std::this_thread::yield();
+    }
+
+    bus.unsubscribe(id);
+    ASSERT_TRUE(finished.load());
+
+    publisher.join();
+}
+
+/**
+ * Unsubscribe while other threads publish continuously: it must only wait for the calls already running.
+ */
+TEST(EventBusTest, unsubscribe_during_event_storm)
+{
+    EventBus<int> bus;
+
+    std::atomic<bool> stop(false);
+    std::atomic<uint32_t> calls(0);
+
+    SubscriptionId id = bus.subscribe([&](int)
+                    {
+                        calls++;
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    });
+
+    std::vector<std::thread> publishers;
+    for (uint32_t i = 0; i < test::N_THREADS_IN_TEST; ++i)
+    {
+        publishers.emplace_back([&bus, &stop, i]()
+                {
+                    while (!stop.load())
+                    {
+                        bus.publish(i);
+                    }
+                });
+    }
+    while (calls.load() < test::N_THREADS_IN_TEST)
+    {
+        std::this_thread::yield();
+    }
+
+    std::atomic<bool> unsubscribed(false);
+    std::thread unsubscriber([&bus, &unsubscribed, id]()
+            {
+                bus.unsubscribe(id);
+                unsubscribed = true;
+            });
+
+    for (int i = 0; i < 5000 && !unsubscribed.load(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const bool unsubscribed_with_events_running = unsubscribed.load();
+
+    stop = true;
+    for (std::thread& publisher : publishers)
+    {
+        publisher.join();
+    }
+    unsubscriber.join();
+
+    ASSERT_TRUE(unsubscribed_with_events_running);
+    ASSERT_EQ(bus.subscribers(), 0u);
+}
+
+/**
+ * Dispatch events in a thread pool: every subscriber gets every event in order, and subscribers run in parallel.
+ */
+TEST(EventBusTest, thread_pool_dispatch)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    thread_pool.enable();
+
+    std::atomic<uint32_t> running(0);
+    std::atomic<uint32_t> max_running(0);
+    std::atomic<uint32_t> total(0);
+    std::vector<std::vector<std::string>> received(test::N_SUBSCRIBERS_IN_TEST);
+
+    {
+        EventBus<const std::string&> bus(thread_pool);
+
+        for (uint32_t i = 0; i < test::N_SUBSCRIBERS_IN_TEST; ++i)
+        {
+            bus.subscribe([&, i](const std::string& text)
+                    {
+                        uint32_t current = ++running;
+                        uint32_t previous_max = max_running.load();
+                        while (current > previous_max && !max_running.compare_exchange_weak(previous_max, current))
+                        {
+                        }
+                        // Each subscriber is serialized, so its vector does not need a mutex
+                        received[i].push_back(text);
+                        std::this_thread::sleep_for(std::chrono::microseconds(100));
+                        --running;
+                        ++total;
+                    });
+        }
+
+        for (uint32_t i = 0; i < test::N_EVENTS_IN_TEST; ++i)
+        {
+            bus.publish(std::to_string(i));
+        }
+
+        ASSERT_TRUE(test::wait_value(total, test::N_EVENTS_IN_TEST * test::N_SUBSCRIBERS_IN_TEST));
+    }
+
+    ASSERT_GT(max_running.load(), 1u);
+    for (const auto& subscriber_received : received)
+    {
+        ASSERT_EQ(subscriber_received.size(), test::N_EVENTS_IN_TEST);
+        for (uint32_t i = 0; i < test::N_EVENTS_IN_TEST; ++i)
+        {
+            ASSERT_EQ(subscriber_received[i], std::to_string(i));
+        }
+    }
+}
+
+/**
+ * Fan out the events of other EventHandler.
+ */
+TEST(EventBusTest, publisher_of_event_handler)
+{
+    EventBus<> bus;
+    std::atomic<uint32_t> first(0);
+    std::atomic<uint32_t> second(0);
+
+    bus.subscribe([&first]()
+            {
+                first++;
+            });
+    bus.subscribe([&second]()
+            {
+                second++;
+            });
+
+    {
+        PeriodicEventHandler periodic(bus.publisher(), 5);
+        ASSERT_TRUE(bus.wait_for_event(3));
+    }
+
+    ASSERT_GE(first.load(), 3u);
+    ASSERT_EQ(first.load(), second.load());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
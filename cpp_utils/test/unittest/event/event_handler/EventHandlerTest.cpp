@@ -0,0 +1,258 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/event/EventHandler.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+namespace test {
+
+constexpr uint32_t N_THREADS_IN_TEST = 4;
+constexpr uint32_t CALLBACK_TIME_TEST = 100;
+
+/**
+ * EventHandler with public access to \c event_occurred_ , so events can be raised from several threads.
+ */
+class TestEventHandler : public EventHandler<int>
+{
+public:
+
+    using EventHandler<int>::EventHandler;
+
+    ~TestEventHandler()
+    {
+        unset_callback();
+    }
+
+    void raise(
+            int value)
+    {
+        event_occurred_(value);
+    }
+
+};
+
+//! Raise an event in a new thread.
+std::thread raise_in_thread(
+        TestEventHandler& handler,
+        int value)
+{
+    return std::thread([&handler, value]()
+                   {
+                       handler.raise(value);
+                   });
+}
+
+} /* namespace test */
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils::event;
+
+/**
+ * Raise events from several threads and check callbacks run concurrently.
+ */
+TEST(EventHandlerTest, concurrent_callbacks)
+{
+    std::atomic<uint32_t> running(0);
+    std::atomic<uint32_t> max_running(0);
+
+    test::TestEventHandler handler;
+    handler.set_callback([&](int)
+            {
+                uint32_t current = ++running;
+                uint32_t previous_max = max_running.load();
+                while (current > previous_max && !max_running.compare_exchange_weak(previous_max, current))
+                {
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(test::CALLBACK_TIME_TEST));
+                --running;
+            });
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < test::N_THREADS_IN_TEST; ++i)
+    {
+        threads.push_back(test::raise_in_thread(handler, i));
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_GT(max_running.load(), 1u);
+    ASSERT_EQ(handler.event_count(), test::N_THREADS_IN_TEST);
+}
+
+/**
+ * Change the callback while a slow callback is running: it must not wait, and the new events use the new callback.
+ */
+TEST(EventHandlerTest, set_callback_while_running)
+{
+    std::atomic<bool> slow_started(false);
+    std::atomic<bool> slow_finished(false);
+    std::atomic<int> new_callback_value(0);
+
+    test::TestEventHandler handler;
+    handler.set_callback([&](int)
+            {
+                slow_started = true;
+                std::this_thread::sleep_for(std::chrono::milliseconds(test::CALLBACK_TIME_TEST));
+                slow_finished = true;
+            });
+
+    std::thread slow_thread = test::raise_in_thread(handler, 0);
+    while (!slow_started)
+    {
+        std::this_thread::yield();
+    }
+
+    handler.set_callback([&](int value)
+            {
+                new_callback_value = value;
+            });
+    ASSERT_FALSE(slow_finished.load());
+
+    handler.raise(7);
+    ASSERT_EQ(new_callback_value.load(), 7);
+
+    slow_thread.join();
+    ASSERT_TRUE(slow_finished.load());
+}
+
+/**
+ * Unset the callback while it is running: it must wait for it, and the callback is not called afterwards.
+ */
+TEST(EventHandlerTest, unset_waits_running_callbacks)
+{
+    std::atomic<bool> started(false);
+    std::atomic<bool> finished(false);
+    std::atomic<uint32_t> calls(0);
+
+    test::TestEventHandler handler;
+    handler.set_callback([&](int)
+            {
+                calls++;
+                started = true;
+                std::this_thread::sleep_for(std::chrono::milliseconds(test::CALLBACK_TIME_TEST));
+                finished = true;
+            });
+
+    std::thread slow_thread = test::raise_in_thread(handler, 0);
+    while (!started)
+    {
+        std::this_thread::yield();
+    }
+
+    handler.unset_callback();
+    ASSERT_TRUE(finished.load());
+
+    handler.raise(1);
+    ASSERT_EQ(calls.load(), 1u);
+
+    slow_thread.join();
+}
+
+/**
+ * Unset the callback from inside the callback itself.
+ */
+TEST(EventHandlerTest, unset_from_callback)
+{
+    std::atomic<uint32_t> calls(0);
+
+    test::TestEventHandler handler;
+    handler.set_callback([&](int)
+            {
+                calls++;
+                handler.unset_callback();
+            });
+
+    handler.raise(0);
+    handler.raise(1);
+
+    ASSERT_EQ(calls.load(), 1u);
+}
+
+/**
+ * Unset the callback while other threads raise events continuously: it must only wait for the callbacks
+ * already running, and not for the events that keep arriving.
+ */
+TEST(EventHandlerTest, unset_during_event_storm)
+{
+    std::atomic<bool> stop(false);
+    std::atomic<uint32_t> calls(0);
+
+    test::TestEventHandler handler;
+    handler.set_callback([&](int)
+            {
+                calls++;
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            });
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < test::N_THREADS_IN_TEST; ++i)
+    {
+        threads.emplace_back([&handler, &stop, i]()
+                {
+                    while (!stop.load())
+                    {
+                        handler.raise(i);
+                    }
+                });
+    }
+    while (calls.load() < test::N_THREADS_IN_TEST)
+    {
+        std::this_thread::yield();
+    }
+
+    std::atomic<bool> unset(false);
+    std::thread unset_thread([&handler, &unset]()
+            {
+                handler.unset_callback();
+                unset = true;
+            });
+
+    for (int i = 0; i < 5000 && !unset.load(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const bool unset_with_events_running = unset.load();
+
+    stop = true;
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    unset_thread.join();
+
+    ASSERT_TRUE(unset_with_events_running);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,295 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dirent.h>
+#include <utime.h>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/event/FileContentWatcherHandler.hpp>
+#include <cpp_utils/event/FileWatcherHandler.hpp>
+#include <cpp_utils/event/FileWatcherService.hpp>
+#include <cpp_utils/math/math_extension.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+namespace test {
+
+//! Number of threads of this process.
+uint32_t number_of_threads()
+{
+    uint32_t threads = 0;
+    DIR* dir = opendir("/proc/self/task");
+    if (dir != nullptr)
+    {
+        while (dirent* entry = readdir(dir))
+        {
+            if (entry->d_name[0] != '.')
+            {
+                ++threads;
+            }
+        }
+        closedir(dir);
+    }
+    return threads;
+}
+
+//! Wait until \c value reaches \c expected or a long timeout expires.
+bool wait_value(
+        const std::atomic<uint32_t>& value,
+        uint32_t expected)
+{
+    for (int i = 0; i < 5000 && value.load() < expected; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return value.load() >= expected;
+}
+
+//! Write \c content in file \c file_path .
+void write_file(
+        const std::string& file_path,
+        const std::string& content = "content")
+{
+    std::ofstream file(file_path);
+    file << content;
+}
+
+} /* namespace test */
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils::event;
+
+/**
+ * Modify a file watched and receive its name in the callback.
+ * Other files of the same directory do not raise the callback.
+ */
+TEST(FileWatcherHandlerTest, file_modified)
+{
+    const std::string file_path = "FileWatcherHandlerTest_file.txt";
+    test::write_file(file_path);
+
+    std::atomic<uint32_t> events(0);
+    std::string file_changed;
+    FileWatcherHandler handler(
+        [&events, &file_changed](const std::string& file_name)
+        {
+            file_changed = file_name;
+            events++;
+        },
+        file_path);
+
+    test::write_file("FileWatcherHandlerTest_other.txt");
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_EQ(events.load(), 0u);
+
+    test::write_file(file_path, "new content");
+    ASSERT_TRUE(test::wait_value(events, 1));
+
+    // A write could be notified in more than one callback, so wait for them before reading the name
+    handler.unset_callback();
+    ASSERT_EQ(file_changed, file_path);
+
+    std::remove(file_path.c_str());
+    std::remove("FileWatcherHandlerTest_other.txt");
+}
+
+/**
+ * Watch many files of the same directory.
+ * They share a single watch descriptor, no thread is created per file,
+ * and each change only raises the callback of its file.
+ */
+TEST(FileWatcherHandlerTest, shared_directory)
+{
+    constexpr uint32_t N_FILES = 50;
+
+    FileWatcherService& service = FileWatcherService::get_instance();
+    const std::size_t directories = service.directories();
+    const uint32_t threads = test::number_of_threads();
+
+    std::vector<std::string> file_paths;
+    std::vector<std::unique_ptr<std::atomic<uint32_t>>> events;
+    std::vector<std::unique_ptr<FileWatcherHandler>> handlers;
+    for (uint32_t i = 0; i < N_FILES; ++i)
+    {
+        file_paths.push_back("FileWatcherHandlerTest_shared_" + std::to_string(i) + ".txt");
+        events.push_back(std::make_unique<std::atomic<uint32_t>>(0));
+
+        std::atomic<uint32_t>* counter = events.back().get();
+        handlers.push_back(std::make_unique<FileWatcherHandler>(
+                    [counter](const std::string& /* file_name */)
+                    {
+                        (*counter)++;
+                    },
+                    file_paths.back()));
+    }
+
+    ASSERT_EQ(service.directories(), directories + 1);
+    ASSERT_EQ(test::number_of_threads(), threads);
+
+    test::write_file(file_paths[N_FILES / 2]);
+    ASSERT_TRUE(test::wait_value(*events[N_FILES / 2], 1));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    for (uint32_t i = 0; i < N_FILES; ++i)
+    {
+        if (i != N_FILES / 2)
+        {
+            ASSERT_EQ(events[i]->load(), 0u);
+        }
+    }
+
+    // The directory stops being watched with its last file
+    handlers.clear();
+    ASSERT_EQ(service.directories(), directories);
+
+    for (const std::string& file_path : file_paths)
+    {
+        std::remove(file_path.c_str());
+    }
+}
+
+/**
+ * Unset the callback of a handler, so changes of its file do not raise it anymore.
+ */
+TEST(FileWatcherHandlerTest, stop_watching)
+{
+    const std::string file_path = "FileWatcherHandlerTest_stop.txt";
+
+    FileWatcherService& service = FileWatcherService::get_instance();
+    const std::size_t files = service.size();
+
+    std::atomic<uint32_t> events(0);
+    FileWatcherHandler handler(
+        [&events](const std::string& /* file_name */)
+        {
+            events++;
+        },
+        file_path);
+    ASSERT_EQ(service.size(), files + 1);
+
+    test::write_file(file_path);
+    ASSERT_TRUE(test::wait_value(events, 1));
+
+    handler.unset_callback();
+    ASSERT_EQ(service.size(), files);
+
+    const uint32_t events_before = events.load();
+    test::write_file(file_path, "new content");
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_EQ(events.load(), events_before);
+
+    std::remove(file_path.c_str());
+}
+
+/**
+ * Watch the content of a file, so only writes that change it raise the callback.
+ *
+ * CASES:
+ * - Rewrite the same content
+ * - Touch the file
+ * - Write a new content, that is notified with its hash
+ */
+TEST(FileWatcherHandlerTest, content_changed)
+{
+    const std::string file_path = "FileWatcherHandlerTest_content.txt";
+    test::write_file(file_path, "content");
+
+    std::atomic<uint32_t> events(0);
+    FileChange last_change;
+    FileContentWatcherHandler handler(
+        [&events, &last_change](const FileChange& change)
+        {
+            last_change = change;
+            events++;
+        },
+        file_path);
+
+    // Rewrite the same content
+    test::write_file(file_path, "content");
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(events.load(), 0u);
+
+    // Touch the file
+    ASSERT_EQ(utime(file_path.c_str(), nullptr), 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(events.load(), 0u);
+
+    // Write a new content
+    const std::string new_content = "new content";
+    test::write_file(file_path, new_content);
+    ASSERT_TRUE(test::wait_value(events, 1));
+    ASSERT_EQ(last_change.file_name, file_path);
+    ASSERT_EQ(last_change.snapshot.content_hash, eprosima::utils::hash_64(new_content.c_str(), new_content.size()));
+    ASSERT_EQ(last_change.snapshot.size, new_content.size());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(events.load(), 1u);
+
+    std::remove(file_path.c_str());
+}
+
+/**
+ * Write a file in several chunks. The callback is only raised once the file is closed.
+ */
+TEST(FileWatcherHandlerTest, content_complete_write)
+{
+    const std::string file_path = "FileWatcherHandlerTest_complete.txt";
+    std::remove(file_path.c_str());
+
+    std::atomic<uint32_t> events(0);
+    FileContentWatcherHandler handler(
+        [&events](const FileChange& /* change */)
+        {
+            events++;
+        },
+        file_path);
+
+    {
+        std::ofstream file(file_path);
+        file << "first chunk" << std::flush;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        file << "second chunk" << std::flush;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        ASSERT_EQ(events.load(), 0u);
+    }
+
+    ASSERT_TRUE(test::wait_value(events, 1));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(events.load(), 1u);
+
+    std::remove(file_path.c_str());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
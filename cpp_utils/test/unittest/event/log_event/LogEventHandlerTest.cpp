@@ -0,0 +1,310 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/AllocationCounter.hpp>
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/event/LogEventHandler.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+namespace test {
+
+constexpr std::size_t N_EVENTS_IN_BENCHMARK = 1000;
+
+//! LogEventHandler that consumes entries given directly by the test.
+class DirectLogEventHandler : public LogEventHandler
+{
+public:
+
+    using LogEventHandler::LogEventHandler;
+    using LogEventHandler::consume_;
+};
+
+//! Entry whose strings are too long to be stored inline, so every copy allocates.
+utils::Log::Entry long_entry()
+{
+    utils::Log::Entry entry;
+    entry.message = "Message long enough to not fit in the small string buffer.";
+    entry.context = {__FILE__, __LINE__, __func__, "LOG_EVENT_HANDLER_TEST"};
+    entry.kind = utils::Log::Kind::Warning;
+    entry.timestamp = "2024-01-01 00:00:00.000";
+    return entry;
+}
+
+//! Entry with message \c message .
+utils::Log::Entry entry(
+        const std::string& message)
+{
+    utils::Log::Entry entry = long_entry();
+    entry.message = message;
+    return entry;
+}
+
+//! Messages of \c entries , in order.
+std::vector<std::string> messages(
+        const std::vector<utils::Log::Entry>& entries)
+{
+    std::vector<std::string> result;
+    for (const utils::Log::Entry& entry : entries)
+    {
+        result.push_back(entry.message);
+    }
+    return result;
+}
+
+//! Average allocations done by consuming \c N_EVENTS_IN_BENCHMARK entries in \c handler .
+double allocations_per_event(
+        DirectLogEventHandler& handler)
+{
+    const utils::Log::Entry entry = long_entry();
+
+    utils::testing::AllocationCounter counter;
+    for (std::size_t i = 0; i < N_EVENTS_IN_BENCHMARK; ++i)
+    {
+        handler.consume_(entry);
+    }
+    return static_cast<double>(counter.count()) / N_EVENTS_IN_BENCHMARK;
+}
+
+} /* namespace test */
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils;
+using namespace eprosima::utils::event;
+
+/**
+ * Check the entries consumed reach the callback unchanged.
+ */
+TEST(LogEventHandlerTest, consume_entries)
+{
+    std::size_t received = 0;
+    test::DirectLogEventHandler handler(
+        [&received](const Log::Entry& entry)
+        {
+            ASSERT_EQ(entry.message, test::long_entry().message);
+            ASSERT_EQ(entry.kind, Log::Kind::Warning);
+            received++;
+        });
+
+    handler.consume_(test::long_entry());
+    handler.consume_(test::long_entry());
+
+    ASSERT_EQ(received, 2u);
+    ASSERT_EQ(handler.event_count(), 2u);
+}
+
+/**
+ * Benchmark allocations per event with a callback that takes the entry by reference and one that takes it by value.
+ *
+ * The handler keeps a copy of the last entries consumed, so that copy is the only one expected with a callback by
+ * reference (only while its ring is being filled). A callback by value opts-in to one more copy.
+ */
+TEST(LogEventHandlerTest, allocations_per_event)
+{
+    // Allocations of a single copy of an entry
+    const Log::Entry entry = test::long_entry();
+    eprosima::utils::testing::AllocationCounter copy_counter;
+    {
+        Log::Entry copy(entry);
+    }
+    const double copy_allocations = static_cast<double>(copy_counter.count());
+    ASSERT_GT(copy_allocations, 0);
+
+    test::DirectLogEventHandler by_reference_handler(
+        [](const Log::Entry&)
+        {
+        });
+    const double by_reference = test::allocations_per_event(by_reference_handler);
+
+    test::DirectLogEventHandler by_value_handler(
+        [](Log::Entry)
+        {
+        });
+    const double by_value = test::allocations_per_event(by_value_handler);
+
+    std::cout << "Allocations per entry copy: " << copy_allocations << std::endl;
+    std::cout << "Allocations per event with callback by reference: " << by_reference << std::endl;
+    std::cout << "Allocations per event with callback by value: " << by_value << std::endl;
+
+    // At most the copy stored by the handler
+    ASSERT_LT(by_reference, copy_allocations + 0.5);
+    ASSERT_GT(by_value, by_reference + copy_allocations - 0.5);
+    ASSERT_LT(by_value, by_reference + copy_allocations + 0.5);
+}
+
+/**
+ * Keep entries with each retention.
+ *
+ * CASES:
+ * - Last entries, before and after the ring is full
+ * - Last entries, with a ring of no entries
+ * - No entries
+ * - Every entry
+ */
+TEST(LogEventHandlerTest, retention)
+{
+    // Last entries, before and after the ring is full
+    {
+        test::DirectLogEventHandler handler(
+            [](const Log::Entry&)
+            {
+            },
+            LogRetention::last_entries,
+            3);
+
+        handler.consume_(test::entry("0"));
+        handler.consume_(test::entry("1"));
+        ASSERT_EQ(test::messages(handler.retained_entries()), (std::vector<std::string>{"0", "1"}));
+
+        for (int i = 2; i < 8; ++i)
+        {
+            handler.consume_(test::entry(std::to_string(i)));
+        }
+        ASSERT_EQ(test::messages(handler.retained_entries()), (std::vector<std::string>{"5", "6", "7"}));
+        ASSERT_EQ(handler.consumed_entries(), 8u);
+    }
+
+    // Last entries, with a ring of no entries
+    {
+        test::DirectLogEventHandler handler(
+            [](const Log::Entry&)
+            {
+            },
+            LogRetention::last_entries,
+            0);
+
+        handler.consume_(test::entry("0"));
+        handler.consume_(test::entry("1"));
+        ASSERT_TRUE(handler.retained_entries().empty());
+        ASSERT_EQ(handler.consumed_entries(), 2u);
+        ASSERT_EQ(handler.event_count(), 2u);
+    }
+
+    // No entries
+    {
+        test::DirectLogEventHandler handler(
+            [](const Log::Entry&)
+            {
+            },
+            LogRetention::none);
+
+        handler.consume_(test::entry("0"));
+        handler.consume_(test::entry("1"));
+        ASSERT_TRUE(handler.retained_entries().empty());
+        ASSERT_EQ(handler.consumed_entries(), 2u);
+        ASSERT_EQ(handler.event_count(), 2u);
+    }
+
+    // Every entry
+    {
+        test::DirectLogEventHandler handler(
+            [](const Log::Entry&)
+            {
+            },
+            LogRetention::unbounded);
+
+        for (int i = 0; i < 500; ++i)
+        {
+            handler.consume_(test::entry(std::to_string(i)));
+        }
+        const std::vector<std::string> messages = test::messages(handler.retained_entries());
+        ASSERT_EQ(messages.size(), 500u);
+        ASSERT_EQ(messages.front(), "0");
+        ASSERT_EQ(messages.back(), "499");
+    }
+}
+
+/**
+ * Once the ring of last entries is full, consuming entries like the ones in it does not allocate,
+ * as their memory is reused.
+ */
+TEST(LogEventHandlerTest, ring_without_allocations)
+{
+    test::DirectLogEventHandler handler(
+        [](const Log::Entry&)
+        {
+        },
+        LogRetention::last_entries,
+        10);
+
+    const Log::Entry entry = test::long_entry();
+    for (int i = 0; i < 10; ++i)
+    {
+        handler.consume_(entry);
+    }
+
+    eprosima::utils::testing::AllocationCounter counter;
+    for (int i = 0; i < 1000; ++i)
+    {
+        handler.consume_(entry);
+    }
+    ASSERT_EQ(counter.count(), 0u);
+}
+
+/**
+ * Take copies of the entries kept while entries are being consumed from another thread.
+ * Every copy holds consecutive entries, and it is not changed by the entries consumed later.
+ */
+TEST(LogEventHandlerTest, retained_entries_while_consuming)
+{
+    constexpr int N_ENTRIES = 20000;
+
+    test::DirectLogEventHandler handler(
+        [](const Log::Entry&)
+        {
+        },
+        LogRetention::last_entries,
+        50);
+
+    std::thread producer([&handler]()
+            {
+                for (int i = 0; i < N_ENTRIES; ++i)
+                {
+                    handler.consume_(test::entry(std::to_string(i)));
+                }
+            });
+
+    while (handler.consumed_entries() < static_cast<uint64_t>(N_ENTRIES))
+    {
+        const std::vector<std::string> messages = test::messages(handler.retained_entries());
+        for (std::size_t i = 1; i < messages.size(); ++i)
+        {
+            ASSERT_EQ(std::stoi(messages[i]), std::stoi(messages[i - 1]) + 1);
+        }
+    }
+    producer.join();
+
+    const std::vector<std::string> messages = test::messages(handler.retained_entries());
+    ASSERT_EQ(messages.size(), 50u);
+    ASSERT_EQ(messages.back(), std::to_string(N_ENTRIES - 1));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
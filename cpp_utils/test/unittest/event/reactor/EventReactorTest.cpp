@@ -0,0 +1,298 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+#include <signal.h>
+#include <unistd.h>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/event/MultipleEventHandler.hpp>
+#include <cpp_utils/event/reactor/EventReactor.hpp>
+#include <cpp_utils/event/reactor/FdEventSource.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/exception/ValueNotAllowedException.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace event {
+namespace test {
+
+constexpr uint32_t N_DEFAULT_TEST_EXECUTIONS = 5;
+
+//! Wait until \c value reaches \c expected or a long timeout expires.
+bool wait_value(
+        const std::atomic<uint32_t>& value,
+        uint32_t expected)
+{
+    for (int i = 0; i < 5000 && value.load() < expected; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return value.load() >= expected;
+}
+
+//! Write \c data in descriptor \c fd .
+void write_fd(
+        int fd,
+        const std::string& data)
+{
+    ASSERT_EQ(write(fd, data.c_str(), data.size()), static_cast<ssize_t>(data.size()));
+}
+
+} /* namespace test */
+} /* namespace event */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils;
+using namespace eprosima::utils::event;
+
+/**
+ * Register a pipe in a reactor, and check its routine is called only while registered.
+ */
+TEST(EventReactorTest, reactor_add_remove_source)
+{
+    int pipe_fds[2];
+    ASSERT_EQ(pipe(pipe_fds), 0);
+
+    std::atomic<uint32_t> calls(0);
+
+    EventReactor reactor;
+    reactor.add_source(
+        pipe_fds[0],
+        [&]()
+        {
+            char buffer[64];
+            if (read(pipe_fds[0], buffer, sizeof(buffer)) > 0)
+            {
+                calls++;
+            }
+        });
+    ASSERT_EQ(reactor.size(), 1u);
+    ASSERT_THROW(reactor.add_source(pipe_fds[0], []()
+            {
+            }), ValueNotAllowedException);
+
+    reactor.start();
+
+    test::write_fd(pipe_fds[1], "x");
+    ASSERT_TRUE(test::wait_value(calls, 1));
+
+    reactor.remove_source(pipe_fds[0]);
+    ASSERT_EQ(reactor.size(), 0u);
+
+    test::write_fd(pipe_fds[1], "x");
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_EQ(calls.load(), 1u);
+
+    reactor.stop();
+    close(pipe_fds[0]);
+    close(pipe_fds[1]);
+}
+
+/**
+ * Use the reactor from another thread while a routine is running, and throw from routines.
+ *
+ * STEPS:
+ * - block a routine until another thread has added and removed a source, what needs the reactor not locked
+ * - remove the source of the blocked routine, what waits for it to finish
+ * - throw something that is not a std::exception from a routine, and check the reactor keeps dispatching
+ */
+TEST(EventReactorTest, reactor_routine_unlocked)
+{
+    int pipe_fds[2];
+    ASSERT_EQ(pipe(pipe_fds), 0);
+    int other_pipe_fds[2];
+    ASSERT_EQ(pipe(other_pipe_fds), 0);
+
+    std::atomic<uint32_t> calls(0);
+    std::atomic<uint32_t> sources_changed(0);
+    std::atomic<bool> routine_finished(false);
+
+    EventReactor reactor;
+    reactor.add_source(
+        pipe_fds[0],
+        [&]()
+        {
+            char buffer[64];
+            if (read(pipe_fds[0], buffer, sizeof(buffer)) > 0)
+            {
+                calls++;
+                test::wait_value(sources_changed, 1);
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                routine_finished.store(true);
+            }
+        });
+    reactor.start();
+
+    // block a routine until another thread has added and removed a source
+    test::write_fd(pipe_fds[1], "x");
+    ASSERT_TRUE(test::wait_value(calls, 1));
+    reactor.add_source(other_pipe_fds[0], []()
+            {
+            });
+    ASSERT_EQ(reactor.size(), 2u);
+    reactor.remove_source(other_pipe_fds[0]);
+    sources_changed++;
+
+    // remove the source of the blocked routine, what waits for it to finish
+    reactor.remove_source(pipe_fds[0]);
+    ASSERT_TRUE(routine_finished.load());
+
+    // throw something that is not a std::exception from a routine
+    std::atomic<uint32_t> throws(0);
+    reactor.add_source(
+        other_pipe_fds[0],
+        [&]()
+        {
+            char buffer[64];
+            if (read(other_pipe_fds[0], buffer, sizeof(buffer)) > 0)
+            {
+                throws++;
+                throw 0;
+            }
+        });
+    test::write_fd(other_pipe_fds[1], "x");
+    ASSERT_TRUE(test::wait_value(throws, 1));
+    test::write_fd(other_pipe_fds[1], "x");
+    ASSERT_TRUE(test::wait_value(throws, 2));
+
+    reactor.stop();
+    close(pipe_fds[0]);
+    close(pipe_fds[1]);
+    close(other_pipe_fds[0]);
+    close(other_pipe_fds[1]);
+}
+
+/**
+ * Drive several timers from the reactor of a MultipleEventHandler.
+ */
+TEST(EventReactorTest, multiple_handler_timers)
+{
+    std::atomic<uint32_t> events(0);
+    MultipleEventHandler handler([&events]()
+            {
+                events++;
+            });
+
+    handler.register_fd_event_source(std::make_unique<TimerFdEventSource>(5));
+    handler.register_fd_event_source(std::make_unique<TimerFdEventSource>(7));
+
+    ASSERT_TRUE(handler.wait_for_event(test::N_DEFAULT_TEST_EXECUTIONS));
+    ASSERT_GE(events.load(), test::N_DEFAULT_TEST_EXECUTIONS);
+
+    ASSERT_THROW(TimerFdEventSource(0), InitializationException);
+}
+
+/**
+ * Read lines from a pipe as if it was stdin, and check the source is released at end of stream.
+ */
+TEST(EventReactorTest, multiple_handler_stdin)
+{
+    int pipe_fds[2];
+    ASSERT_EQ(pipe(pipe_fds), 0);
+
+    std::atomic<uint32_t> events(0);
+    {
+        MultipleEventHandler handler([&events]()
+                {
+                    events++;
+                });
+        handler.register_fd_event_source(std::make_unique<StdinFdEventSource>(pipe_fds[0]));
+
+        test::write_fd(pipe_fds[1], "first line\nsecond line\nincomplete");
+        ASSERT_TRUE(test::wait_value(events, 2));
+
+        test::write_fd(pipe_fds[1], " line\n");
+        ASSERT_TRUE(test::wait_value(events, 3));
+
+        // End of stream
+        close(pipe_fds[1]);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        ASSERT_EQ(events.load(), 3u);
+    }
+
+    close(pipe_fds[0]);
+}
+
+/**
+ * Receive signals through a signal descriptor.
+ */
+TEST(EventReactorTest, multiple_handler_signal)
+{
+    std::atomic<uint32_t> events(0);
+    MultipleEventHandler handler([&events]()
+            {
+                events++;
+            });
+    handler.register_fd_event_source(std::make_unique<SignalFdEventSource>(Signal::sigusr1));
+
+    for (uint32_t i = 1; i <= test::N_DEFAULT_TEST_EXECUTIONS; ++i)
+    {
+        // Signals of the same kind pending at the same time are merged, so wait for each one
+        kill(getpid(), SIGUSR1);
+        ASSERT_TRUE(test::wait_value(events, i));
+    }
+}
+
+/**
+ * Detect modifications of a file.
+ */
+TEST(EventReactorTest, multiple_handler_file)
+{
+    const std::string file_path = "EventReactorTest_file.txt";
+    std::remove(file_path.c_str());
+
+    std::atomic<uint32_t> events(0);
+    MultipleEventHandler handler([&events]()
+            {
+                events++;
+            });
+    handler.register_fd_event_source(std::make_unique<InotifyFdEventSource>(file_path));
+
+    // Other files in the same directory do not trigger events
+    {
+        std::ofstream other("EventReactorTest_other.txt");
+        other << "other";
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_EQ(events.load(), 0u);
+
+    {
+        std::ofstream file(file_path);
+        file << "content";
+    }
+    ASSERT_TRUE(test::wait_value(events, 1));
+
+    std::remove(file_path.c_str());
+    std::remove("EventReactorTest_other.txt");
+
+    ASSERT_THROW(InotifyFdEventSource("non_existent_directory/file.txt"), InitializationException);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -14,6 +14,13 @@
 
 #include <signal.h>
 
+#if defined(__linux__)
+#include <dirent.h>
+#include <unistd.h>
+#endif // if defined(__linux__)
+
+#include <thread>
+
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
 
@@ -21,6 +28,10 @@
 
 #include <cpp_utils/event/SignalEventHandler.hpp>
 
+#if defined(__linux__)
+#include <cpp_utils/event/reactor/EventReactor.hpp>
+#endif // if defined(__linux__)
+
 namespace eprosima {
 namespace utils {
 namespace event {
@@ -28,6 +39,28 @@ namespace test {
 
 constexpr uint32_t N_DEFAUL_TEST_EXECUTIONS = 5;
 
+#if defined(__linux__)
+//! Number of threads of this process.
+uint32_t number_of_threads()
+{
+    uint32_t threads = 0;
+    DIR* dir = opendir("/proc/self/task");
+    if (dir != nullptr)
+    {
+        while (dirent* entry = readdir(dir))
+        {
+            if (entry->d_name[0] != '.')
+            {
+                ++threads;
+            }
+        }
+        closedir(dir);
+    }
+    return threads;
+}
+
+#endif // if defined(__linux__)
+
 } /* namespace test */
 } /* namespace event */
 } /* namespace utils */
@@ -322,6 +355,133 @@ TEST(SignalEventHandlerTest, erase_callback_while_other_handling)
     ASSERT_EQ(calls, 12u);
 }
 
+#if defined(__linux__)
+/**
+ * Block a signal in this thread and send it to the process, so it is received through the signal descriptor
+ * instead of the signal handler.
+ */
+TEST(SignalEventHandlerTest, receive_blocked_signal)
+{
+    std::atomic<uint32_t> calls(0);
+
+    SignalEventHandler<Signal::sigusr2> handler([&calls](Signal signal)
+            {
+                ASSERT_EQ(signal, Signal::sigusr2);
+                calls++;
+            });
+
+    sigset_t previous_mask;
+    pthread_sigmask(SIG_SETMASK, nullptr, &previous_mask);
+    SignalDispatcher::get_instance().block_signals();
+
+    kill(getpid(), static_cast<int>(Signal::sigusr2));
+    handler.wait_for_event(1);
+
+    kill(getpid(), static_cast<int>(Signal::sigusr2));
+    handler.wait_for_event(2);
+
+    ASSERT_EQ(calls, 2u);
+
+    pthread_sigmask(SIG_SETMASK, &previous_mask, nullptr);
+}
+
+/**
+ * Handle several signals and check they share a single dispatcher thread.
+ */
+TEST(SignalEventHandlerTest, single_dispatcher_thread)
+{
+    std::atomic<uint32_t> calls(0);
+    auto callback = [&calls](Signal)
+            {
+                calls++;
+            };
+
+    // Signals raised in previous tests could still arrive to this handler, so it does not count them
+    SignalEventHandler<Signal::sigint> sigint_handler([](Signal)
+            {
+            });
+    const uint32_t threads = test::number_of_threads();
+
+    SignalEventHandler<Signal::sigterm> sigterm_handler(callback);
+    SignalEventHandler<Signal::sigusr1> sigusr1_handler(callback);
+    SignalEventHandler<Signal::sigusr2> sigusr2_handler(callback);
+    ASSERT_EQ(test::number_of_threads(), threads);
+
+    raise(static_cast<int>(Signal::sigterm));
+    raise(static_cast<int>(Signal::sigusr1));
+    sigterm_handler.wait_for_event();
+    sigusr1_handler.wait_for_event();
+    ASSERT_EQ(calls, 2u);
+}
+
+/**
+ * Register a callback while a signal is pending: the signal is dispatched to the callbacks registered before,
+ * from the dispatcher thread and not from the thread registering the new callback.
+ */
+TEST(SignalEventHandlerTest, dispatch_in_dispatcher_thread)
+{
+    std::atomic<uint32_t> calls(0);
+    std::atomic<bool> called_from_this_thread(false);
+    const std::thread::id this_thread = std::this_thread::get_id();
+
+    SignalEventHandler<Signal::sigusr1> handler([&](Signal)
+            {
+                called_from_this_thread = called_from_this_thread || std::this_thread::get_id() == this_thread;
+                calls++;
+            });
+
+    raise(static_cast<int>(Signal::sigusr1));
+
+    std::atomic<uint32_t> new_calls(0);
+    SignalEventHandler<Signal::sigusr1> new_handler([&new_calls](Signal)
+            {
+                new_calls++;
+            });
+
+    // The signal was raised before registering the new callback, so it has already been dispatched
+    ASSERT_EQ(calls, 1u);
+    ASSERT_EQ(new_calls, 0u);
+    ASSERT_FALSE(called_from_this_thread.load());
+}
+
+/**
+ * Watch the signal descriptor of the dispatcher from another reactor, through its event source interface.
+ */
+TEST(SignalEventHandlerTest, dispatcher_as_fd_event_source)
+{
+    std::atomic<uint32_t> calls(0);
+
+    SignalEventHandler<Signal::sigusr2> handler([&calls](Signal)
+            {
+                calls++;
+            });
+
+    IFdEventSource& source = SignalDispatcher::get_instance();
+    ASSERT_GE(source.fd(), 0);
+
+    EventReactor reactor;
+    reactor.add_source(
+        source.fd(),
+        [&source]()
+        {
+            source.consume();
+        });
+    reactor.start();
+
+    sigset_t previous_mask;
+    pthread_sigmask(SIG_SETMASK, nullptr, &previous_mask);
+    SignalDispatcher::get_instance().block_signals();
+
+    kill(getpid(), static_cast<int>(Signal::sigusr2));
+    handler.wait_for_event(1);
+    ASSERT_EQ(calls, 1u);
+
+    reactor.stop();
+    pthread_sigmask(SIG_SETMASK, &previous_mask, nullptr);
+}
+
+#endif // if defined(__linux__)
+
 int main(
         int argc,
         char** argv)
@@ -15,6 +15,10 @@
 #include <iostream>
 #include <queue>
 
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif // if !defined(_WIN32)
+
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
 
@@ -170,6 +174,46 @@ TEST(StdinEventHandlerTest, read_lines_running)
     ASSERT_TRUE(expected_result.empty());
 }
 
+#if !defined(_WIN32)
+/**
+ * @brief Read from a pipe with a \c FdLineReader 2 lines, and an empty line once the pipe is closed.
+ */
+TEST(StdinEventHandlerTest, read_lines_fd)
+{
+    std::string str1("some_easy_line");
+    std::string str2("Another extra large line to read from our beloved new Event Handler.");
+    std::string content = str1 + "\n" + str2 + "\n";
+
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    ASSERT_EQ(write(fds[1], content.c_str(), content.size()), static_cast<ssize_t>(content.size()));
+    close(fds[1]);
+
+    std::vector<std::string> lines_read;
+    std::mutex mutex_;
+
+    StdinEventHandler handler(
+        [&](const std::string& read_from_source)
+        {
+            std::lock_guard<std::mutex> _(mutex_);
+            lines_read.push_back(read_from_source);
+        },
+        std::make_unique<eprosima::utils::FdLineReader>(fds[0]),
+        3);
+
+    handler.wait_for_event(3);
+
+    {
+        std::lock_guard<std::mutex> _(mutex_);
+        ASSERT_EQ(lines_read, std::vector<std::string>({str1, str2, ""}));
+    }
+
+    handler.unset_callback();
+    close(fds[0]);
+}
+
+#endif // if !defined(_WIN32)
+
 int main(
         int argc,
         char** argv)
@@ -14,12 +14,25 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif // if !defined(_WIN32)
 
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
 
 #include <cpp_utils/exception/PreconditionNotMet.hpp>
+#include <cpp_utils/file/FdLineReader.hpp>
 #include <cpp_utils/file/file_utils.hpp>
+#include <cpp_utils/math/math_extension.hpp>
 #include <cpp_utils/utils.hpp>
 
 using namespace eprosima::utils;
@@ -144,6 +157,123 @@ TEST(fileTest, read_incorrect_file)
     ASSERT_THROW(file_to_strings(incorrect_file_name), PreconditionNotMet);
 }
 
+/**
+ * Test function \c file_to_snapshot hashes the whole content of the file, and fails with an incorrect file name.
+ */
+TEST(fileTest, read_file_snapshot)
+{
+    FileSnapshot snapshot = file_to_snapshot(test::FILE_NAME_TEST);
+
+    ASSERT_EQ(snapshot.size, std::strlen(test::FILE_IN_LINE));
+    ASSERT_EQ(snapshot.content_hash, hash_64(test::FILE_IN_LINE, std::strlen(test::FILE_IN_LINE)));
+    ASSERT_GT(snapshot.modification_time, Timestamp());
+
+    ASSERT_THROW(file_to_snapshot("resource/file.test"), PreconditionNotMet);
+}
+
+/**
+ * Test function \c file_to_snapshot can hash a file while another thread truncates and rewrites it,
+ * and it hashes the final content once the file is not changed any more.
+ */
+TEST(fileTest, read_file_snapshot_while_rewritten)
+{
+    constexpr const char* FILE_NAME = "file_snapshot_rewritten.test";
+    const std::string content(1 << 20, 'x');
+
+    {
+        std::ofstream file(FILE_NAME, std::ios::binary | std::ios::trunc);
+        file << content;
+    }
+
+    std::atomic<bool> stop(false);
+    std::thread writer([&stop, &content, FILE_NAME]()
+            {
+                // Written in small pieces, so the file is often shorter than when it was opened to be hashed
+                while (!stop.load())
+                {
+                    std::ofstream file(FILE_NAME, std::ios::binary | std::ios::trunc);
+                    for (std::size_t written = 0; written < content.size(); written += 4096)
+                    {
+                        file.write(content.data() + written, 4096);
+                        file.flush();
+                    }
+                }
+            });
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        const FileSnapshot snapshot = file_to_snapshot(FILE_NAME);
+        ASSERT_LE(snapshot.size, content.size());
+    }
+
+    stop.store(true);
+    writer.join();
+
+    const FileSnapshot snapshot = file_to_snapshot(FILE_NAME);
+    ASSERT_EQ(snapshot.size, content.size());
+    ASSERT_EQ(snapshot.content_hash, hash_64(content.data(), content.size()));
+
+    std::remove(FILE_NAME);
+}
+
+/**
+ * Test function \c split_line gives the same tokens as \c split_string , reusing the strings of the vector.
+ */
+TEST(fileTest, split_line_tokens)
+{
+    std::vector<std::string> lines = {"some string", " ", "", "a  b ", "single", "with\rcarriage return"};
+    std::vector<std::string> tokens = {"previous", "tokens", "that", "are", "reused"};
+
+    for (const std::string& line : lines)
+    {
+        ASSERT_EQ(split_line(line.c_str(), line.size(), ' ', tokens), split_string(line, " ").size());
+        ASSERT_EQ(tokens, split_string(line, " ")) << line;
+    }
+}
+
+#if !defined(_WIN32)
+/**
+ * Test class \c FdLineReader reads every line of a pipe.
+ *
+ * CASES:
+ * - Lines shorter and longer than the chunk size
+ * - Empty lines
+ * - Last line without line break
+ */
+TEST(fileTest, read_fd_lines)
+{
+    const std::string long_line(100, 'x');
+    const std::string content = "First Line\n\n" + long_line + "\nlast line";
+
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    ASSERT_EQ(write(fds[1], content.c_str(), content.size()), static_cast<ssize_t>(content.size()));
+    close(fds[1]);
+
+    FdLineReader reader(fds[0], 8);
+    std::string line;
+
+    ASSERT_TRUE(reader.read_line(line));
+    ASSERT_EQ(line, "First Line");
+    ASSERT_TRUE(reader.read_line(line));
+    ASSERT_EQ(line, "");
+    ASSERT_TRUE(reader.read_line(line));
+    ASSERT_EQ(line, long_line);
+
+    const char* data;
+    std::size_t size;
+    ASSERT_TRUE(reader.next_line(data, size));
+    ASSERT_EQ(std::string(data, size), "last line");
+
+    ASSERT_FALSE(reader.read_line(line));
+    ASSERT_TRUE(reader.finished());
+    ASSERT_EQ(line, "");
+
+    close(fds[0]);
+}
+
+#endif // if !defined(_WIN32)
+
 int main(
         int argc,
         char** argv)
@@ -0,0 +1,258 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/logging/BinaryLog.hpp>
+#include <cpp_utils/logging/BinaryLogReader.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace test {
+
+//! Enumeration to log as argument.
+enum class Color
+{
+    red,
+    green,
+};
+
+//! Read every record of binary log \c file_path .
+std::vector<BinaryLogEntry> read_entries(
+        const std::string& file_path)
+{
+    BinaryLogReader reader(file_path);
+    std::vector<BinaryLogEntry> entries;
+    BinaryLogEntry entry;
+    while (reader.next(entry))
+    {
+        entries.push_back(entry);
+    }
+    return entries;
+}
+
+//! Size of file \c file_path .
+std::size_t file_size(
+        const std::string& file_path)
+{
+    std::ifstream file(file_path, std::ios::binary | std::ios::ate);
+    return static_cast<std::size_t>(file.tellg());
+}
+
+} /* namespace test */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils;
+
+/**
+ * Write records with every type of argument, and decode them back to text.
+ */
+TEST(BinaryLogTest, write_read_records)
+{
+    const std::string file_path = "BinaryLogTest_records.bin";
+    BinaryLog::open(file_path);
+    ASSERT_TRUE(BinaryLog::enabled());
+
+    const std::string name = "participant_1";
+    const unsigned int line = __LINE__ + 1;
+    logBinaryInfo(BINARY_LOG_TEST, "Participant {} discovered {} endpoints", name, 3u);
+    logBinaryWarning(BINARY_LOG_TEST, "Integers {} {} {}", -7, static_cast<uint64_t>(1) << 40, static_cast<int8_t>(-1));
+    logBinaryError(BINARY_LOG_TEST, "Others {} {} {} {} {}", 2.5, true, 'x', "text", test::Color::green);
+    logBinaryInfo(BINARY_LOG_TEST, "No arguments");
+    logBinaryInfo(BINARY_LOG_TEST, "More arguments {} than placeholders", 1, 2);
+
+    BinaryLog::close();
+    ASSERT_FALSE(BinaryLog::enabled());
+
+    const std::vector<BinaryLogEntry> entries = test::read_entries(file_path);
+    ASSERT_EQ(entries.size(), 5u);
+
+    ASSERT_EQ(entries[0].message, "Participant participant_1 discovered 3 endpoints");
+    ASSERT_EQ(entries[0].site.category, "BINARY_LOG_TEST");
+    ASSERT_EQ(entries[0].site.kind, VerbosityKind::Info);
+    ASSERT_EQ(entries[0].site.line, line);
+    ASSERT_NE(entries[0].site.file.find("BinaryLogTest.cpp"), std::string::npos);
+
+    ASSERT_EQ(entries[1].message, "Integers -7 1099511627776 -1");
+    ASSERT_EQ(entries[1].site.kind, VerbosityKind::Warning);
+
+    ASSERT_EQ(entries[2].message, "Others 2.5 true x text 1");
+    ASSERT_EQ(entries[2].site.kind, VerbosityKind::Error);
+
+    ASSERT_EQ(entries[3].message, "No arguments");
+    ASSERT_EQ(entries[4].message, "More arguments 1 than placeholders 2");
+
+    // Entries are written as text log lines
+    std::ostringstream line_text;
+    line_text << entries[0];
+    ASSERT_NE(line_text.str().find("[BINARY_LOG_TEST Info] Participant participant_1 discovered 3 endpoints ("),
+        std::string::npos);
+
+    std::remove(file_path.c_str());
+}
+
+/**
+ * Records are not written while the log is closed.
+ */
+TEST(BinaryLogTest, log_closed)
+{
+    const std::string file_path = "BinaryLogTest_closed.bin";
+    BinaryLog::open(file_path);
+    BinaryLog::close();
+    const std::size_t size = test::file_size(file_path);
+
+    logBinaryInfo(BINARY_LOG_TEST, "Not written {}", 1);
+    BinaryLog::flush();
+
+    ASSERT_EQ(test::file_size(file_path), size);
+    ASSERT_TRUE(test::read_entries(file_path).empty());
+
+    std::remove(file_path.c_str());
+}
+
+/**
+ * Several threads write records at the same time. Every record is read back, in order for each thread,
+ * including the ones of threads that ended before the log was closed.
+ */
+TEST(BinaryLogTest, write_from_threads)
+{
+    constexpr unsigned int N_THREADS = 4;
+    constexpr unsigned int N_RECORDS = 5000;
+    const std::string file_path = "BinaryLogTest_threads.bin";
+
+    // Small buffers, so each thread writes several blocks
+    BinaryLog::open(file_path, 1024);
+
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < N_THREADS; ++i)
+    {
+        threads.emplace_back([i]()
+                {
+                    for (unsigned int j = 0; j < N_RECORDS; ++j)
+                    {
+                        logBinaryInfo(BINARY_LOG_TEST, "Thread {} record {}", i, j);
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    BinaryLog::close();
+
+    BinaryLogReader reader(file_path);
+    const std::vector<BinaryLogEntry> entries = reader.read_all_sorted();
+    ASSERT_EQ(entries.size(), N_THREADS * N_RECORDS);
+
+    std::vector<unsigned int> next_record(N_THREADS, 0);
+    for (std::size_t i = 0; i < entries.size(); ++i)
+    {
+        if (i > 0)
+        {
+            ASSERT_LE(entries[i - 1].timestamp, entries[i].timestamp);
+        }
+
+        unsigned int thread;
+        unsigned int record;
+        ASSERT_EQ(std::sscanf(entries[i].message.c_str(), "Thread %u record %u", &thread, &record), 2);
+        ASSERT_LT(thread, N_THREADS);
+        ASSERT_EQ(record, next_record[thread]++);
+    }
+
+    std::remove(file_path.c_str());
+}
+
+/**
+ * A file cut in the middle of a block is read until its last complete record.
+ * Files that are not binary logs are not read.
+ */
+TEST(BinaryLogTest, truncated_file)
+{
+    const std::string file_path = "BinaryLogTest_truncated.bin";
+    BinaryLog::open(file_path);
+    for (unsigned int i = 0; i < 10; ++i)
+    {
+        logBinaryInfo(BINARY_LOG_TEST, "Record {}", i);
+    }
+    BinaryLog::close();
+
+    std::string content;
+    {
+        std::ifstream file(file_path, std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+        file.write(content.data(), content.size() - 3);
+    }
+
+    const std::vector<BinaryLogEntry> entries = test::read_entries(file_path);
+    ASSERT_EQ(entries.size(), 9u);
+    ASSERT_EQ(entries.back().message, "Record 8");
+
+    {
+        std::ofstream file(file_path, std::ios::trunc);
+        file << "This is not a binary log";
+    }
+    ASSERT_THROW(BinaryLogReader reader(file_path), InitializationException);
+
+    std::remove(file_path.c_str());
+}
+
+/**
+ * Measure the time of a record written from a hot path.
+ */
+TEST(BinaryLogTest, log_call_time)
+{
+    constexpr unsigned int N_RECORDS = 1000000;
+    const std::string file_path = "BinaryLogTest_time.bin";
+    BinaryLog::open(file_path);
+
+    const std::string name = "participant_1";
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < N_RECORDS; ++i)
+    {
+        logBinaryInfo(BINARY_LOG_TEST, "Participant {} sent sample {} of size {}", name, i, 1024u);
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    BinaryLog::close();
+
+    const double ns_per_record = elapsed.count() / N_RECORDS;
+    RecordProperty("ns_per_record", static_cast<int>(ns_per_record));
+    std::cout << "BinaryLog record: " << ns_per_record << " ns" << std::endl;
+
+    std::remove(file_path.c_str());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,161 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/logging/CategoryVerbosityRegistry.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace test {
+
+//! Number of times \c message has been called.
+std::atomic<unsigned int> messages_evaluated(0);
+
+//! Message to log, that counts how many times it is evaluated.
+std::string message()
+{
+    messages_evaluated++;
+    return "message";
+}
+
+} /* namespace test */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils;
+using Kind = CategoryVerbosityRegistry::Kind;
+
+/**
+ * Categories without verbosity set have the maximum verbosity.
+ */
+TEST(CategoryVerbosityRegistryTest, default_verbosity)
+{
+    CategoryVerbosityRegistry& registry = CategoryVerbosityRegistry::get_instance();
+    registry.reset();
+
+    const std::atomic<Kind>& level = registry.register_category("DEFAULT_CATEGORY");
+    ASSERT_EQ(level.load(), Kind::Info);
+    ASSERT_EQ(registry.verbosity("NOT_REGISTERED_CATEGORY"), Kind::Info);
+    ASSERT_TRUE(CategoryVerbosityRegistry::is_enabled(level, Kind::Info));
+
+    // The same category gives the same level
+    ASSERT_EQ(&registry.register_category("DEFAULT_CATEGORY"), &level);
+}
+
+/**
+ * Set the verbosity of a category, before and after it is registered.
+ */
+TEST(CategoryVerbosityRegistryTest, set_category_verbosity)
+{
+    CategoryVerbosityRegistry& registry = CategoryVerbosityRegistry::get_instance();
+    registry.reset();
+
+    const std::atomic<Kind>& level = registry.register_category("SET_CATEGORY");
+    const std::atomic<Kind>& other_level = registry.register_category("SET_CATEGORY_OTHER");
+
+    registry.set_verbosity("SET_CATEGORY", Kind::Warning);
+    ASSERT_EQ(level.load(), Kind::Warning);
+    ASSERT_EQ(other_level.load(), Kind::Info);
+    ASSERT_FALSE(CategoryVerbosityRegistry::is_enabled(level, Kind::Info));
+    ASSERT_TRUE(CategoryVerbosityRegistry::is_enabled(level, Kind::Warning));
+    ASSERT_TRUE(CategoryVerbosityRegistry::is_enabled(level, Kind::Error));
+
+    registry.set_verbosity("SET_CATEGORY_LATER", Kind::Error);
+    ASSERT_EQ(registry.register_category("SET_CATEGORY_LATER").load(), Kind::Error);
+
+    registry.reset();
+    ASSERT_EQ(level.load(), Kind::Info);
+    ASSERT_EQ(registry.verbosity("SET_CATEGORY_LATER"), Kind::Info);
+}
+
+/**
+ * Set the verbosity of glob patterns. The last pattern set that matches a category wins.
+ */
+TEST(CategoryVerbosityRegistryTest, glob_pattern)
+{
+    CategoryVerbosityRegistry& registry = CategoryVerbosityRegistry::get_instance();
+    registry.reset();
+
+    const std::atomic<Kind>& participant = registry.register_category("GLOB_PIPE_PARTICIPANT");
+    const std::atomic<Kind>& reader = registry.register_category("GLOB_PIPE_READER");
+    const std::atomic<Kind>& router = registry.register_category("GLOB_ROUTER");
+
+    registry.set_verbosity("GLOB_PIPE_*", Kind::Error);
+    ASSERT_EQ(participant.load(), Kind::Error);
+    ASSERT_EQ(reader.load(), Kind::Error);
+    ASSERT_EQ(router.load(), Kind::Info);
+
+    registry.set_verbosity("GLOB_*_READER", Kind::Warning);
+    ASSERT_EQ(participant.load(), Kind::Error);
+    ASSERT_EQ(reader.load(), Kind::Warning);
+
+    // Categories registered later match the patterns when registered
+    ASSERT_EQ(registry.register_category("GLOB_PIPE_WRITER").load(), Kind::Error);
+    ASSERT_EQ(registry.register_category("GLOB_PIPE_READER").load(), Kind::Warning);
+
+    // Setting a pattern again makes it the last one
+    registry.set_verbosity("GLOB_PIPE_*", Kind::Info);
+    ASSERT_EQ(reader.load(), Kind::Info);
+    ASSERT_EQ(registry.verbosity("GLOB_NEW_READER"), Kind::Warning);
+
+    registry.reset();
+}
+
+/**
+ * Log macros do not evaluate the message of a category with a lower verbosity, and measure the time they take.
+ */
+TEST(CategoryVerbosityRegistryTest, skip_disabled_category)
+{
+    constexpr unsigned int N_CALLS = 10000000;
+
+    CategoryVerbosityRegistry& registry = CategoryVerbosityRegistry::get_instance();
+    registry.reset();
+    registry.set_verbosity("DISABLED_CATEGORY", Kind::Error);
+
+    Log::SetVerbosity(Log::Kind::Info);
+    const unsigned int evaluated = test::messages_evaluated.load();
+
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < N_CALLS; ++i)
+    {
+        logDebug(DISABLED_CATEGORY, test::message());
+        logDevError(DISABLED_CATEGORY, test::message());
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_EQ(test::messages_evaluated.load(), evaluated);
+
+    const double ns_per_call = elapsed.count() / (2 * N_CALLS);
+    RecordProperty("ns_per_disabled_call", std::to_string(ns_per_call));
+    std::cout << "Log call of disabled category: " << ns_per_call << " ns" << std::endl;
+
+    Log::SetVerbosity(Log::Kind::Warning);
+    registry.reset();
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
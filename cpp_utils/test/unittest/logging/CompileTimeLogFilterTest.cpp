@@ -0,0 +1,273 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Categories compiled out in this test, as CMake option CPP_UTILS_LOG_DISABLED_CATEGORIES would set them
+#define CPP_UTILS_LOG_DISABLED_CATEGORIES "UTILS_WAIT*, LIMITLESS_POOL, DISABLED_CATEGORY"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/logging/CategoryVerbosityRegistry.hpp>
+#include <cpp_utils/logging/compile_time_log_filter.hpp>
+#include <cpp_utils/wait/DBQueueWaitHandler.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace test {
+
+//! Number of times \c message has been called.
+std::atomic<unsigned int> messages_evaluated(0);
+
+//! Message to log, that counts how many times it is evaluated.
+std::string message()
+{
+    messages_evaluated++;
+    return "message";
+}
+
+//! Log consumer that counts the entries received.
+class CountingLogConsumer : public LogConsumer
+{
+public:
+
+    CountingLogConsumer(
+            std::atomic<unsigned int>& entries)
+        : entries_(entries)
+    {
+    }
+
+    void Consume(
+            const Log::Entry& /* entry */) override
+    {
+        entries_++;
+    }
+
+protected:
+
+    std::atomic<unsigned int>& entries_;
+};
+
+//! Log consumer that keeps the function of the last entry received.
+class FunctionLogConsumer : public LogConsumer
+{
+public:
+
+    FunctionLogConsumer(
+            std::string& function)
+        : function_(function)
+    {
+    }
+
+    void Consume(
+            const Log::Entry& entry) override
+    {
+        function_ = entry.context.function;
+    }
+
+protected:
+
+    std::string& function_;
+};
+
+//! Log a message of a category compiled in, from a function with a known name.
+void log_from_function()
+{
+    logDebug(ENABLED_CATEGORY, "message");
+}
+
+/**
+ * @brief Produce and consume \c n_values values in \c handler .
+ *
+ * If \c log_each_value , a message of category \c DISABLED_AT_RUNTIME is logged for each value.
+ */
+void produce_consume(
+        event::DBQueueWaitHandler<int>& handler,
+        unsigned int n_values,
+        bool log_each_value)
+{
+    for (unsigned int i = 0; i < n_values; ++i)
+    {
+        if (log_each_value)
+        {
+            logDebug(DISABLED_AT_RUNTIME, "Producing value " << i << ".");
+        }
+        handler.produce(static_cast<int>(i));
+        handler.consume();
+    }
+}
+
+} /* namespace test */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils;
+
+/**
+ * Check the categories matched by the lists of categories, at compile time.
+ *
+ * CASES:
+ * - Exact names
+ * - Prefixes ending in *
+ * - Names that only share a prefix with an entry
+ * - Spaces around names
+ * - * not at the end of a name
+ * - Levels
+ */
+TEST(CompileTimeLogFilterTest, category_lists)
+{
+    // Exact names
+    static_assert(category_in_list("LIMITLESS_POOL", "UTILS_WAIT,LIMITLESS_POOL"), "");
+    static_assert(category_in_list("UTILS_WAIT", "UTILS_WAIT,LIMITLESS_POOL"), "");
+    static_assert(!category_in_list("UTILS_THREAD_POOL", "UTILS_WAIT,LIMITLESS_POOL"), "");
+    static_assert(!category_in_list("UTILS_WAIT", ""), "");
+
+    // Prefixes ending in *
+    static_assert(category_in_list("UTILS_WAIT_DBQUEUE", "LIMITLESS_POOL,UTILS_WAIT*"), "");
+    static_assert(category_in_list("UTILS_WAIT", "UTILS_WAIT*"), "");
+    static_assert(category_in_list("ANY_CATEGORY", "*"), "");
+    static_assert(!category_in_list("UTILS_THREAD_POOL", "UTILS_WAIT*"), "");
+
+    // Names that only share a prefix with an entry
+    static_assert(!category_in_list("UTILS_WAIT_DBQUEUE", "UTILS_WAIT"), "");
+    static_assert(!category_in_list("UTILS", "UTILS_WAIT"), "");
+
+    // Spaces around names
+    static_assert(category_in_list("LIMITLESS_POOL", "UTILS_WAIT, LIMITLESS_POOL"), "");
+    static_assert(category_in_list("UTILS_WAIT", "  UTILS_WAIT ,LIMITLESS_POOL"), "");
+    static_assert(category_in_list("UTILS_WAIT_DBQUEUE", "LIMITLESS_POOL, UTILS_WAIT* "), "");
+    static_assert(!category_in_list("UTILS_WAIT", " , "), "");
+
+    // * not at the end of a name
+    static_assert(!category_in_list("UTILS_THREAD_POOL", "UTILS_*_POOL"), "");
+    static_assert(!category_in_list("UTILS_WAIT", "*UTILS_WAIT"), "");
+
+    // Levels, with the lists of this test
+    static_assert(!is_log_compiled("UTILS_WAIT_DBQUEUE", Log::Kind::Info), "");
+    static_assert(!is_log_compiled("DISABLED_CATEGORY", Log::Kind::Error), "");
+    static_assert(is_log_compiled("UTILS_THREAD_POOL", Log::Kind::Info), "");
+
+    ASSERT_FALSE((CPP_UTILS_IS_LOG_COMPILED(LIMITLESS_POOL, Log::Kind::Warning)));
+    ASSERT_TRUE((CPP_UTILS_IS_LOG_COMPILED(ENABLED_CATEGORY, Log::Kind::Info)));
+}
+
+/**
+ * Log messages of a category compiled out with every verbosity enabled at runtime.
+ * Their arguments are not evaluated and nothing is logged, while the same messages of other categories are.
+ */
+TEST(CompileTimeLogFilterTest, compiled_out_arguments)
+{
+    std::atomic<unsigned int> entries(0);
+    Log::ClearConsumers();
+    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new test::CountingLogConsumer(entries)));
+    Log::SetVerbosity(Log::Kind::Info);
+    CategoryVerbosityRegistry::get_instance().reset();
+
+    const unsigned int evaluated = test::messages_evaluated.load();
+
+    logDebug(DISABLED_CATEGORY, test::message());
+    logDevError(DISABLED_CATEGORY, test::message());
+    logDebug(UTILS_WAIT_DBQUEUE, test::message());
+    Log::Flush();
+
+    ASSERT_EQ(test::messages_evaluated.load(), evaluated);
+    ASSERT_EQ(entries.load(), 0u);
+
+    logDebug(ENABLED_CATEGORY, test::message());
+    logDevError(ENABLED_CATEGORY, test::message());
+    Log::Flush();
+
+    ASSERT_EQ(test::messages_evaluated.load(), evaluated + 2);
+    ASSERT_EQ(entries.load(), 2u);
+
+    Log::ClearConsumers();
+    Log::SetVerbosity(Log::Kind::Warning);
+}
+
+/**
+ * Log a message of a category compiled in, whose context keeps the name of the function that logs it.
+ */
+TEST(CompileTimeLogFilterTest, context_function)
+{
+    std::string function;
+    Log::ClearConsumers();
+    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new test::FunctionLogConsumer(function)));
+    Log::SetVerbosity(Log::Kind::Info);
+    CategoryVerbosityRegistry::get_instance().reset();
+
+    test::log_from_function();
+    Log::Flush();
+
+    ASSERT_EQ(function, "log_from_function");
+
+    Log::ClearConsumers();
+    Log::SetVerbosity(Log::Kind::Warning);
+}
+
+/**
+ * Produce and consume values in a \c DBQueueWaitHandler , whose category \c UTILS_WAIT_DBQUEUE is compiled out,
+ * with every verbosity enabled at runtime.
+ *
+ * Nothing is logged from the queue, and its time per value is compared with the same loop logging a message of a
+ * category only disabled at runtime, which is the cost each log call in the hot path would have otherwise.
+ */
+TEST(CompileTimeLogFilterTest, queue_hot_path)
+{
+    constexpr unsigned int N_VALUES = 1000000;
+
+    std::atomic<unsigned int> entries(0);
+    Log::ClearConsumers();
+    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new test::CountingLogConsumer(entries)));
+    Log::SetVerbosity(Log::Kind::Info);
+    CategoryVerbosityRegistry::get_instance().reset();
+    CategoryVerbosityRegistry::get_instance().set_verbosity("DISABLED_AT_RUNTIME", Log::Kind::Error);
+
+    event::DBQueueWaitHandler<int> handler;
+
+    auto start = std::chrono::steady_clock::now();
+    test::produce_consume(handler, N_VALUES, false);
+    const std::chrono::duration<double, std::nano> compiled_out = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    test::produce_consume(handler, N_VALUES, true);
+    const std::chrono::duration<double, std::nano> disabled_at_runtime = std::chrono::steady_clock::now() - start;
+
+    Log::Flush();
+    ASSERT_EQ(entries.load(), 0u);
+
+    const double ns_compiled_out = compiled_out.count() / N_VALUES;
+    const double ns_disabled_at_runtime = disabled_at_runtime.count() / N_VALUES;
+    RecordProperty("ns_per_value", std::to_string(ns_compiled_out));
+    RecordProperty("ns_per_value_runtime_check", std::to_string(ns_disabled_at_runtime));
+    std::cout << "Queue value with logs compiled out: " << ns_compiled_out << " ns" << std::endl;
+    std::cout << "Queue value with a log call disabled at runtime: " << ns_disabled_at_runtime << " ns" << std::endl;
+
+    Log::ClearConsumers();
+    Log::SetVerbosity(Log::Kind::Warning);
+    CategoryVerbosityRegistry::get_instance().reset();
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,456 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/logging/DeferredLog.hpp>
+#include <cpp_utils/logging/LogStaging.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace test {
+
+//! Consumer that keeps the messages of the entries consumed.
+class CaptureLogConsumer : public LogConsumer
+{
+public:
+
+    void Consume(
+            const Log::Entry& entry) override
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        messages.push_back(entry.message);
+    }
+
+    static std::mutex mutex;
+
+    static std::vector<std::string> messages;
+};
+
+std::mutex CaptureLogConsumer::mutex;
+std::vector<std::string> CaptureLogConsumer::messages;
+
+//! Messages consumed so far.
+std::vector<std::string> messages()
+{
+    std::lock_guard<std::mutex> lock(CaptureLogConsumer::mutex);
+    return CaptureLogConsumer::messages;
+}
+
+//! Register a \c CaptureLogConsumer in Fast DDS Log, with no messages yet, and accept every kind.
+void capture_log()
+{
+    {
+        std::lock_guard<std::mutex> lock(CaptureLogConsumer::mutex);
+        CaptureLogConsumer::messages.clear();
+    }
+    Log::ClearConsumers();
+    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new CaptureLogConsumer()));
+    Log::SetVerbosity(Log::Kind::Info);
+    CategoryVerbosityRegistry::get_instance().reset();
+}
+
+//! Argument that keeps the thread where it is formatted.
+struct ThreadArgument
+{
+    mutable std::thread::id formatted_in;
+};
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const ThreadArgument& arg)
+{
+    arg.formatted_in = std::this_thread::get_id();
+    os << "thread";
+    return os;
+}
+
+//! Argument that blocks the thread that formats it until \c open is called.
+struct GateArgument
+{
+    static void open()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            opened = true;
+        }
+        cv.notify_all();
+    }
+
+    static void close()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        opened = false;
+    }
+
+    static std::mutex mutex;
+    static std::condition_variable cv;
+    static bool opened;
+};
+
+std::mutex GateArgument::mutex;
+std::condition_variable GateArgument::cv;
+bool GateArgument::opened = false;
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const GateArgument& /* arg */)
+{
+    std::unique_lock<std::mutex> lock(GateArgument::mutex);
+    GateArgument::cv.wait(lock, []()
+            {
+                return GateArgument::opened;
+            });
+    os << "gate";
+    return os;
+}
+
+//! Argument that counts how many times it is formatted.
+struct CountedArgument
+{
+    static std::atomic<unsigned int> formatted;
+};
+
+std::atomic<unsigned int> CountedArgument::formatted(0);
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const CountedArgument& /* arg */)
+{
+    CountedArgument::formatted++;
+    os << "counted";
+    return os;
+}
+
+//! Argument that logs a deferred entry each time it is copied.
+struct LoggingArgument
+{
+    LoggingArgument() = default;
+
+    LoggingArgument(
+            const LoggingArgument& /* other */)
+    {
+        logDeferredInfo(DEFERRED_LOG_TEST, "Argument copied");
+    }
+};
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const LoggingArgument& /* arg */)
+{
+    os << "logging";
+    return os;
+}
+
+} /* namespace test */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils;
+
+/**
+ * While the log is not started, messages are formatted in the calling thread and passed to Fast DDS Log at once.
+ */
+TEST(DeferredLogTest, not_started)
+{
+    test::capture_log();
+    ASSERT_FALSE(DeferredLog::enabled());
+
+    test::ThreadArgument thread_argument;
+    logDeferredInfo(DEFERRED_LOG_TEST, "Formatted in {}", thread_argument);
+    Log::Flush();
+
+    ASSERT_EQ(test::messages(), std::vector<std::string>({"Formatted in thread"}));
+    ASSERT_EQ(thread_argument.formatted_in, std::this_thread::get_id());
+
+    ASSERT_THROW(DeferredLog::start(0), InitializationException);
+    Log::ClearConsumers();
+}
+
+/**
+ * Messages are formatted in the log thread, with copies of the arguments taken when they were logged.
+ *
+ * CASES:
+ * - Integers, floating point numbers, bool and char
+ * - Strings changed after logging them
+ * - Objects with operator<<
+ * - More arguments than {} and more {} than arguments
+ */
+TEST(DeferredLogTest, deferred_format)
+{
+    test::capture_log();
+    DeferredLog::start();
+    ASSERT_TRUE(DeferredLog::enabled());
+
+    // Integers, floating point numbers, bool and char
+    logDeferredInfo(DEFERRED_LOG_TEST, "{} {} {} {} {} {}", -3, 42u, 0.5, true, 'c', static_cast<uint64_t>(1) << 40);
+
+    // Strings changed after logging them
+    std::string topic = "rt/chatter";
+    char reader[16] = "reader_1";
+    const char* literal = "literal";
+    logDeferredWarning(DEFERRED_LOG_TEST, "Topic {} of {} in {}", topic, reader, literal);
+    topic = "changed";
+    reader[0] = 'X';
+
+    // Objects with operator<<
+    logDeferredError(DEFERRED_LOG_TEST, "Object {}", test::CountedArgument());
+
+    // More arguments than {} and more {} than arguments
+    logDeferredInfo(DEFERRED_LOG_TEST, "Values:", 1, "two", 3.5);
+    logDeferredInfo(DEFERRED_LOG_TEST, "Only {} of {}", 1);
+    logDeferredInfo(DEFERRED_LOG_TEST, "No arguments");
+
+    DeferredLog::flush();
+
+    ASSERT_EQ(test::messages(), std::vector<std::string>({
+        "-3 42 0.5 1 c 1099511627776",
+        "Topic rt/chatter of reader_1 in literal",
+        "Object counted",
+        "Values: 1 two 3.5",
+        "Only 1 of {}",
+        "No arguments"}));
+
+    DeferredLog::stop();
+    ASSERT_FALSE(DeferredLog::enabled());
+    Log::ClearConsumers();
+}
+
+/**
+ * Objects are formatted in the log thread, unless the texts of the entry do not fit in its buffer.
+ */
+TEST(DeferredLogTest, format_thread)
+{
+    test::capture_log();
+    DeferredLog::start();
+
+    test::ThreadArgument thread_argument;
+    logDeferredInfo(DEFERRED_LOG_TEST, "Formatted in {}", thread_argument);
+    DeferredLog::flush();
+
+    // The copy of the argument is the one formatted
+    ASSERT_EQ(thread_argument.formatted_in, std::thread::id());
+    ASSERT_EQ(test::messages(), std::vector<std::string>({"Formatted in thread"}));
+
+    // Texts longer than the buffer
+    const std::string long_text(DeferredLogEntry::ARGUMENTS_CAPACITY, 'x');
+    logDeferredInfo(DEFERRED_LOG_TEST, "{} in {}", long_text, thread_argument);
+    ASSERT_EQ(thread_argument.formatted_in, std::this_thread::get_id());
+    DeferredLog::flush();
+    ASSERT_EQ(test::messages().back(), long_text + " in thread");
+
+    DeferredLog::stop();
+    Log::ClearConsumers();
+}
+
+/**
+ * Entries whose kind is not accepted any more when the log thread takes them are not formatted.
+ * Entries that do not fit in the queue are dropped.
+ */
+TEST(DeferredLogTest, filter_and_drop)
+{
+    constexpr std::size_t QUEUE_SIZE = 4;
+
+    test::capture_log();
+    DeferredLog::start(QUEUE_SIZE);
+    const uint64_t filtered = DeferredLog::filtered_entries();
+    const uint64_t dropped = DeferredLog::dropped_entries();
+    const unsigned int formatted = test::CountedArgument::formatted.load();
+
+    // The log thread is blocked formatting the first entry, so the rest wait in the queue
+    test::GateArgument::close();
+    logDeferredInfo(DEFERRED_LOG_TEST_GATE, "Entry {}", test::GateArgument());
+    for (int i = 0; i < 10; ++i)
+    {
+        logDeferredInfo(DEFERRED_LOG_TEST_FILTERED, "Entry {}", test::CountedArgument());
+    }
+
+    // The queue holds the entry being formatted and 3 more
+    ASSERT_EQ(DeferredLog::dropped_entries(), dropped + 10 - (QUEUE_SIZE - 1));
+
+    CategoryVerbosityRegistry::get_instance().set_verbosity("DEFERRED_LOG_TEST_FILTERED", Log::Kind::Warning);
+    test::GateArgument::open();
+    DeferredLog::flush();
+
+    ASSERT_EQ(test::messages(), std::vector<std::string>({"Entry gate"}));
+    ASSERT_EQ(DeferredLog::filtered_entries(), filtered + QUEUE_SIZE - 1);
+    ASSERT_EQ(test::CountedArgument::formatted.load(), formatted);
+
+    DeferredLog::stop();
+    Log::ClearConsumers();
+}
+
+/**
+ * Log entries from several threads. Every entry is formatted once, in the order of its thread.
+ */
+TEST(DeferredLogTest, concurrent_write)
+{
+    constexpr unsigned int N_THREADS = 4;
+    constexpr unsigned int N_ENTRIES = 2000;
+
+    test::capture_log();
+    DeferredLog::start(N_THREADS * N_ENTRIES);
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < N_THREADS; ++t)
+    {
+        threads.emplace_back([t]()
+                {
+                    for (unsigned int i = 0; i < N_ENTRIES; ++i)
+                    {
+                        logDeferredInfo(DEFERRED_LOG_TEST, "{} {}", t, i);
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    DeferredLog::flush();
+
+    const std::vector<std::string> messages = test::messages();
+    ASSERT_EQ(messages.size(), N_THREADS * N_ENTRIES);
+
+    std::vector<unsigned int> next(N_THREADS, 0);
+    for (const std::string& message : messages)
+    {
+        const unsigned int t = std::stoul(message);
+        ASSERT_EQ(message, std::to_string(t) + " " + std::to_string(next[t]));
+        next[t]++;
+    }
+
+    DeferredLog::stop();
+    Log::ClearConsumers();
+}
+
+/**
+ * Log an entry with an argument whose copy logs another entry, from several threads.
+ * Arguments are copied without holding the queue, so it does not deadlock, and every entry is formatted.
+ */
+TEST(DeferredLogTest, reentrant_write)
+{
+    constexpr unsigned int N_THREADS = 4;
+    constexpr unsigned int N_ENTRIES = 500;
+
+    test::capture_log();
+    DeferredLog::start(2 * N_THREADS * N_ENTRIES);
+    const uint64_t dropped = DeferredLog::dropped_entries();
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < N_THREADS; ++t)
+    {
+        threads.emplace_back([]()
+                {
+                    for (unsigned int i = 0; i < N_ENTRIES; ++i)
+                    {
+                        logDeferredInfo(DEFERRED_LOG_TEST, "Entry {}", test::LoggingArgument());
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    DeferredLog::flush();
+
+    const std::vector<std::string> messages = test::messages();
+    ASSERT_EQ(std::count(messages.begin(), messages.end(), "Entry logging"), N_THREADS * N_ENTRIES);
+    ASSERT_EQ(std::count(messages.begin(), messages.end(), "Argument copied"), N_THREADS * N_ENTRIES);
+    ASSERT_EQ(DeferredLog::dropped_entries(), dropped);
+
+    DeferredLog::stop();
+    Log::ClearConsumers();
+}
+
+/**
+ * Flushing the deferred log waits for the entries staged by \c LogStaging too.
+ */
+TEST(DeferredLogTest, flush_staged_entries)
+{
+    test::capture_log();
+    LogStaging::start();
+    DeferredLog::start();
+
+    LogStaging::queue_log("Staged entry", Log::Context{__FILE__, __LINE__, __func__, "DEFERRED_LOG_TEST"},
+            Log::Kind::Info);
+    logDeferredInfo(DEFERRED_LOG_TEST, "Deferred entry");
+    DeferredLog::flush();
+
+    const std::vector<std::string> messages = test::messages();
+    ASSERT_EQ(std::count(messages.begin(), messages.end(), "Staged entry"), 1);
+    ASSERT_EQ(std::count(messages.begin(), messages.end(), "Deferred entry"), 1);
+
+    DeferredLog::stop();
+    LogStaging::stop();
+    Log::ClearConsumers();
+}
+
+/**
+ * Measure the time the logging thread spends per entry, capturing it for the log thread and formatting it itself.
+ * It is reported as a property of the test, and printed.
+ */
+TEST(DeferredLogTest, hot_path_rate)
+{
+    constexpr unsigned int N_ENTRIES = 100000;
+
+    test::capture_log();
+    Log::ClearConsumers();
+
+    const std::string topic = "rt/chatter";
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < N_ENTRIES; ++i)
+    {
+        logDeferredWarning(DEFERRED_LOG_TEST, "Reader {} of topic {} lost {} samples in {} s", i, topic, i % 7, 0.25);
+    }
+    const std::chrono::duration<double, std::nano> formatted_now = std::chrono::steady_clock::now() - start;
+
+    DeferredLog::start(N_ENTRIES);
+    start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < N_ENTRIES; ++i)
+    {
+        logDeferredWarning(DEFERRED_LOG_TEST, "Reader {} of topic {} lost {} samples in {} s", i, topic, i % 7, 0.25);
+    }
+    const std::chrono::duration<double, std::nano> deferred = std::chrono::steady_clock::now() - start;
+    DeferredLog::stop();
+
+    const double ns_formatted_now = formatted_now.count() / N_ENTRIES;
+    const double ns_deferred = deferred.count() / N_ENTRIES;
+    RecordProperty("ns_per_entry_formatted", std::to_string(ns_formatted_now));
+    RecordProperty("ns_per_entry_deferred", std::to_string(ns_deferred));
+    std::cout << "Entry formatted in the logging thread: " << ns_formatted_now << " ns" << std::endl;
+    std::cout << "Entry deferred to the log thread: " << ns_deferred << " ns" << std::endl;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
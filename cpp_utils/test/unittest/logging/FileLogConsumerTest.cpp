@@ -0,0 +1,314 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // if !defined(_WIN32)
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <cpp_utils/testing/LogEntryBuilder.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/logging/FileLogConsumer.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace test {
+
+//! Create a configuration that accepts every entry in \c file_path .
+FileLogConfiguration configuration(
+        const std::string& file_path)
+{
+    FileLogConfiguration log_configuration;
+    log_configuration.verbosity = VerbosityKind::Info;
+    log_configuration.file_path = file_path;
+    return log_configuration;
+}
+
+//! Category of the entries of these tests.
+constexpr const char* CATEGORY = "FILE_LOG_CONSUMER_TEST";
+
+//! Lines of file \c file_path . Empty if it does not exist.
+std::vector<std::string> read_lines(
+        const std::string& file_path)
+{
+    std::vector<std::string> lines;
+    std::ifstream file(file_path);
+    std::string line;
+    while (std::getline(file, line))
+    {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+//! Whether file \c file_path exists.
+bool file_exists(
+        const std::string& file_path)
+{
+    return std::ifstream(file_path).good();
+}
+
+} /* namespace test */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils;
+using eprosima::utils::testing::LogEntryBuilder;
+
+/**
+ * A consumer is not created with an invalid configuration or a file that cannot be opened.
+ */
+TEST(FileLogConsumerTest, invalid_configuration)
+{
+    FileLogConfiguration log_configuration = test::configuration("");
+    ASSERT_THROW(FileLogConsumer consumer(&log_configuration), InitializationException);
+
+    log_configuration = test::configuration("FileLogConsumerTest_invalid.log");
+    log_configuration.buffer_size = 0;
+    ASSERT_THROW(FileLogConsumer consumer(&log_configuration), InitializationException);
+
+    log_configuration = test::configuration("non_existent_directory/FileLogConsumerTest.log");
+    ASSERT_THROW(FileLogConsumer consumer(&log_configuration), InitializationException);
+}
+
+/**
+ * Consume entries in several buffers, and read them from the file once flushed.
+ * Entries not accepted by the filter are not written.
+ */
+TEST(FileLogConsumerTest, write_entries)
+{
+    constexpr unsigned int N_ENTRIES = 1000;
+    const std::string file_path = "FileLogConsumerTest_write.log";
+    std::remove(file_path.c_str());
+
+    FileLogConfiguration log_configuration = test::configuration(file_path);
+    log_configuration.buffer_size = 1024;
+    log_configuration.queue_size = N_ENTRIES;
+    log_configuration.filter[VerbosityKind::Info] = std::string("entry");
+    FileLogConsumer consumer(&log_configuration);
+
+    for (unsigned int i = 0; i < N_ENTRIES; ++i)
+    {
+        consumer.Consume(LogEntryBuilder("entry " + std::to_string(i)).category(test::CATEGORY));
+        consumer.Consume(LogEntryBuilder("filtered").category(test::CATEGORY));
+    }
+    consumer.flush();
+
+    const std::vector<std::string> lines = test::read_lines(file_path);
+    ASSERT_EQ(lines.size(), N_ENTRIES);
+    for (unsigned int i = 0; i < N_ENTRIES; ++i)
+    {
+        ASSERT_NE(lines[i].find("entry " + std::to_string(i)), std::string::npos);
+        ASSERT_NE(lines[i].find("FILE_LOG_CONSUMER_TEST"), std::string::npos);
+    }
+    ASSERT_EQ(consumer.dropped_entries(), 0u);
+
+    std::remove(file_path.c_str());
+}
+
+/**
+ * Entries are appended to an existing file, and every entry is written when the consumer is destroyed.
+ */
+TEST(FileLogConsumerTest, append_to_file)
+{
+    const std::string file_path = "FileLogConsumerTest_append.log";
+    {
+        std::ofstream file(file_path);
+        file << "first line" << std::endl;
+    }
+
+    {
+        const FileLogConfiguration log_configuration = test::configuration(file_path);
+        FileLogConsumer consumer(&log_configuration);
+        consumer.Consume(LogEntryBuilder("second line").category(test::CATEGORY));
+    }
+
+    const std::vector<std::string> lines = test::read_lines(file_path);
+    ASSERT_EQ(lines.size(), 2u);
+    ASSERT_EQ(lines[0], "first line");
+    ASSERT_NE(lines[1].find("second line"), std::string::npos);
+
+    std::remove(file_path.c_str());
+}
+
+/**
+ * An entry in a buffer not full is written once the flush interval expires, without calling flush.
+ */
+TEST(FileLogConsumerTest, flush_interval)
+{
+    const std::string file_path = "FileLogConsumerTest_interval.log";
+    std::remove(file_path.c_str());
+
+    FileLogConfiguration log_configuration = test::configuration(file_path);
+    log_configuration.flush_interval = 20;
+    FileLogConsumer consumer(&log_configuration);
+
+    consumer.Consume(LogEntryBuilder("entry").category(test::CATEGORY));
+
+    bool written = false;
+    for (int i = 0; i < 500 && !written; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        written = test::read_lines(file_path).size() == 1;
+    }
+    ASSERT_TRUE(written);
+
+    std::remove(file_path.c_str());
+}
+
+/**
+ * Write more than the maximum size of the file, so it is rotated, and only the newest rotated files are kept.
+ */
+TEST(FileLogConsumerTest, rotate_file)
+{
+    constexpr unsigned int N_ENTRIES = 200;
+    const std::string file_path = "FileLogConsumerTest_rotate.log";
+    const auto rotated = [&file_path](unsigned int i)
+            {
+                return file_path + "." + std::to_string(i);
+            };
+
+    for (unsigned int i = 1; i <= 4; ++i)
+    {
+        std::remove(rotated(i).c_str());
+    }
+    std::remove(file_path.c_str());
+
+    FileLogConfiguration log_configuration = test::configuration(file_path);
+    log_configuration.buffer_size = 256;
+    log_configuration.queue_size = N_ENTRIES;
+    log_configuration.max_file_size = 1024;
+    log_configuration.max_rotated_files = 2;
+    FileLogConsumer consumer(&log_configuration);
+
+    for (unsigned int i = 0; i < N_ENTRIES; ++i)
+    {
+        consumer.Consume(LogEntryBuilder("entry " + std::to_string(i)).category(test::CATEGORY));
+        consumer.flush();
+    }
+
+    ASSERT_TRUE(test::file_exists(rotated(1)));
+    ASSERT_TRUE(test::file_exists(rotated(2)));
+    ASSERT_FALSE(test::file_exists(rotated(3)));
+
+    // The newest entries are in the current file, and the rotated ones are full
+    ASSERT_NE(test::read_lines(file_path).back().find("entry " + std::to_string(N_ENTRIES - 1)), std::string::npos);
+    std::ifstream rotated_file(rotated(1), std::ios::ate);
+    ASSERT_GE(static_cast<uint64_t>(rotated_file.tellg()), log_configuration.max_file_size);
+
+    for (unsigned int i = 1; i <= 2; ++i)
+    {
+        std::remove(rotated(i).c_str());
+    }
+    std::remove(file_path.c_str());
+}
+
+#if !defined(_WIN32)
+
+/**
+ * Block the writer writing in a pipe that is not read, so the queue gets full and entries are dropped.
+ * Once the pipe is read, the entries not dropped are written with a line reporting the ones dropped.
+ */
+TEST(FileLogConsumerTest, drop_entries_queue_full)
+{
+    constexpr unsigned int N_ENTRIES = 10000;
+    const std::string fifo_path = "FileLogConsumerTest_fifo";
+    std::remove(fifo_path.c_str());
+    ASSERT_EQ(mkfifo(fifo_path.c_str(), 0600), 0);
+
+    // Open the reading end first, so opening the writing end does not block
+    const int read_fd = open(fifo_path.c_str(), O_RDONLY | O_NONBLOCK);
+    ASSERT_GE(read_fd, 0);
+
+    std::string data_read;
+    std::thread reader;
+    uint64_t dropped_entries;
+    {
+        FileLogConfiguration log_configuration = test::configuration(fifo_path);
+        log_configuration.buffer_size = 1024;
+        log_configuration.queue_size = 4;
+        FileLogConsumer consumer(&log_configuration);
+
+        for (unsigned int i = 0; i < N_ENTRIES; ++i)
+        {
+            consumer.Consume(LogEntryBuilder("entry " + std::to_string(i)).category(test::CATEGORY));
+        }
+
+        dropped_entries = consumer.dropped_entries();
+
+        fcntl(read_fd, F_SETFL, O_RDONLY);
+        reader = std::thread([read_fd, &data_read]()
+                        {
+                            char buffer[4096];
+                            ssize_t bytes;
+                            while ((bytes = read(read_fd, buffer, sizeof(buffer))) > 0)
+                            {
+                                data_read.append(buffer, static_cast<std::size_t>(bytes));
+                            }
+                        });
+
+        consumer.flush();
+        EXPECT_EQ(consumer.dropped_entries(), dropped_entries);
+    }
+    reader.join();
+    close(read_fd);
+
+    // The pipe holds much less than every entry
+    ASSERT_GT(dropped_entries, 0u);
+
+    // Entries dropped may be reported in several lines, if some were dropped after a write
+    unsigned int lines = 0;
+    uint64_t dropped_reported = 0;
+    std::size_t start = 0;
+    std::size_t end;
+    while ((end = data_read.find('\n', start)) != std::string::npos)
+    {
+        const std::string line = data_read.substr(start, end - start);
+        const std::string notice = "FileLogConsumer dropped ";
+        if (line.compare(0, notice.size(), notice) == 0)
+        {
+            dropped_reported += std::stoull(line.substr(notice.size()));
+        }
+        else
+        {
+            lines++;
+        }
+        start = end + 1;
+    }
+    ASSERT_EQ(dropped_reported, dropped_entries);
+    ASSERT_EQ(lines + dropped_entries, N_ENTRIES);
+
+    std::remove(fifo_path.c_str());
+}
+
+#endif // if !defined(_WIN32)
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
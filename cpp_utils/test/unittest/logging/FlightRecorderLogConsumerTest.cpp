@@ -0,0 +1,351 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <cpp_utils/testing/LogEntryBuilder.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/logging/FlightRecorderLogConsumer.hpp>
+#include <cpp_utils/logging/FlightRecorderReader.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace test {
+
+//! Create a configuration that accepts every entry in a ring of \c ring_size bytes in \c file_path .
+FlightRecorderLogConfiguration configuration(
+        const std::string& file_path,
+        uint64_t ring_size = 64 * 1024)
+{
+    FlightRecorderLogConfiguration log_configuration;
+    log_configuration.verbosity = VerbosityKind::Info;
+    log_configuration.file_path = file_path;
+    log_configuration.ring_size = ring_size;
+    return log_configuration;
+}
+
+//! Category of the entries of these tests.
+constexpr const char* CATEGORY = "FLIGHT_RECORDER_TEST";
+
+//! File name of the entries of these tests, shorter than the path in \c __FILE__ so records have a known size.
+constexpr const char* FILE_NAME = "FlightRecorderLogConsumerTest.cpp";
+
+//! Timestamp of the entries of these tests.
+constexpr const char* TIMESTAMP = "2024-01-01 00:00:00.000";
+
+//! Start an entry with \c message and the category, file name and timestamp of these tests.
+testing::LogEntryBuilder entry(
+        const std::string& message)
+{
+    return testing::LogEntryBuilder(message).category(CATEGORY).at(FILE_NAME, 0).timestamp(TIMESTAMP);
+}
+
+//! Messages of every entry of the ring in \c file_path , from the oldest.
+std::vector<std::string> read_messages(
+        const std::string& file_path)
+{
+    std::vector<std::string> messages;
+    FlightRecorderReader reader(file_path);
+    FlightRecorderEntry entry;
+    while (reader.next(entry))
+    {
+        messages.push_back(entry.message);
+    }
+    return messages;
+}
+
+} /* namespace test */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils;
+
+/**
+ * Create consumers with invalid configurations.
+ *
+ * CASES:
+ * - Empty file path
+ * - Ring too small
+ * - Ring size not aligned
+ * - Directory that does not exist
+ */
+TEST(FlightRecorderLogConsumerTest, invalid_configuration)
+{
+    FlightRecorderLogConfiguration log_configuration = test::configuration("");
+    ASSERT_THROW(FlightRecorderLogConsumer consumer(&log_configuration), InitializationException);
+
+    log_configuration = test::configuration("FlightRecorderLogConsumerTest_invalid.ring", 1024);
+    ASSERT_THROW(FlightRecorderLogConsumer consumer(&log_configuration), InitializationException);
+
+    log_configuration = test::configuration("FlightRecorderLogConsumerTest_invalid.ring", 64 * 1024 + 4);
+    ASSERT_THROW(FlightRecorderLogConsumer consumer(&log_configuration), InitializationException);
+
+    log_configuration = test::configuration("non_existent_directory/FlightRecorderLogConsumerTest.ring");
+    ASSERT_THROW(FlightRecorderLogConsumer consumer(&log_configuration), InitializationException);
+}
+
+/**
+ * Write entries and read them back with every field, while the consumer is still alive.
+ * Entries not accepted by the verbosity are not written.
+ */
+TEST(FlightRecorderLogConsumerTest, write_read_entries)
+{
+    const std::string file_path = "FlightRecorderLogConsumerTest_write.ring";
+    std::remove(file_path.c_str());
+
+    FlightRecorderLogConfiguration log_configuration = test::configuration(file_path);
+    log_configuration.verbosity = VerbosityKind::Warning;
+    FlightRecorderLogConsumer consumer(&log_configuration);
+
+    const int first_line = __LINE__;
+    consumer.Consume(test::entry("first message").kind(VerbosityKind::Warning).at(test::FILE_NAME, first_line));
+    consumer.Consume(test::entry("not accepted").kind(VerbosityKind::Info));
+    consumer.Consume(test::entry("second message").kind(VerbosityKind::Error));
+
+    ASSERT_TRUE(FlightRecorderReader::is_flight_recorder_file(file_path));
+    FlightRecorderReader reader(file_path);
+
+    FlightRecorderEntry entry;
+    ASSERT_TRUE(reader.next(entry));
+    ASSERT_EQ(entry.message, "first message");
+    ASSERT_EQ(entry.kind, VerbosityKind::Warning);
+    ASSERT_EQ(entry.category, test::CATEGORY);
+    ASSERT_EQ(entry.file_name, test::FILE_NAME);
+    ASSERT_EQ(entry.line, static_cast<uint32_t>(first_line));
+    ASSERT_EQ(entry.timestamp, test::TIMESTAMP);
+
+    std::stringstream line;
+    line << entry;
+    ASSERT_EQ(line.str(),
+            "2024-01-01 00:00:00.000 [FLIGHT_RECORDER_TEST Warning] first message "
+            "(FlightRecorderLogConsumerTest.cpp:" + std::to_string(first_line) + ")");
+
+    ASSERT_TRUE(reader.next(entry));
+    ASSERT_EQ(entry.message, "second message");
+    ASSERT_EQ(entry.kind, VerbosityKind::Error);
+
+    ASSERT_FALSE(reader.next(entry));
+
+    std::remove(file_path.c_str());
+}
+
+/**
+ * Write many more entries than fit in the ring, some of them larger than the ring allows.
+ * Only the newest ones are read, in order and without gaps, and the large ones are truncated.
+ */
+TEST(FlightRecorderLogConsumerTest, overwrite_oldest)
+{
+    constexpr unsigned int N_ENTRIES = 1000;
+    const std::string file_path = "FlightRecorderLogConsumerTest_overwrite.ring";
+    std::remove(file_path.c_str());
+
+    const FlightRecorderLogConfiguration log_configuration = test::configuration(file_path, 4096);
+    FlightRecorderLogConsumer consumer(&log_configuration);
+
+    for (unsigned int i = 0; i < N_ENTRIES; ++i)
+    {
+        consumer.Consume(test::entry(std::to_string(i)));
+    }
+
+    std::vector<std::string> messages = test::read_messages(file_path);
+    ASSERT_GT(messages.size(), 10u);
+    ASSERT_LT(messages.size(), N_ENTRIES);
+    ASSERT_EQ(messages.back(), std::to_string(N_ENTRIES - 1));
+
+    const unsigned int first = N_ENTRIES - static_cast<unsigned int>(messages.size());
+    for (unsigned int i = 0; i < messages.size(); ++i)
+    {
+        ASSERT_EQ(messages[i], std::to_string(first + i));
+    }
+
+    // A message larger than a quarter of the ring is truncated
+    consumer.Consume(test::entry(std::string(4096, 'x')));
+    messages = test::read_messages(file_path);
+    ASSERT_FALSE(messages.empty());
+    ASSERT_GT(messages.back().size(), 0u);
+    ASSERT_LT(messages.back().size(), 1024u);
+    ASSERT_EQ(messages.back(), std::string(messages.back().size(), 'x'));
+
+    std::remove(file_path.c_str());
+}
+
+/**
+ * Kill a process with SIGKILL right after it logs, and read its entries from the ring file.
+ * A new consumer of the same ring writes after them.
+ */
+TEST(FlightRecorderLogConsumerTest, survive_kill)
+{
+    constexpr unsigned int N_ENTRIES = 100;
+    const std::string file_path = "FlightRecorderLogConsumerTest_kill.ring";
+    std::remove(file_path.c_str());
+
+    const FlightRecorderLogConfiguration log_configuration = test::configuration(file_path);
+
+    const pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0)
+    {
+        FlightRecorderLogConsumer consumer(&log_configuration);
+        for (unsigned int i = 0; i < N_ENTRIES; ++i)
+        {
+            consumer.Consume(test::entry(std::to_string(i)));
+        }
+        kill(getpid(), SIGKILL);
+    }
+
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    ASSERT_TRUE(WIFSIGNALED(status));
+
+    std::vector<std::string> messages = test::read_messages(file_path);
+    ASSERT_EQ(messages.size(), N_ENTRIES);
+    ASSERT_EQ(messages.back(), std::to_string(N_ENTRIES - 1));
+
+    {
+        FlightRecorderLogConsumer consumer(&log_configuration);
+        consumer.Consume(test::entry("after restart"));
+    }
+
+    messages = test::read_messages(file_path);
+    ASSERT_EQ(messages.size(), N_ENTRIES + 1);
+    ASSERT_EQ(messages.front(), "0");
+    ASSERT_EQ(messages.back(), "after restart");
+
+    std::remove(file_path.c_str());
+}
+
+/**
+ * Write entries from several threads at the same time. Every entry is read, and none is corrupted.
+ */
+TEST(FlightRecorderLogConsumerTest, write_from_threads)
+{
+    constexpr unsigned int N_THREADS = 4;
+    constexpr unsigned int N_ENTRIES = 500;
+    const std::string file_path = "FlightRecorderLogConsumerTest_threads.ring";
+    std::remove(file_path.c_str());
+
+    const FlightRecorderLogConfiguration log_configuration = test::configuration(file_path, 1024 * 1024);
+    FlightRecorderLogConsumer consumer(&log_configuration);
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < N_THREADS; ++t)
+    {
+        threads.emplace_back([&consumer, t]()
+                {
+                    for (unsigned int i = 0; i < N_ENTRIES; ++i)
+                    {
+                        consumer.Consume(test::entry("thread " + std::to_string(t) + " entry " + std::to_string(i)));
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    const std::vector<std::string> messages = test::read_messages(file_path);
+    ASSERT_EQ(messages.size(), N_THREADS * N_ENTRIES);
+    for (const std::string& message : messages)
+    {
+        ASSERT_EQ(message.compare(0, 7, "thread "), 0);
+    }
+
+    std::remove(file_path.c_str());
+}
+
+/**
+ * Corrupt the commit of a record, as if the process died while writing it.
+ * The reader skips only that record.
+ */
+TEST(FlightRecorderLogConsumerTest, uncommitted_record)
+{
+    const std::string file_path = "FlightRecorderLogConsumerTest_uncommitted.ring";
+    std::remove(file_path.c_str());
+
+    {
+        const FlightRecorderLogConfiguration log_configuration = test::configuration(file_path);
+        FlightRecorderLogConsumer consumer(&log_configuration);
+        consumer.Consume(test::entry("first"));
+        consumer.Consume(test::entry("second"));
+        consumer.Consume(test::entry("third"));
+    }
+
+    // Second record begins after the first, whose size is aligned to 8 bytes
+    const std::size_t first_size = FlightRecorderFormat::RECORD_HEADER_SIZE +
+            std::string(test::TIMESTAMP).size() + std::string(test::CATEGORY).size() +
+            std::string(test::FILE_NAME).size() + std::string("first").size();
+    {
+        std::fstream file(file_path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(FlightRecorderFormat::FILE_HEADER_SIZE +
+                FlightRecorderFormat::align(first_size)));
+        const uint64_t not_committed = 0;
+        file.write(reinterpret_cast<const char*>(&not_committed), sizeof(not_committed));
+    }
+
+    const std::vector<std::string> messages = test::read_messages(file_path);
+    ASSERT_EQ(messages, (std::vector<std::string>{"first", "third"}));
+
+    std::remove(file_path.c_str());
+}
+
+/**
+ * Measure the time to consume an entry, for entries accepted and written in the ring.
+ */
+TEST(FlightRecorderLogConsumerTest, consume_entry_time)
+{
+    constexpr unsigned int N_ENTRIES = 1000000;
+    const std::string file_path = "FlightRecorderLogConsumerTest_time.ring";
+    std::remove(file_path.c_str());
+
+    const FlightRecorderLogConfiguration log_configuration = test::configuration(file_path, 4 * 1024 * 1024);
+    FlightRecorderLogConsumer consumer(&log_configuration);
+
+    const Log::Entry entry = test::entry("Participant discovered a new endpoint in topic rt/chatter.");
+
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < N_ENTRIES; ++i)
+    {
+        consumer.Consume(entry);
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    const double ns_per_entry = elapsed.count() / N_ENTRIES;
+    RecordProperty("ns_per_entry", std::to_string(ns_per_entry));
+    std::cout << "Flight recorder entry: " << ns_per_entry << " ns" << std::endl;
+
+    std::remove(file_path.c_str());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,412 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/logging/LogStaging.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace test {
+
+/**
+ * Consumer that keeps the messages of the entries consumed.
+ *
+ * While the gate is closed, it blocks consuming the entry with message \c GATE_MESSAGE .
+ */
+class CaptureLogConsumer : public LogConsumer
+{
+public:
+
+    void Consume(
+            const Log::Entry& entry) override
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        messages.push_back(entry.message);
+
+        if (entry.message == GATE_MESSAGE)
+        {
+            gate_reached = true;
+            cv.notify_all();
+            cv.wait(lock, []()
+                    {
+                        return gate_opened;
+                    });
+        }
+    }
+
+    static constexpr const char* GATE_MESSAGE = "DEBUG: gate";
+
+    static std::mutex mutex;
+    static std::condition_variable cv;
+    static std::vector<std::string> messages;
+    static bool gate_reached;
+    static bool gate_opened;
+};
+
+constexpr const char* CaptureLogConsumer::GATE_MESSAGE;
+std::mutex CaptureLogConsumer::mutex;
+std::condition_variable CaptureLogConsumer::cv;
+std::vector<std::string> CaptureLogConsumer::messages;
+bool CaptureLogConsumer::gate_reached = false;
+bool CaptureLogConsumer::gate_opened = true;
+
+//! Messages consumed so far.
+std::vector<std::string> messages()
+{
+    std::lock_guard<std::mutex> lock(CaptureLogConsumer::mutex);
+    return CaptureLogConsumer::messages;
+}
+
+//! Close the gate, so the consumer blocks in the next gate entry.
+void close_gate()
+{
+    std::lock_guard<std::mutex> lock(CaptureLogConsumer::mutex);
+    CaptureLogConsumer::gate_reached = false;
+    CaptureLogConsumer::gate_opened = false;
+}
+
+//! Wait until the consumer is blocked in the gate entry.
+void wait_gate_reached()
+{
+    std::unique_lock<std::mutex> lock(CaptureLogConsumer::mutex);
+    CaptureLogConsumer::cv.wait(lock, []()
+            {
+                return CaptureLogConsumer::gate_reached;
+            });
+}
+
+//! Open the gate, so the consumer blocked in it goes on.
+void open_gate()
+{
+    {
+        std::lock_guard<std::mutex> lock(CaptureLogConsumer::mutex);
+        CaptureLogConsumer::gate_opened = true;
+    }
+    CaptureLogConsumer::cv.notify_all();
+}
+
+//! Register a \c CaptureLogConsumer in Fast DDS Log, with no messages yet, and accept every kind.
+void capture_log()
+{
+    {
+        std::lock_guard<std::mutex> lock(CaptureLogConsumer::mutex);
+        CaptureLogConsumer::messages.clear();
+    }
+    Log::ClearConsumers();
+    Log::RegisterConsumer(std::unique_ptr<LogConsumer>(new CaptureLogConsumer()));
+    Log::SetVerbosity(Log::Kind::Info);
+    CategoryVerbosityRegistry::get_instance().reset();
+}
+
+//! Check that every message of each thread "<thread> <index>" is in \c messages once, in the order of its thread.
+void check_thread_order(
+        const std::vector<std::string>& messages,
+        unsigned int n_threads,
+        unsigned int n_entries)
+{
+    ASSERT_EQ(messages.size(), n_threads * n_entries);
+
+    std::vector<unsigned int> next(n_threads, 0);
+    for (const std::string& message : messages)
+    {
+        const unsigned int t = std::stoul(message.substr(std::string("DEBUG: ").size()));
+        ASSERT_LT(t, n_threads);
+        ASSERT_EQ(message, "DEBUG: " + std::to_string(t) + " " + std::to_string(next[t]));
+        next[t]++;
+    }
+}
+
+} /* namespace test */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils;
+
+/**
+ * While staging is not started, entries are passed to Fast DDS Log from the thread that logs them.
+ */
+TEST(LogStagingTest, not_started)
+{
+    test::capture_log();
+    ASSERT_FALSE(LogStaging::enabled());
+
+    logDebug(LOG_STAGING_TEST, "Not staged");
+    logDevError(LOG_STAGING_TEST, "Not staged either");
+    Log::Flush();
+
+    ASSERT_EQ(test::messages(), std::vector<std::string>({"DEBUG: Not staged", "DEV_WARNING: Not staged either"}));
+
+    Log::ClearConsumers();
+}
+
+/**
+ * Log entries from several threads, that are staged and passed to Fast DDS Log by the collector thread.
+ * Every entry is passed once, in the order of its thread.
+ */
+TEST(LogStagingTest, staged_flush)
+{
+    constexpr unsigned int N_THREADS = 4;
+    constexpr unsigned int N_ENTRIES = 2000;
+
+    test::capture_log();
+    LogStaging::start(N_ENTRIES);
+    ASSERT_TRUE(LogStaging::enabled());
+    const uint64_t overflow = LogStaging::overflow_entries();
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < N_THREADS; ++t)
+    {
+        threads.emplace_back([t]()
+                {
+                    for (unsigned int i = 0; i < N_ENTRIES; ++i)
+                    {
+                        logDebug(LOG_STAGING_TEST, t << " " << i);
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    LogStaging::flush();
+
+    test::check_thread_order(test::messages(), N_THREADS, N_ENTRIES);
+    ASSERT_EQ(LogStaging::overflow_entries(), overflow);
+
+    LogStaging::stop();
+    ASSERT_FALSE(LogStaging::enabled());
+    Log::ClearConsumers();
+}
+
+/**
+ * Entries of different threads staged while the collector thread is busy are passed in the order they were logged.
+ * Entries staged right before stopping are not lost.
+ */
+TEST(LogStagingTest, timestamp_order)
+{
+    constexpr unsigned int N_ENTRIES = 20;
+
+    test::capture_log();
+    LogStaging::start();
+
+    // The collector thread is blocked passing the gate entry
+    test::close_gate();
+    logDebug(LOG_STAGING_TEST, "gate");
+    test::wait_gate_reached();
+
+    // Two threads log by turns
+    std::mutex mutex;
+    std::condition_variable cv;
+    unsigned int turn = 0;
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < 2; ++t)
+    {
+        threads.emplace_back([t, &mutex, &cv, &turn]()
+                {
+                    for (unsigned int i = t; i < N_ENTRIES; i += 2)
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        cv.wait(lock, [i, &turn]()
+                        {
+                            return turn == i;
+                        });
+                        logDebug(LOG_STAGING_TEST, i);
+                        turn++;
+                        cv.notify_all();
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    test::open_gate();
+    LogStaging::stop();
+
+    const std::vector<std::string> messages = test::messages();
+    ASSERT_EQ(messages.size(), N_ENTRIES + 1);
+    for (unsigned int i = 0; i < N_ENTRIES; ++i)
+    {
+        ASSERT_EQ(messages[i + 1], "DEBUG: " + std::to_string(i));
+    }
+
+    Log::ClearConsumers();
+}
+
+/**
+ * Entries that do not fit in the buffer of their thread are passed to Fast DDS Log from the thread,
+ * after the entries staged before them, so no entry is lost and they keep their order.
+ */
+TEST(LogStagingTest, buffer_full_overflow)
+{
+    constexpr std::size_t BUFFER_SIZE = 4;
+    constexpr unsigned int N_ENTRIES = 10;
+
+    test::capture_log();
+    LogStaging::start(BUFFER_SIZE);
+    const uint64_t overflow = LogStaging::overflow_entries();
+
+    test::close_gate();
+    logDebug(LOG_STAGING_TEST, "gate");
+    test::wait_gate_reached();
+
+    // The buffer is created with the size of the last start, so a new thread is used
+    std::atomic<unsigned int> logged(0);
+    std::thread thread([&logged]()
+            {
+                for (unsigned int i = 0; i < N_ENTRIES; ++i)
+                {
+                    logDebug(LOG_STAGING_TEST, "0 " << i);
+                    logged++;
+                }
+            });
+
+    // The collector thread is blocked passing the first entry, so the buffer is full once it has BUFFER_SIZE
+    // entries, and the next one waits for them to be passed
+    while (logged.load() < BUFFER_SIZE)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    test::open_gate();
+    thread.join();
+    LogStaging::flush();
+
+    ASSERT_GE(LogStaging::overflow_entries(), overflow + 1);
+    ASSERT_LE(LogStaging::overflow_entries(), overflow + N_ENTRIES - BUFFER_SIZE);
+
+    std::vector<std::string> messages = test::messages();
+    ASSERT_EQ(messages.front(), test::CaptureLogConsumer::GATE_MESSAGE);
+    messages.erase(messages.begin());
+    test::check_thread_order(messages, 1, N_ENTRIES);
+
+    LogStaging::stop();
+    Log::ClearConsumers();
+}
+
+/**
+ * Flush from several threads while others log. Each flush waits for the entries of its thread.
+ */
+TEST(LogStagingTest, flush_from_threads)
+{
+    constexpr unsigned int N_THREADS = 4;
+    constexpr unsigned int N_ENTRIES = 200;
+
+    test::capture_log();
+    LogStaging::start();
+
+    std::atomic<unsigned int> failures(0);
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < N_THREADS; ++t)
+    {
+        threads.emplace_back([t, &failures]()
+                {
+                    for (unsigned int i = 0; i < N_ENTRIES; ++i)
+                    {
+                        logDebug(LOG_STAGING_TEST, t << " " << i);
+                        if (i % 50 == 49)
+                        {
+                            LogStaging::flush();
+                            const std::string expected = "DEBUG: " + std::to_string(t) + " " + std::to_string(i);
+                            const std::vector<std::string> messages = test::messages();
+                            if (std::find(messages.begin(), messages.end(), expected) == messages.end())
+                            {
+                                failures++;
+                            }
+                        }
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    LogStaging::flush();
+
+    ASSERT_EQ(failures.load(), 0u);
+    test::check_thread_order(test::messages(), N_THREADS, N_ENTRIES);
+
+    LogStaging::stop();
+    Log::ClearConsumers();
+}
+
+/**
+ * Measure the time per entry logged from several threads at once, passing it to Fast DDS Log from each thread
+ * and staging it. It is reported as a property of the test, and printed.
+ */
+TEST(LogStagingTest, contention_rate)
+{
+    constexpr unsigned int N_THREADS = 4;
+    constexpr unsigned int N_ENTRIES = 20000;
+
+    test::capture_log();
+    Log::ClearConsumers();
+
+    auto log_from_threads = []()
+            {
+                std::vector<std::thread> threads;
+                const auto start = std::chrono::steady_clock::now();
+                for (unsigned int t = 0; t < N_THREADS; ++t)
+                {
+                    threads.emplace_back([t]()
+                            {
+                                for (unsigned int i = 0; i < N_ENTRIES; ++i)
+                                {
+                                    logDebug(LOG_STAGING_TEST, "Reader " << t << " lost sample " << i);
+                                }
+                            });
+                }
+                for (std::thread& thread : threads)
+                {
+                    thread.join();
+                }
+                const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+                return elapsed.count() / (N_THREADS * N_ENTRIES);
+            };
+
+    const double ns_direct = log_from_threads();
+
+    LogStaging::start(N_ENTRIES);
+    const double ns_staged = log_from_threads();
+    LogStaging::stop();
+
+    RecordProperty("ns_per_entry_direct", std::to_string(ns_direct));
+    RecordProperty("ns_per_entry_staged", std::to_string(ns_staged));
+    std::cout << "Entry passed to Fast DDS Log from its thread: " << ns_direct << " ns" << std::endl;
+    std::cout << "Entry staged in the buffer of its thread: " << ns_staged << " ns" << std::endl;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,374 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <cpp_utils/testing/LogEntryBuilder.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/logging/RateLimitLogConsumer.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace test {
+
+//! Consumer that keeps the messages of the entries consumed.
+class CaptureLogConsumer : public LogConsumer
+{
+public:
+
+    CaptureLogConsumer(
+            std::vector<std::string>& messages,
+            std::mutex& mutex)
+        : messages_(messages)
+        , mutex_(mutex)
+    {
+    }
+
+    void Consume(
+            const Log::Entry& entry) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        messages_.push_back(entry.message);
+    }
+
+protected:
+
+    std::vector<std::string>& messages_;
+
+    std::mutex& mutex_;
+};
+
+//! Consumer that only counts the entries consumed.
+class CountLogConsumer : public LogConsumer
+{
+public:
+
+    CountLogConsumer(
+            std::atomic<uint64_t>& count)
+        : count_(count)
+    {
+    }
+
+    void Consume(
+            const Log::Entry& /* entry */) override
+    {
+        count_++;
+    }
+
+protected:
+
+    std::atomic<uint64_t>& count_;
+};
+
+//! Create a configuration with \c entries_per_second and \c burst .
+RateLimitLogConfiguration configuration(
+        double entries_per_second,
+        uint32_t burst,
+        bool suppress_duplicates = true)
+{
+    RateLimitLogConfiguration rate_configuration;
+    rate_configuration.entries_per_second = entries_per_second;
+    rate_configuration.burst = burst;
+    rate_configuration.suppress_duplicates = suppress_duplicates;
+    return rate_configuration;
+}
+
+} /* namespace test */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils;
+using eprosima::utils::testing::LogEntryBuilder;
+
+/**
+ * Consumers with invalid configurations, or without a consumer to pass entries on to, cannot be created.
+ *
+ * CASES:
+ * - Rate 0
+ * - Burst 0
+ * - Table size not a power of 2
+ * - Null consumer
+ */
+TEST(RateLimitLogConsumerTest, invalid_configuration)
+{
+    std::vector<std::string> messages;
+    std::mutex mutex;
+
+    ASSERT_THROW(
+        RateLimitLogConsumer(std::make_unique<test::CaptureLogConsumer>(messages, mutex), test::configuration(0, 10)),
+        InitializationException);
+
+    ASSERT_THROW(
+        RateLimitLogConsumer(std::make_unique<test::CaptureLogConsumer>(messages, mutex), test::configuration(10, 0)),
+        InitializationException);
+
+    RateLimitLogConfiguration rate_configuration;
+    rate_configuration.table_size = 1000;
+    ASSERT_THROW(
+        RateLimitLogConsumer(std::make_unique<test::CaptureLogConsumer>(messages, mutex), rate_configuration),
+        InitializationException);
+
+    ASSERT_THROW(RateLimitLogConsumer(nullptr), InitializationException);
+}
+
+/**
+ * Consecutive entries with the same message are passed on once, and counted in an entry before the next message.
+ */
+TEST(RateLimitLogConsumerTest, collapse_duplicates)
+{
+    std::vector<std::string> messages;
+    std::mutex mutex;
+    RateLimitLogConsumer consumer(
+        std::make_unique<test::CaptureLogConsumer>(messages, mutex), test::configuration(10, 1000));
+
+    // Line of the call site of every entry
+    const int site = __LINE__;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        consumer.Consume(LogEntryBuilder("Connection lost.").at(__FILE__, site));
+    }
+    ASSERT_EQ(messages, std::vector<std::string>({"Connection lost."}));
+    ASSERT_EQ(consumer.suppressed_entries(), 9u);
+
+    consumer.Consume(LogEntryBuilder("Connection restored.").at(__FILE__, site));
+    ASSERT_EQ(messages, std::vector<std::string>({
+        "Connection lost.",
+        "Previous message repeated 9 times.",
+        "Connection restored."}));
+
+    // Without duplicates suppressed, every entry is passed on
+    messages.clear();
+    RateLimitLogConsumer keep_duplicates_consumer(
+        std::make_unique<test::CaptureLogConsumer>(messages, mutex), test::configuration(1000, 1000, false));
+    for (int i = 0; i < 10; ++i)
+    {
+        keep_duplicates_consumer.Consume(LogEntryBuilder("Connection lost.").at(__FILE__, site));
+    }
+    ASSERT_EQ(messages.size(), 10u);
+}
+
+/**
+ * A repeated message is held back only for the time between two entries, and then it is passed on again,
+ * after the count of the repeats held back.
+ */
+TEST(RateLimitLogConsumerTest, duplicates_window)
+{
+    std::vector<std::string> messages;
+    std::mutex mutex;
+    RateLimitLogConsumer consumer(
+        std::make_unique<test::CaptureLogConsumer>(messages, mutex), test::configuration(10, 5));
+
+    const int site = __LINE__;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        consumer.Consume(LogEntryBuilder("Connection lost.").at(__FILE__, site));
+    }
+    ASSERT_EQ(messages, std::vector<std::string>({"Connection lost."}));
+
+    // An entry every 100 ms
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    consumer.Consume(LogEntryBuilder("Connection lost.").at(__FILE__, site));
+    ASSERT_EQ(messages, std::vector<std::string>({
+        "Connection lost.",
+        "Previous message repeated 9 times.",
+        "Connection lost."}));
+    ASSERT_EQ(consumer.suppressed_entries(), 9u);
+}
+
+/**
+ * A call site passes on its burst at once, the rest is held back until its rate gives it a token,
+ * and then the entries held back are counted.
+ */
+TEST(RateLimitLogConsumerTest, rate_limit_burst)
+{
+    constexpr uint32_t BURST = 5;
+    constexpr uint32_t N_ENTRIES = 20;
+
+    std::vector<std::string> messages;
+    std::mutex mutex;
+    RateLimitLogConsumer consumer(
+        std::make_unique<test::CaptureLogConsumer>(messages, mutex), test::configuration(10, BURST));
+
+    const int site = __LINE__;
+
+    for (uint32_t i = 0; i < N_ENTRIES; ++i)
+    {
+        consumer.Consume(LogEntryBuilder("Sample " + std::to_string(i) + " lost.").at(__FILE__, site));
+    }
+    ASSERT_EQ(messages.size(), BURST);
+    ASSERT_EQ(consumer.suppressed_entries(), N_ENTRIES - BURST);
+
+    // A token every 100 ms
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    consumer.Consume(LogEntryBuilder("Sample lost.").at(__FILE__, site));
+    ASSERT_EQ(messages.size(), BURST + 2);
+    ASSERT_EQ(messages[BURST], std::to_string(N_ENTRIES - BURST) + " messages held back by the rate limit.");
+    ASSERT_EQ(messages[BURST + 1], "Sample lost.");
+}
+
+/**
+ * Each call site has its own tokens and last message, and call sites that do not fit in the table
+ * are not limited.
+ */
+TEST(RateLimitLogConsumerTest, call_sites)
+{
+    std::vector<std::string> messages;
+    std::mutex mutex;
+
+    {
+        RateLimitLogConsumer consumer(
+            std::make_unique<test::CaptureLogConsumer>(messages, mutex), test::configuration(0.001, 1));
+
+        // Lines of the two call sites, each used by several entries
+        const int first_site = __LINE__;
+        const int second_site = __LINE__;
+
+        consumer.Consume(LogEntryBuilder("First site.").at(__FILE__, first_site));
+        consumer.Consume(LogEntryBuilder("First site again.").at(__FILE__, first_site));
+        consumer.Consume(LogEntryBuilder("Second site.").at(__FILE__, second_site));
+        ASSERT_EQ(messages, std::vector<std::string>({"First site.", "Second site."}));
+    }
+
+    {
+        messages.clear();
+        RateLimitLogConfiguration rate_configuration = test::configuration(0.001, 1);
+        rate_configuration.table_size = 1;
+        RateLimitLogConsumer consumer(std::make_unique<test::CaptureLogConsumer>(messages, mutex), rate_configuration);
+
+        const int first_site = __LINE__;
+        const int second_site = __LINE__;
+
+        consumer.Consume(LogEntryBuilder("First site.").at(__FILE__, first_site));
+        consumer.Consume(LogEntryBuilder("First site again.").at(__FILE__, first_site));
+        for (int i = 0; i < 5; ++i)
+        {
+            consumer.Consume(LogEntryBuilder("Second site.").at(__FILE__, second_site));
+        }
+        ASSERT_EQ(messages.size(), 6u);
+        ASSERT_EQ(consumer.suppressed_entries(), 1u);
+    }
+}
+
+/**
+ * Consume entries of the same call site from several threads.
+ * Each entry is either passed on or held back, and no more than the burst is passed on.
+ * Entries reporting the entries held back may be passed on too, by threads that took a token.
+ */
+TEST(RateLimitLogConsumerTest, concurrent_consume)
+{
+    constexpr uint32_t N_THREADS = 8;
+    constexpr uint32_t N_ENTRIES = 10000;
+    constexpr uint32_t BURST = 100;
+
+    std::vector<std::string> messages;
+    std::mutex mutex;
+    RateLimitLogConsumer consumer(
+        std::make_unique<test::CaptureLogConsumer>(messages, mutex), test::configuration(0.001, BURST, false));
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < N_THREADS; ++t)
+    {
+        threads.emplace_back(
+            [&consumer, t]()
+            {
+                for (uint32_t i = 0; i < N_ENTRIES; ++i)
+                {
+                    consumer.Consume(LogEntryBuilder("Thread " + std::to_string(t)).at(__FILE__, __LINE__));
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    const uint64_t passed = std::count_if(messages.begin(), messages.end(),
+                    [](const std::string& message)
+                    {
+                        return message.compare(0, 7, "Thread ") == 0;
+                    });
+    ASSERT_EQ(passed, BURST);
+    ASSERT_EQ(passed + consumer.suppressed_entries(), N_THREADS * N_ENTRIES);
+}
+
+/**
+ * Measure the entries per second consumed when a call site floods the log, both with the same message
+ * and with different messages held back by the rate limit.
+ * It is reported as a property of the test, and printed, so it can be compared with a plain consumer.
+ */
+TEST(RateLimitLogConsumerTest, consume_entries_rate)
+{
+    constexpr unsigned int N_ENTRIES = 200000;
+
+    struct Case
+    {
+        const char* name;
+        bool different_messages;
+    };
+
+    const Case cases[] = {
+        {"duplicates", false},
+        {"rate_limited", true},
+    };
+
+    std::vector<Log::Entry> entries;
+    for (unsigned int i = 0; i < 16; ++i)
+    {
+        entries.push_back(LogEntryBuilder("Sample " + std::to_string(i) + " of the reader lost.").at(__FILE__,
+                __LINE__));
+    }
+
+    for (const Case& test_case : cases)
+    {
+        std::atomic<uint64_t> passed(0);
+        RateLimitLogConsumer consumer(std::make_unique<test::CountLogConsumer>(passed));
+
+        const auto start = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < N_ENTRIES; ++i)
+        {
+            consumer.Consume(entries[test_case.different_messages ? i % entries.size() : 0]);
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        ASSERT_LT(passed.load(), N_ENTRIES / 10);
+
+        const double entries_per_second = N_ENTRIES / std::max(elapsed.count(), 1e-9);
+        RecordProperty(std::string("entries_per_second_") + test_case.name, static_cast<int>(entries_per_second));
+        std::cout << "RateLimitLogConsumer " << test_case.name << ": "
+                  << static_cast<uint64_t>(entries_per_second) << " entries/s" << std::endl;
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
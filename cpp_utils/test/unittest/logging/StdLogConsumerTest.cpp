@@ -0,0 +1,239 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <regex>
+#include <streambuf>
+#include <string>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <cpp_utils/testing/LogEntryBuilder.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/logging/StdLogConsumer.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace test {
+
+//! StdLogConsumer that gives access to its filter.
+class TestLogConsumer : public StdLogConsumer
+{
+public:
+
+    using StdLogConsumer::StdLogConsumer;
+    using StdLogConsumer::accept_entry_;
+};
+
+//! Stream buffer that discards everything written, to measure the consumer and not the terminal.
+class NullBuffer : public std::streambuf
+{
+protected:
+
+    int overflow(
+            int c) override
+    {
+        return c;
+    }
+
+    std::streamsize xsputn(
+            const char* /* s */,
+            std::streamsize n) override
+    {
+        return n;
+    }
+
+};
+
+//! Create a configuration with \c verbosity and the same \c filter for every kind.
+BaseLogConfiguration configuration(
+        VerbosityKind verbosity,
+        const std::string& filter)
+{
+    BaseLogConfiguration log_configuration;
+    log_configuration.verbosity = verbosity;
+    log_configuration.filter[VerbosityKind::Info] = filter;
+    log_configuration.filter[VerbosityKind::Warning] = filter;
+    log_configuration.filter[VerbosityKind::Error] = filter;
+    return log_configuration;
+}
+
+} /* namespace test */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils;
+using eprosima::utils::testing::LogEntryBuilder;
+
+/**
+ * Entries with a kind higher than the verbosity are rejected, whatever their content.
+ */
+TEST(StdLogConsumerTest, filter_verbosity)
+{
+    const BaseLogConfiguration log_configuration = test::configuration(VerbosityKind::Warning, "");
+    test::TestLogConsumer consumer(&log_configuration);
+
+    ASSERT_TRUE(consumer.accept_entry_(LogEntryBuilder("message").kind(VerbosityKind::Error).category("CATEGORY")));
+    ASSERT_TRUE(consumer.accept_entry_(LogEntryBuilder("message").kind(VerbosityKind::Warning).category("CATEGORY")));
+    ASSERT_FALSE(consumer.accept_entry_(LogEntryBuilder("message").category("CATEGORY")));
+}
+
+/**
+ * The default empty filter accepts every entry.
+ */
+TEST(StdLogConsumerTest, filter_empty)
+{
+    const BaseLogConfiguration log_configuration = test::configuration(VerbosityKind::Info, "");
+    test::TestLogConsumer consumer(&log_configuration);
+
+    ASSERT_TRUE(consumer.accept_entry_(LogEntryBuilder("message").category("CATEGORY")));
+    ASSERT_TRUE(consumer.accept_entry_(LogEntryBuilder("").category("")));
+}
+
+/**
+ * A filter without regex metacharacters accepts entries whose category or message contain it.
+ */
+TEST(StdLogConsumerTest, filter_substring)
+{
+    const BaseLogConfiguration log_configuration = test::configuration(VerbosityKind::Info, "DDSPIPE");
+    test::TestLogConsumer consumer(&log_configuration);
+
+    ASSERT_TRUE(consumer.accept_entry_(LogEntryBuilder("message").category("DDSPIPE")));
+    ASSERT_TRUE(consumer.accept_entry_(LogEntryBuilder("message").category("DDSPIPE_PARTICIPANT")));
+    ASSERT_TRUE(consumer.accept_entry_(LogEntryBuilder("from DDSPIPE").category("CATEGORY")));
+    ASSERT_FALSE(consumer.accept_entry_(LogEntryBuilder("message").category("DDS_PIPE")));
+    ASSERT_FALSE(consumer.accept_entry_(LogEntryBuilder("message").category("ddspipe")));
+}
+
+/**
+ * A filter with regex metacharacters is matched as a regex against the category and the message.
+ */
+TEST(StdLogConsumerTest, filter_regex)
+{
+    const BaseLogConfiguration log_configuration = test::configuration(VerbosityKind::Info, "^DDS(PIPE|ROUTER)$");
+    test::TestLogConsumer consumer(&log_configuration);
+
+    ASSERT_TRUE(consumer.accept_entry_(LogEntryBuilder("message").category("DDSPIPE")));
+    ASSERT_TRUE(consumer.accept_entry_(LogEntryBuilder("message").category("DDSROUTER")));
+    ASSERT_TRUE(consumer.accept_entry_(LogEntryBuilder("DDSPIPE").category("CATEGORY")));
+    ASSERT_FALSE(consumer.accept_entry_(LogEntryBuilder("message").category("DDSPIPE_PARTICIPANT")));
+    ASSERT_FALSE(consumer.accept_entry_(LogEntryBuilder("^DDS(PIPE|ROUTER)$").category("CATEGORY")));
+}
+
+/**
+ * An invalid regex is reported when the filter is compiled, and not when entries are consumed.
+ */
+TEST(StdLogConsumerTest, filter_invalid_regex)
+{
+    const BaseLogConfiguration log_configuration = test::configuration(VerbosityKind::Info, "(DDSPIPE");
+    ASSERT_THROW(test::TestLogConsumer consumer(&log_configuration), std::regex_error);
+
+    const BaseLogConfiguration valid_configuration = test::configuration(VerbosityKind::Info, "DDSPIPE");
+    test::TestLogConsumer consumer(&valid_configuration);
+    ASSERT_THROW(consumer.set_filter(log_configuration.filter), std::regex_error);
+
+    // The filter has not changed
+    ASSERT_TRUE(consumer.accept_entry_(LogEntryBuilder("message").category("DDSPIPE")));
+    ASSERT_FALSE(consumer.accept_entry_(LogEntryBuilder("message").category("CATEGORY")));
+}
+
+/**
+ * Replace the filter of a consumer, with a different filter per kind.
+ */
+TEST(StdLogConsumerTest, set_filter)
+{
+    const BaseLogConfiguration log_configuration = test::configuration(VerbosityKind::Info, "");
+    test::TestLogConsumer consumer(&log_configuration);
+
+    LogFilter filter;
+    filter[VerbosityKind::Info] = std::string("DDSPIPE");
+    filter[VerbosityKind::Warning] = std::string("DDS.*");
+    filter[VerbosityKind::Error] = std::string("");
+    consumer.set_filter(filter);
+
+    ASSERT_TRUE(consumer.accept_entry_(LogEntryBuilder("message").category("DDSPIPE")));
+    ASSERT_FALSE(consumer.accept_entry_(LogEntryBuilder("message").category("DDSROUTER")));
+    ASSERT_TRUE(consumer.accept_entry_(LogEntryBuilder("message").kind(VerbosityKind::Warning).category("DDSROUTER")));
+    ASSERT_FALSE(consumer.accept_entry_(LogEntryBuilder("message").kind(VerbosityKind::Warning).category("CATEGORY")));
+    ASSERT_TRUE(consumer.accept_entry_(LogEntryBuilder("message").kind(VerbosityKind::Error).category("CATEGORY")));
+}
+
+/**
+ * Measure the entries consumed per second by a \c StdLogConsumer , writing to a stream that discards them.
+ *
+ * CASES:
+ * - Entries rejected by verbosity
+ * - Entries accepted by the default empty filter
+ * - Entries matched with a substring filter
+ * - Entries matched with a regex filter
+ */
+TEST(StdLogConsumerTest, consume_entries_rate)
+{
+    constexpr unsigned int N_ENTRIES = 20000;
+
+    struct Case
+    {
+        const char* name;
+        VerbosityKind verbosity;
+        const char* filter;
+    };
+
+    const Case cases[] = {
+        {"verbosity", VerbosityKind::Error, ""},
+        {"empty", VerbosityKind::Info, ""},
+        {"substring", VerbosityKind::Info, "DDSPIPE"},
+        {"regex", VerbosityKind::Info, "DDS(PIPE|ROUTER)"},
+    };
+
+    const Log::Entry entry = LogEntryBuilder("Participant discovered a new endpoint.")
+                    .kind(VerbosityKind::Warning)
+                    .category("DDSPIPE_PARTICIPANT");
+
+    test::NullBuffer null_buffer;
+
+    for (const Case& test_case : cases)
+    {
+        const BaseLogConfiguration log_configuration = test::configuration(test_case.verbosity, test_case.filter);
+        StdLogConsumer consumer(&log_configuration);
+
+        std::streambuf* cout_buffer = std::cout.rdbuf(&null_buffer);
+        std::streambuf* cerr_buffer = std::cerr.rdbuf(&null_buffer);
+
+        const auto start = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < N_ENTRIES; ++i)
+        {
+            consumer.Consume(entry);
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout.rdbuf(cout_buffer);
+        std::cerr.rdbuf(cerr_buffer);
+
+        const double entries_per_second = N_ENTRIES / std::max(elapsed.count(), 1e-9);
+        RecordProperty(std::string("entries_per_second_") + test_case.name, static_cast<int>(entries_per_second));
+        std::cout << "StdLogConsumer " << test_case.name << " filter: "
+                  << static_cast<uint64_t>(entries_per_second) << " entries/s" << std::endl;
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
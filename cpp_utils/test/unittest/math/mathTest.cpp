@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <string>
 
 #include <gtest_aux.hpp>
 #include <gtest/gtest.h>
@@ -209,6 +210,44 @@ TEST(mathTest, fast_exponential)
     }
 }
 
+/**
+ * Test \c hash_64 method
+ *
+ * CASES:
+ * - Reference values of XXH64, with inputs shorter and longer than a stripe of 32 bytes
+ * - Seed changes the result
+ * - Every byte affects the result
+ */
+TEST(mathTest, hash_64)
+{
+    // Reference values
+    {
+        ASSERT_EQ(hash_64(nullptr, 0), 0xEF46DB3751D8E999ULL);
+        ASSERT_EQ(hash_64("a", 1), 0xD24EC4F1A98C6E5BULL);
+        ASSERT_EQ(hash_64("abc", 3), 0x44BC2CF5AD770999ULL);
+
+        const std::string text = "Nobody inspects the spammish repetition";
+        ASSERT_EQ(hash_64(text.c_str(), text.size()), 0xFBCEA83C8A378BF1ULL);
+    }
+
+    // Seed
+    {
+        ASSERT_NE(hash_64("abc", 3, 1), hash_64("abc", 3));
+    }
+
+    // Every byte
+    {
+        std::string data(test::NUMBERS_TO_TEST_SHORT, 'x');
+        const uint64_t hash = hash_64(data.c_str(), data.size());
+        for (std::size_t i = 0; i < data.size(); ++i)
+        {
+            std::string changed = data;
+            changed[i] = 'y';
+            ASSERT_NE(hash_64(changed.c_str(), changed.size()), hash) << i;
+        }
+    }
+}
+
 int main(
         int argc,
         char** argv)
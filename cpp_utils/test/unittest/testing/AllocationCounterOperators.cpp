@@ -0,0 +1,80 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AllocationCounterOperators.cpp
+ *
+ * Replacement of the global allocation operators for the test executables that use \c AllocationCounter .
+ * It must be added to the sources of the test executable, never to a library.
+ */
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include <cpp_utils/testing/AllocationCounter.hpp>
+
+namespace {
+
+void* counted_allocation(
+        std::size_t size)
+{
+    eprosima::utils::testing::thread_allocations()++;
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+} /* namespace */
+
+void* operator new(
+        std::size_t size)
+{
+    return counted_allocation(size);
+}
+
+void* operator new[](
+        std::size_t size)
+{
+    return counted_allocation(size);
+}
+
+void operator delete(
+        void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](
+        void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(
+        void* ptr,
+        std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](
+        void* ptr,
+        std::size_t) noexcept
+{
+    std::free(ptr);
+}
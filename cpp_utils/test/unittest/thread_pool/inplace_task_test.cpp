@@ -0,0 +1,185 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+
+#include <cpp_utils/testing/AllocationCounter.hpp>
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/thread_pool/task/Task.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace test {
+
+//! Callable that counts how many instances are alive.
+struct InstanceCounter
+{
+    InstanceCounter(
+            std::shared_ptr<std::atomic<int>> alive)
+        : alive(alive)
+    {
+        (*alive)++;
+    }
+
+    InstanceCounter(
+            const InstanceCounter& other)
+        : alive(other.alive)
+    {
+        (*alive)++;
+    }
+
+    InstanceCounter(
+            InstanceCounter&& other) noexcept
+        : alive(other.alive)
+    {
+        (*alive)++;
+    }
+
+    ~InstanceCounter()
+    {
+        (*alive)--;
+    }
+
+    void operator ()()
+    {
+    }
+
+    std::shared_ptr<std::atomic<int>> alive;
+};
+
+} /* namespace test */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils;
+
+/**
+ * Create, move and call tasks with captures up to the inline capacity, and check nothing is allocated.
+ */
+TEST(inplace_task_test, no_allocation)
+{
+    int value = 0;
+    std::array<char, TASK_INLINE_CAPACITY - sizeof(int*)> padding{};
+
+    eprosima::utils::testing::AllocationCounter counter;
+    {
+        Task task(
+            [&value, padding]()
+            {
+                value += 1 + padding[0];
+            });
+        task();
+
+        Task moved(std::move(task));
+        moved();
+
+        Task assigned;
+        assigned = std::move(moved);
+        assigned();
+
+        ASSERT_FALSE(task);
+        ASSERT_FALSE(moved);
+        ASSERT_TRUE(assigned);
+    }
+    ASSERT_EQ(counter.count(), 0u);
+    ASSERT_EQ(value, 3);
+
+    // The same callable stored in a std::function allocates
+    {
+        eprosima::utils::testing::AllocationCounter function_counter;
+        std::function<void()> function(
+            [&value, padding]()
+            {
+                value += 1 + padding[0];
+            });
+        function();
+        ASSERT_GT(function_counter.count(), 0u);
+    }
+}
+
+/**
+ * Store a callable bigger than the inline capacity with the explicit fallback, and check it allocates once.
+ */
+TEST(inplace_task_test, allocated_fallback)
+{
+    int value = 0;
+    std::array<char, 4 * TASK_INLINE_CAPACITY> big_capture{};
+    big_capture[0] = 1;
+
+    eprosima::utils::testing::AllocationCounter counter;
+    {
+        Task task(make_allocated_task(
+                    [&value, big_capture]()
+                    {
+                        value += big_capture[0];
+                    }));
+        Task moved(std::move(task));
+        moved();
+    }
+    ASSERT_EQ(counter.count(), 1u);
+    ASSERT_EQ(value, 1);
+}
+
+/**
+ * Check move-only callables are accepted and every callable constructed is destroyed.
+ */
+TEST(inplace_task_test, ownership)
+{
+    // Move-only capture
+    std::unique_ptr<int> pointer(new int(5));
+    int result = 0;
+    Task task(
+        [pointer = std::move(pointer), &result]()
+        {
+            result = *pointer;
+        });
+    task();
+    ASSERT_EQ(result, 5);
+
+    // Every instance is destroyed
+    auto alive = std::make_shared<std::atomic<int>>(0);
+    {
+        Task counted{test::InstanceCounter(alive)};
+        ASSERT_EQ(alive->load(), 1);
+
+        Task moved(std::move(counted));
+        ASSERT_EQ(alive->load(), 1);
+
+        moved = nullptr;
+        ASSERT_EQ(alive->load(), 0);
+
+        moved = Task(test::InstanceCounter(alive));
+        ASSERT_EQ(alive->load(), 1);
+    }
+    ASSERT_EQ(alive->load(), 0);
+
+    // Empty task
+    Task empty;
+    ASSERT_FALSE(empty);
+    ASSERT_THROW(empty(), std::bad_function_call);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
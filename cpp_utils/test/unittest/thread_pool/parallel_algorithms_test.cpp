@@ -0,0 +1,336 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/thread_pool/parallel/parallel_algorithms.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace test {
+
+constexpr const unsigned int N_THREADS_IN_TEST = 4;
+constexpr const std::size_t N_ELEMENTS_IN_TEST = 100000;
+
+} /* namespace test */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils;
+
+/**
+ * Execute parallel_for with different grains and check every index is visited exactly once.
+ */
+TEST(parallel_algorithms_test, parallel_for_each_index_once)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    thread_pool.enable();
+    ParallelExecutor executor(thread_pool);
+
+    for (std::size_t grain : {0, 1, 7, 1000, 1000000})
+    {
+        std::vector<std::atomic<unsigned int>> visits(test::N_ELEMENTS_IN_TEST);
+
+        parallel_for(
+            executor,
+            0,
+            test::N_ELEMENTS_IN_TEST,
+            grain,
+            [&visits](std::size_t i)
+            {
+                visits[i]++;
+            });
+
+        for (const auto& visit : visits)
+        {
+            ASSERT_EQ(visit.load(), 1u);
+        }
+    }
+}
+
+/**
+ * Check that pool threads take part in the execution along with the calling thread.
+ */
+TEST(parallel_algorithms_test, parallel_for_uses_pool_threads)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    thread_pool.enable();
+    ParallelExecutor executor(thread_pool);
+
+    std::mutex threads_mutex;
+    std::set<std::thread::id> threads;
+
+    parallel_for(
+        executor,
+        0,
+        test::N_THREADS_IN_TEST * 4,
+        1,
+        [&](std::size_t)
+        {
+            {
+                std::lock_guard<std::mutex> lock(threads_mutex);
+                threads.insert(std::this_thread::get_id());
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        });
+
+    ASSERT_GT(threads.size(), 1u);
+    ASSERT_LE(threads.size(), test::N_THREADS_IN_TEST + 1);
+}
+
+/**
+ * Check that the calling thread executes the whole job if the pool is not running.
+ */
+TEST(parallel_algorithms_test, parallel_for_disabled_pool)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    ParallelExecutor executor(thread_pool);
+
+    std::size_t sum = 0;
+    parallel_for(
+        executor,
+        0,
+        100,
+        3,
+        [&sum](std::size_t i)
+        {
+            // Only the calling thread executes, so no synchronization is needed
+            sum += i;
+        });
+
+    ASSERT_EQ(sum, 4950u);
+}
+
+/**
+ * Check that an exception thrown in a chunk is rethrown in the calling thread.
+ */
+TEST(parallel_algorithms_test, parallel_for_exception)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    thread_pool.enable();
+    ParallelExecutor executor(thread_pool);
+
+    ASSERT_THROW(
+        parallel_for(
+            executor,
+            0,
+            test::N_ELEMENTS_IN_TEST,
+            10,
+            [](std::size_t i)
+            {
+                if (i == test::N_ELEMENTS_IN_TEST / 2)
+                {
+                    throw std::runtime_error("chunk error");
+                }
+            }),
+        std::runtime_error);
+
+    // Executor is still usable after an exception
+    std::atomic<std::size_t> count(0);
+    parallel_for(
+        executor,
+        0,
+        1000,
+        10,
+        [&count](std::size_t)
+        {
+            count++;
+        });
+    ASSERT_EQ(count.load(), 1000u);
+}
+
+/**
+ * Nested parallel calls inside chunks must not deadlock, even if every pool thread is busy.
+ */
+TEST(parallel_algorithms_test, parallel_for_nested)
+{
+    SlotThreadPool thread_pool(2);
+    thread_pool.enable();
+    ParallelExecutor executor(thread_pool);
+
+    std::atomic<std::size_t> count(0);
+    parallel_for(
+        executor,
+        0,
+        16,
+        1,
+        [&](std::size_t)
+        {
+            parallel_for(
+                executor,
+                0,
+                100,
+                10,
+                [&count](std::size_t)
+                {
+                    count++;
+                });
+        });
+
+    ASSERT_EQ(count.load(), 1600u);
+}
+
+/**
+ * Transform a vector and compare it with the sequential result.
+ */
+TEST(parallel_algorithms_test, parallel_transform)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    thread_pool.enable();
+    ParallelExecutor executor(thread_pool);
+
+    std::vector<int> input(test::N_ELEMENTS_IN_TEST);
+    std::iota(input.begin(), input.end(), 0);
+    std::vector<std::string> output(input.size());
+
+    auto end = parallel_transform(
+        executor,
+        input.begin(),
+        input.end(),
+        output.begin(),
+        0,
+        [](int value)
+        {
+            return std::to_string(value);
+        });
+
+    ASSERT_EQ(end, output.end());
+    for (std::size_t i = 0; i < input.size(); ++i)
+    {
+        ASSERT_EQ(output[i], std::to_string(input[i]));
+    }
+}
+
+/**
+ * Reduce with an associative but not commutative operation, so order of partial results is checked.
+ */
+TEST(parallel_algorithms_test, parallel_reduce)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    thread_pool.enable();
+    ParallelExecutor executor(thread_pool);
+
+    std::vector<int> numbers(test::N_ELEMENTS_IN_TEST);
+    std::iota(numbers.begin(), numbers.end(), 1);
+
+    // Sum
+    long long sum = parallel_reduce(
+        executor,
+        numbers.begin(),
+        numbers.end(),
+        10LL,
+        0,
+        [](long long a, long long b)
+        {
+            return a + b;
+        });
+    ASSERT_EQ(sum, 10LL + (static_cast<long long>(test::N_ELEMENTS_IN_TEST) * (test::N_ELEMENTS_IN_TEST + 1)) / 2);
+
+    // Concatenation
+    std::vector<std::string> words;
+    std::string expected = ">";
+    for (int i = 0; i < 1000; ++i)
+    {
+        words.push_back(std::to_string(i) + ",");
+        expected += words.back();
+    }
+
+    std::string result = parallel_reduce(
+        executor,
+        words.begin(),
+        words.end(),
+        std::string(">"),
+        7,
+        [](std::string a, const std::string& b)
+        {
+            return a + b;
+        });
+    ASSERT_EQ(result, expected);
+
+    // Empty range
+    ASSERT_EQ(parallel_reduce(executor, words.begin(), words.begin(), std::string("init"), 0, std::plus<std::string>()),
+        "init");
+}
+
+/**
+ * Sort pairs by their first value only, and check the order of the second values is kept for equal keys.
+ */
+TEST(parallel_algorithms_test, parallel_stable_sort)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    thread_pool.enable();
+    ParallelExecutor executor(thread_pool);
+
+    for (std::size_t grain : {0, 1, 3, 1000, 1000000})
+    {
+        std::vector<std::pair<int, std::size_t>> values;
+        for (std::size_t i = 0; i < test::N_ELEMENTS_IN_TEST / 10; ++i)
+        {
+            values.emplace_back(static_cast<int>((i * 7919) % 97), i);
+        }
+        std::vector<std::pair<int, std::size_t>> expected = values;
+
+        auto compare_keys =
+                [](const std::pair<int, std::size_t>& a, const std::pair<int, std::size_t>& b)
+                {
+                    return a.first < b.first;
+                };
+
+        std::stable_sort(expected.begin(), expected.end(), compare_keys);
+        parallel_stable_sort(executor, values.begin(), values.end(), grain, compare_keys);
+
+        ASSERT_EQ(values, expected);
+    }
+
+    // Default comparison and move only types
+    std::vector<std::unique_ptr<int>> pointers;
+    for (int i = 0; i < 1000; ++i)
+    {
+        pointers.push_back(std::unique_ptr<int>(new int((i * 31) % 1000)));
+    }
+    parallel_stable_sort(
+        executor,
+        pointers.begin(),
+        pointers.end(),
+        10,
+        [](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b)
+        {
+            return *a < *b;
+        });
+    for (int i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(*pointers[i], i);
+    }
+
+    std::vector<int> numbers = {5, 3, 9, 1, 1, 0, 7};
+    parallel_stable_sort(executor, numbers.begin(), numbers.end(), 2);
+    ASSERT_EQ(numbers, (std::vector<int>{0, 1, 1, 3, 5, 7, 9}));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -12,9 +12,15 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
 
+#include <cpp_utils/exception/DisabledException.hpp>
+#include <cpp_utils/exception/ValueNotAllowedException.hpp>
 #include <cpp_utils/wait/IntWaitHandler.hpp>
 #include <cpp_utils/Log.hpp>
 #include <cpp_utils/time/Timer.hpp>
@@ -177,6 +183,124 @@ TEST(slot_thread_pool_test, pool_n_threads_one_slot)
     ASSERT_EQ(waiter.get_value(), test::N_EXECUTIONS_IN_TEST* test::N_THREADS_IN_TEST);
 }
 
+/**
+ * Remove a slot while it is being executed and while its id is in the queue.
+ *
+ * STEPS:
+ * - emit the slot twice, so one execution runs and the other waits in the queue
+ * - remove the slot, what waits for the running execution
+ * - check the execution queued is skipped and the slot cannot be emitted any more
+ * - register the id again
+ * - remove a slot from its own task, what does not wait
+ */
+TEST(slot_thread_pool_test, unslot)
+{
+    SlotThreadPool thread_pool(1);
+    thread_pool.enable();
+
+    std::atomic<bool> gate_open(false);
+    std::atomic<int> executions(0);
+
+    TaskId task_id(27);
+    thread_pool.slot(
+        task_id,
+        [&gate_open, &executions]
+            ()
+        {
+            executions++;
+            while (!gate_open.load())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+        );
+
+    // emit the slot twice, so one execution runs and the other waits in the queue
+    thread_pool.emit(task_id);
+    thread_pool.emit(task_id);
+    while (executions.load() == 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // remove the slot, what waits for the running execution
+    std::atomic<bool> removed(false);
+    std::thread remover([&thread_pool, &task_id, &removed]()
+            {
+                thread_pool.unslot(task_id);
+                removed.store(true);
+            });
+    std::this_thread::sleep_for(std::chrono::milliseconds(test::RESIDUAL_TIME_TEST));
+    ASSERT_FALSE(removed.load());
+
+    gate_open.store(true);
+    remover.join();
+
+    // check the execution queued is skipped and the slot cannot be emitted any more
+    thread_pool.wait_all_consumed();
+    ASSERT_EQ(executions.load(), 1);
+    ASSERT_THROW(thread_pool.emit(task_id), ValueNotAllowedException);
+    ASSERT_THROW(thread_pool.unslot(task_id), ValueNotAllowedException);
+
+    // register the id again
+    eprosima::utils::event::IntWaitHandler waiter(0);
+    thread_pool.slot(
+        task_id,
+        [&thread_pool, &task_id, &waiter]
+            ()
+        {
+            // remove a slot from its own task, what does not wait
+            thread_pool.unslot(task_id);
+            ++waiter;
+        }
+        );
+    thread_pool.emit(task_id);
+    waiter.wait_greater_equal_than(1);
+
+    // The slot is erased once its task returns
+    thread_pool.disable();
+    ASSERT_THROW(thread_pool.emit(task_id), ValueNotAllowedException);
+}
+
+/**
+ * Remove a slot after its task has thrown, which ends the thread that executed it.
+ *
+ * STEPS:
+ * - emit a slot whose task throws, and wait until it has thrown
+ * - remove the slot, what does not wait for the execution that has thrown
+ */
+TEST(slot_thread_pool_test, unslot_after_throw)
+{
+    SlotThreadPool thread_pool(2);
+    thread_pool.enable();
+
+    std::atomic<bool> thrown(false);
+
+    TaskId task_id(27);
+    thread_pool.slot(
+        task_id,
+        [&thrown]
+            ()
+        {
+            thrown.store(true);
+            throw DisabledException("Task stops its thread.");
+        }
+        );
+
+    // emit a slot whose task throws, and wait until it has thrown
+    thread_pool.emit(task_id);
+    thread_pool.wait_all_consumed();
+    while (!thrown.load())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(test::RESIDUAL_TIME_TEST));
+
+    // remove the slot, what does not wait for the execution that has thrown
+    thread_pool.unslot(task_id);
+    ASSERT_THROW(thread_pool.emit(task_id), ValueNotAllowedException);
+}
+
 int main(
         int argc,
         char** argv)
@@ -0,0 +1,321 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/exception/ValueNotAllowedException.hpp>
+#include <cpp_utils/thread_pool/strand/Strand.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace test {
+
+constexpr const unsigned int N_THREADS_IN_TEST = 4;
+constexpr const unsigned int N_STRANDS_IN_TEST = 8;
+constexpr const unsigned int N_TASKS_IN_TEST = 1000;
+
+//! Wait until every task posted to \c strand has finished.
+void wait_strand(
+        const Strand& strand)
+{
+    while (strand.pending() > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+//! Strand that gives the id of its slot.
+class SlotStrand : public Strand
+{
+public:
+
+    using Strand::Strand;
+
+    TaskId task_id() const
+    {
+        return task_id_;
+    }
+
+};
+
+//! Wait until the slot \c task_id is removed from \c thread_pool .
+bool wait_slot_removed(
+        SlotThreadPool& thread_pool,
+        const TaskId& task_id)
+{
+    for (int i = 0; i < 5000; ++i)
+    {
+        try
+        {
+            thread_pool.emit(task_id);
+        }
+        catch (const ValueNotAllowedException&)
+        {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+} /* namespace test */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils;
+
+/**
+ * Post tasks from several threads to several strands, and check that tasks of the same strand never run
+ * concurrently and are executed in the order each thread posted them.
+ */
+TEST(strand_test, serialized_fifo)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    thread_pool.enable();
+
+    struct StrandState
+    {
+        std::atomic<unsigned int> running {0};
+        std::atomic<bool> overlapped {false};
+        // Not protected, as the strand must serialize every access
+        std::vector<unsigned int> order;
+    };
+
+    std::vector<std::unique_ptr<Strand>> strands;
+    std::vector<StrandState> states(test::N_STRANDS_IN_TEST);
+    for (unsigned int i = 0; i < test::N_STRANDS_IN_TEST; ++i)
+    {
+        strands.emplace_back(new Strand(thread_pool));
+    }
+
+    std::vector<std::thread> producers;
+    for (unsigned int s = 0; s < test::N_STRANDS_IN_TEST; ++s)
+    {
+        producers.emplace_back(
+            [&, s]()
+            {
+                StrandState& state = states[s];
+                for (unsigned int i = 0; i < test::N_TASKS_IN_TEST; ++i)
+                {
+                    strands[s]->post([&state, i]()
+                    {
+                        if (state.running.fetch_add(1) != 0)
+                        {
+                            state.overlapped = true;
+                        }
+                        state.order.push_back(i);
+                        state.running.fetch_sub(1);
+                    });
+                }
+            });
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    for (unsigned int s = 0; s < test::N_STRANDS_IN_TEST; ++s)
+    {
+        test::wait_strand(*strands[s]);
+
+        ASSERT_FALSE(states[s].overlapped.load());
+        ASSERT_EQ(states[s].order.size(), test::N_TASKS_IN_TEST);
+        for (unsigned int i = 0; i < test::N_TASKS_IN_TEST; ++i)
+        {
+            ASSERT_EQ(states[s].order[i], i);
+        }
+    }
+}
+
+/**
+ * Check that different strands run in parallel in different threads of the pool.
+ */
+TEST(strand_test, strands_in_parallel)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    thread_pool.enable();
+
+    std::atomic<unsigned int> running(0);
+    std::atomic<unsigned int> max_running(0);
+
+    std::vector<std::unique_ptr<Strand>> strands;
+    for (unsigned int i = 0; i < test::N_THREADS_IN_TEST; ++i)
+    {
+        strands.emplace_back(new Strand(thread_pool));
+        strands.back()->post([&]()
+                {
+                    unsigned int current = ++running;
+                    unsigned int previous_max = max_running.load();
+                    while (current > previous_max && !max_running.compare_exchange_weak(previous_max, current))
+                    {
+                    }
+                    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                    --running;
+                });
+    }
+
+    for (auto& strand : strands)
+    {
+        test::wait_strand(*strand);
+    }
+
+    ASSERT_GT(max_running.load(), 1u);
+}
+
+/**
+ * Check that a busy strand yields the only thread of the pool so other strands progress.
+ */
+TEST(strand_test, busy_strand_does_not_starve)
+{
+    SlotThreadPool thread_pool(1);
+    Strand busy(thread_pool);
+    Strand other(thread_pool);
+
+    std::atomic<unsigned int> busy_executed(0);
+    std::atomic<unsigned int> busy_executed_before_other(0);
+
+    for (unsigned int i = 0; i < test::N_TASKS_IN_TEST; ++i)
+    {
+        busy.post([&busy_executed]()
+                {
+                    busy_executed++;
+                });
+    }
+    other.post([&]()
+            {
+                busy_executed_before_other = busy_executed.load();
+            });
+
+    thread_pool.enable();
+    test::wait_strand(busy);
+    test::wait_strand(other);
+
+    ASSERT_EQ(busy_executed.load(), test::N_TASKS_IN_TEST);
+    ASSERT_LE(busy_executed_before_other.load(), Strand::MAX_TASKS_PER_EMISSION);
+}
+
+/**
+ * Post tasks from a task of the same strand, and check an exception in a task does not stop the strand.
+ */
+TEST(strand_test, post_from_task_and_exception)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    Strand strand(thread_pool);
+
+    std::vector<int> order;
+
+    strand.post([&]()
+            {
+                order.push_back(0);
+                strand.post([&order]()
+                {
+                    order.push_back(2);
+                });
+                throw std::runtime_error("task error");
+            });
+    strand.post([&order]()
+            {
+                order.push_back(1);
+            });
+
+    // Enable pool once both tasks are posted, so the task posted from the first one goes after them
+    thread_pool.enable();
+    test::wait_strand(strand);
+
+    ASSERT_EQ(order, (std::vector<int>{0, 1, 2}));
+}
+
+/**
+ * Check that tasks posted are executed even if the strand is destroyed before.
+ */
+TEST(strand_test, destroy_with_pending_tasks)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    std::atomic<unsigned int> executed(0);
+
+    {
+        Strand strand(thread_pool);
+        for (unsigned int i = 0; i < test::N_TASKS_IN_TEST; ++i)
+        {
+            strand.post([&executed]()
+                    {
+                        executed++;
+                    });
+        }
+    }
+
+    thread_pool.enable();
+    while (executed.load() < test::N_TASKS_IN_TEST)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(executed.load(), test::N_TASKS_IN_TEST);
+}
+
+/**
+ * Check that the slot of a strand is removed from the pool once it is destroyed and its tasks have finished.
+ *
+ * CASES:
+ * - Strand destroyed with no tasks pending
+ * - Strand destroyed with tasks pending
+ */
+TEST(strand_test, slot_removed)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    std::atomic<unsigned int> executed(0);
+
+    // Strand destroyed with no tasks pending
+    TaskId task_id;
+    {
+        test::SlotStrand strand(thread_pool);
+        task_id = strand.task_id();
+    }
+    ASSERT_THROW(thread_pool.emit(task_id), ValueNotAllowedException);
+
+    // Strand destroyed with tasks pending
+    {
+        test::SlotStrand strand(thread_pool);
+        task_id = strand.task_id();
+        for (unsigned int i = 0; i < test::N_TASKS_IN_TEST; ++i)
+        {
+            strand.post([&executed]()
+                    {
+                        executed++;
+                    });
+        }
+    }
+
+    thread_pool.enable();
+    ASSERT_TRUE(test::wait_slot_removed(thread_pool, task_id));
+    ASSERT_EQ(executed.load(), test::N_TASKS_IN_TEST);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,440 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/exception/PreconditionNotMet.hpp>
+#include <cpp_utils/exception/ValueNotAllowedException.hpp>
+#include <cpp_utils/thread_pool/graph/TaskGraph.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace test {
+
+constexpr const unsigned int N_THREADS_IN_TEST = 4;
+constexpr const unsigned int N_RUNS_IN_TEST = 20;
+
+/**
+ * Record the order in which tasks are executed.
+ */
+struct ExecutionRecord
+{
+    void add(
+            TaskNodeId node)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        order.push_back(node);
+    }
+
+    //! Position of \c node in the execution order.
+    std::size_t position(
+            TaskNodeId node)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            if (order[i] == node)
+            {
+                return i;
+            }
+        }
+        return order.size();
+    }
+
+    std::mutex mutex;
+    std::vector<TaskNodeId> order;
+};
+
+//! Task Graph that gives the ids of the slots of its nodes.
+class SlotsTaskGraph : public TaskGraph
+{
+public:
+
+    using TaskGraph::TaskGraph;
+
+    TaskId task_id(
+            TaskNodeId node) const
+    {
+        return nodes_[node].task_id;
+    }
+
+    //! Remove the slot of \c node from the pool, so it cannot be emitted any more.
+    void unslot(
+            TaskNodeId node)
+    {
+        thread_pool_.unslot(nodes_[node].task_id);
+        nodes_[node].registered = false;
+    }
+
+};
+
+} /* namespace test */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils;
+
+/**
+ * Execute a chain of tasks several times and check they are executed in order.
+ */
+TEST(task_graph_test, chain_order)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    thread_pool.enable();
+    TaskGraph graph(thread_pool);
+
+    test::ExecutionRecord record;
+    constexpr const TaskNodeId N_NODES = 10;
+    for (TaskNodeId i = 0; i < N_NODES; ++i)
+    {
+        graph.add_task([&record, i]()
+                {
+                    record.add(i);
+                });
+        if (i > 0)
+        {
+            graph.add_dependency(i - 1, i);
+        }
+    }
+    ASSERT_EQ(graph.size(), N_NODES);
+
+    for (unsigned int run = 0; run < test::N_RUNS_IN_TEST; ++run)
+    {
+        record.order.clear();
+        graph.run();
+
+        ASSERT_EQ(record.order.size(), N_NODES);
+        for (TaskNodeId i = 0; i < N_NODES; ++i)
+        {
+            ASSERT_EQ(record.order[i], i);
+        }
+    }
+}
+
+/**
+ * Execute a diamond graph: A -> (B, C) -> D.
+ */
+TEST(task_graph_test, diamond)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    thread_pool.enable();
+    TaskGraph graph(thread_pool);
+
+    test::ExecutionRecord record;
+    std::vector<TaskNodeId> nodes;
+    for (int i = 0; i < 4; ++i)
+    {
+        nodes.push_back(graph.add_task([&record, &nodes, i]()
+                {
+                    record.add(nodes[i]);
+                }));
+    }
+    graph.add_dependency(nodes[0], nodes[1]);
+    graph.add_dependency(nodes[0], nodes[2]);
+    graph.add_dependency(nodes[1], nodes[3]);
+    graph.add_dependency(nodes[2], nodes[3]);
+
+    for (unsigned int run = 0; run < test::N_RUNS_IN_TEST; ++run)
+    {
+        record.order.clear();
+        graph.run();
+
+        ASSERT_EQ(record.order.size(), 4u);
+        ASSERT_EQ(record.position(nodes[0]), 0u);
+        ASSERT_EQ(record.position(nodes[3]), 3u);
+    }
+}
+
+/**
+ * Check that independent branches are executed in parallel.
+ */
+TEST(task_graph_test, parallel_branches)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    thread_pool.enable();
+    TaskGraph graph(thread_pool);
+
+    std::atomic<unsigned int> running(0);
+    std::atomic<unsigned int> max_running(0);
+
+    TaskNodeId source = graph.add_task([]()
+            {
+            });
+    TaskNodeId sink = graph.add_task([]()
+            {
+            });
+
+    for (unsigned int i = 0; i < test::N_THREADS_IN_TEST; ++i)
+    {
+        TaskNodeId branch = graph.add_task([&]()
+                {
+                    unsigned int current = ++running;
+                    unsigned int previous_max = max_running.load();
+                    while (current > previous_max && !max_running.compare_exchange_weak(previous_max, current))
+                    {
+                    }
+                    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                    --running;
+                });
+        graph.add_dependency(source, branch);
+        graph.add_dependency(branch, sink);
+    }
+
+    graph.run();
+
+    ASSERT_GT(max_running.load(), 1u);
+    ASSERT_LE(max_running.load(), test::N_THREADS_IN_TEST);
+}
+
+/**
+ * Add tasks after a run and check the new graph is executed in the next run.
+ */
+TEST(task_graph_test, modify_between_runs)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    thread_pool.enable();
+    TaskGraph graph(thread_pool);
+
+    std::atomic<unsigned int> executions(0);
+    auto count = [&executions]()
+            {
+                executions++;
+            };
+
+    // Empty graph
+    graph.run();
+
+    TaskNodeId first = graph.add_task(count);
+    graph.run();
+    ASSERT_EQ(executions.load(), 1u);
+
+    TaskNodeId second = graph.add_task(count);
+    graph.add_dependency(first, second);
+    graph.run();
+    ASSERT_EQ(executions.load(), 3u);
+}
+
+/**
+ * Check that cycles and wrong dependencies are rejected.
+ */
+TEST(task_graph_test, invalid_graph)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    thread_pool.enable();
+    TaskGraph graph(thread_pool);
+
+    std::atomic<unsigned int> executions(0);
+    auto count = [&executions]()
+            {
+                executions++;
+            };
+
+    TaskNodeId a = graph.add_task(count);
+    TaskNodeId b = graph.add_task(count);
+    TaskNodeId c = graph.add_task(count);
+
+    ASSERT_THROW(graph.add_dependency(a, a), ValueNotAllowedException);
+    ASSERT_THROW(graph.add_dependency(a, 3), ValueNotAllowedException);
+
+    graph.add_dependency(a, b);
+    graph.add_dependency(b, c);
+    graph.add_dependency(c, b);
+
+    ASSERT_THROW(graph.run(), PreconditionNotMet);
+    ASSERT_EQ(executions.load(), 0u);
+}
+
+/**
+ * Check that an exception thrown by a task is rethrown by run, and the tasks that depend on it are skipped.
+ */
+TEST(task_graph_test, exception)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    thread_pool.enable();
+    TaskGraph graph(thread_pool);
+
+    std::atomic<bool> fail(true);
+    std::atomic<unsigned int> executions(0);
+
+    TaskNodeId thrower = graph.add_task([&fail]()
+            {
+                if (fail)
+                {
+                    throw std::runtime_error("task error");
+                }
+            });
+    TaskNodeId after = graph.add_task([&executions]()
+            {
+                executions++;
+            });
+    graph.add_dependency(thrower, after);
+
+    ASSERT_THROW(graph.run(), std::runtime_error);
+    ASSERT_EQ(executions.load(), 0u);
+
+    // Graph is still usable after an exception
+    fail = false;
+    graph.run();
+    ASSERT_EQ(executions.load(), 1u);
+}
+
+/**
+ * Check that the graph cannot be modified nor run again while running.
+ */
+TEST(task_graph_test, modify_while_running)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    thread_pool.enable();
+    TaskGraph graph(thread_pool);
+
+    bool add_thrown = false;
+    bool dependency_thrown = false;
+    bool run_thrown = false;
+
+    graph.add_task([&]()
+            {
+                try
+                {
+                    graph.add_task([]()
+                    {
+                    });
+                }
+                catch (const PreconditionNotMet&)
+                {
+                    add_thrown = true;
+                }
+
+                try
+                {
+                    graph.add_dependency(0, 0);
+                }
+                catch (const PreconditionNotMet&)
+                {
+                    dependency_thrown = true;
+                }
+
+                try
+                {
+                    graph.run();
+                }
+                catch (const PreconditionNotMet&)
+                {
+                    run_thrown = true;
+                }
+            });
+
+    graph.run();
+
+    ASSERT_TRUE(add_thrown);
+    ASSERT_TRUE(dependency_thrown);
+    ASSERT_TRUE(run_thrown);
+    ASSERT_EQ(graph.size(), 1u);
+}
+
+/**
+ * Run a graph in a pool not enabled, and destroy a graph whose nodes are registered in the pool.
+ *
+ * STEPS:
+ * - run the graph with the pool disabled, what throws instead of blocking
+ * - run it again once the pool is enabled
+ * - destroy the graph, what removes its slots from the pool
+ */
+TEST(task_graph_test, disabled_pool_and_destruction)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    std::atomic<unsigned int> executed(0);
+    TaskId task_id;
+
+    {
+        test::SlotsTaskGraph graph(thread_pool);
+        graph.add_task([&executed]()
+                {
+                    executed++;
+                });
+
+        // run the graph with the pool disabled, what throws instead of blocking
+        ASSERT_THROW(graph.run(), PreconditionNotMet);
+        ASSERT_EQ(executed.load(), 0u);
+
+        // run it again once the pool is enabled
+        thread_pool.enable();
+        graph.run();
+        ASSERT_EQ(executed.load(), 1u);
+
+        task_id = graph.task_id(0);
+        thread_pool.emit(task_id);
+        thread_pool.wait_all_consumed();
+    }
+
+    // destroy the graph, what removes its slots from the pool
+    ASSERT_THROW(thread_pool.emit(task_id), ValueNotAllowedException);
+}
+
+/**
+ * Run a graph whose nodes cannot be emitted to the pool.
+ *
+ * STEPS:
+ * - run a chain whose second node cannot be emitted, what throws once the first one has finished
+ * - run it again, what throws the same (and not that the graph is running)
+ * - run a chain whose first node cannot be emitted, what executes no task
+ */
+TEST(task_graph_test, emit_error)
+{
+    SlotThreadPool thread_pool(test::N_THREADS_IN_TEST);
+    thread_pool.enable();
+
+    for (TaskNodeId unslotted = 0; unslotted < 2; ++unslotted)
+    {
+        test::SlotsTaskGraph graph(thread_pool);
+        std::atomic<unsigned int> executed(0);
+        for (int i = 0; i < 3; ++i)
+        {
+            graph.add_task([&executed]()
+                    {
+                        executed++;
+                    });
+        }
+        graph.add_dependency(0, 1);
+        graph.add_dependency(1, 2);
+
+        // Register the slots of the nodes
+        graph.run();
+        ASSERT_EQ(executed.load(), 3u);
+
+        graph.unslot(unslotted == 0 ? 1 : 0);
+        executed.store(0);
+
+        ASSERT_THROW(graph.run(), ValueNotAllowedException);
+        ASSERT_EQ(executed.load(), unslotted == 0 ? 1u : 0u);
+
+        ASSERT_THROW(graph.run(), ValueNotAllowedException);
+        ASSERT_EQ(executed.load(), unslotted == 0 ? 2u : 0u);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
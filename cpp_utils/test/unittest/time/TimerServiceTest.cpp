@@ -0,0 +1,118 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/time/TimerService.hpp>
+
+using namespace eprosima::utils;
+
+/**
+ * Schedule tasks in reverse order and check they are executed in order of time.
+ */
+TEST(TimerServiceTest, execution_order)
+{
+    TimerService service;
+
+    std::mutex order_mutex;
+    std::vector<int> order;
+    std::atomic<int> executed(0);
+
+    for (int i = 4; i >= 0; --i)
+    {
+        service.schedule(
+            static_cast<Duration_ms>(10 * i),
+            [&, i]()
+            {
+                std::lock_guard<std::mutex> lock(order_mutex);
+                order.push_back(i);
+                executed++;
+            });
+    }
+
+    for (int i = 0; i < 5000 && executed.load() < 5; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::lock_guard<std::mutex> lock(order_mutex);
+    ASSERT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4}));
+    ASSERT_EQ(service.size(), 0u);
+}
+
+/**
+ * Cancel a task before its time and check it is never executed.
+ */
+TEST(TimerServiceTest, cancel)
+{
+    TimerService service;
+
+    std::atomic<int> executed(0);
+    TimerTaskId id = service.schedule(
+        static_cast<Duration_ms>(50),
+        [&executed]()
+        {
+            executed++;
+        });
+    ASSERT_EQ(service.size(), 1u);
+
+    ASSERT_TRUE(service.cancel(id));
+    ASSERT_FALSE(service.cancel(id));
+    ASSERT_EQ(service.size(), 0u);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(executed.load(), 0);
+}
+
+/**
+ * Cancel a task while it is running and check cancel waits for it to finish.
+ */
+TEST(TimerServiceTest, cancel_waits_running)
+{
+    TimerService service;
+
+    std::atomic<bool> started(false);
+    std::atomic<bool> finished(false);
+    TimerTaskId id = service.schedule(
+        static_cast<Duration_ms>(0),
+        [&]()
+        {
+            started.store(true);
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            finished.store(true);
+        });
+
+    while (!started.load())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    ASSERT_FALSE(service.cancel(id));
+    ASSERT_TRUE(finished.load());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -14,6 +14,13 @@
 
 #include <iostream>
 #include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif // if !defined(_WIN32)
 
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
@@ -168,6 +175,123 @@ TEST(CommandReaderTest, read_lines_enum_2_singleton)
     }
 }
 
+/**
+ * Read a batch of commands, keeping only the parsable ones.
+ */
+TEST(CommandReaderTest, read_commands_stream)
+{
+    std::stringstream source;
+    source << "value_1" << "\n";
+    source << "value_3 arg" << "\n";
+    source << "value_2 some args" << "\n";
+
+    auto builder = test::create_builder();
+    CommandReader<test::Enum1> reader(
+        builder,
+        source);
+
+    std::vector<Command<test::Enum1>> commands;
+    ASSERT_EQ(reader.read_commands(commands, 3), 3u);
+    ASSERT_EQ(commands.size(), 2u);
+    ASSERT_EQ(commands[0].command, test::Enum1::value_1);
+    ASSERT_EQ(commands[1].command, test::Enum1::value_2);
+    ASSERT_EQ(commands[1].arguments, std::vector<std::string>({"value_2", "some", "args"}));
+}
+
+#if !defined(_WIN32)
+/**
+ * Read commands from a pipe with a \c FdLineReader , one by one and in batches, until the end of the stream.
+ */
+TEST(CommandReaderTest, read_commands_fd)
+{
+    const std::string content = "value_1\nvalue_3 arg\nvalue_2 a  b\nvalue_1 last";
+
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    ASSERT_EQ(write(fds[1], content.c_str(), content.size()), static_cast<ssize_t>(content.size()));
+    close(fds[1]);
+
+    auto builder = test::create_builder();
+    CommandReader<test::Enum1> reader(
+        builder,
+        std::make_unique<FdLineReader>(fds[0], 8));
+
+    {
+        Command<test::Enum1> command_result;
+        ASSERT_TRUE(reader.read_next_command(command_result));
+        ASSERT_EQ(command_result.command, test::Enum1::value_1);
+        ASSERT_EQ(command_result.arguments, std::vector<std::string>({"value_1"}));
+    }
+
+    std::vector<Command<test::Enum1>> commands;
+    ASSERT_EQ(reader.read_commands(commands, 10), 3u);
+    ASSERT_EQ(commands.size(), 2u);
+    ASSERT_EQ(commands[0].command, test::Enum1::value_2);
+    ASSERT_EQ(commands[0].arguments, std::vector<std::string>({"value_2", "a", "", "b"}));
+    ASSERT_EQ(commands[1].command, test::Enum1::value_1);
+    ASSERT_EQ(commands[1].arguments, std::vector<std::string>({"value_1", "last"}));
+
+    // End of stream
+    ASSERT_EQ(reader.read_commands(commands, 10), 0u);
+    ASSERT_TRUE(commands.empty());
+
+    close(fds[0]);
+}
+
+/**
+ * Read a long script of commands from a pipe in batches.
+ */
+TEST(CommandReaderTest, read_commands_fd_script)
+{
+    constexpr std::size_t N_COMMANDS = 100000;
+    constexpr std::size_t BATCH = 1000;
+
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+
+    // Pipe capacity is limited, so the script is written while it is read
+    std::thread writer([&fds]()
+            {
+                std::string script;
+                for (std::size_t i = 0; i < N_COMMANDS; ++i)
+                {
+                    script += (i % 2 ? "value_1 " : "value_2 ") + std::to_string(i) + "\n";
+                }
+                std::size_t written = 0;
+                while (written < script.size())
+                {
+                    const ssize_t bytes = write(fds[1], script.c_str() + written, script.size() - written);
+                    if (bytes <= 0)
+                    {
+                        break;
+                    }
+                    written += static_cast<std::size_t>(bytes);
+                }
+                close(fds[1]);
+            });
+
+    auto builder = test::create_builder();
+    CommandReader<test::Enum1> reader(
+        builder,
+        std::make_unique<FdLineReader>(fds[0]));
+
+    std::vector<Command<test::Enum1>> commands;
+    std::size_t total = 0;
+    std::size_t lines;
+    while ((lines = reader.read_commands(commands, BATCH)) > 0)
+    {
+        ASSERT_EQ(commands.size(), lines);
+        ASSERT_EQ(commands.front().arguments[1], std::to_string(total));
+        total += lines;
+    }
+    ASSERT_EQ(total, N_COMMANDS);
+
+    writer.join();
+    close(fds[0]);
+}
+
+#endif // if !defined(_WIN32)
+
 int main(
         int argc,
         char** argv)
@@ -0,0 +1,325 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/Formatter.hpp>
+
+namespace eprosima {
+namespace utils {
+namespace test {
+
+//! Previous implementation of \c Formatter , over a \c std::stringstream , to compare with.
+class StreamFormatter
+{
+public:
+
+    template<class Val>
+    StreamFormatter& operator <<(
+            const Val& val)
+    {
+        ss_ << val;
+        return *this;
+    }
+
+    std::string to_string() const noexcept
+    {
+        return ss_.str().c_str();
+    }
+
+protected:
+
+    std::stringstream ss_;
+};
+
+//! Object only printable with its own \c operator<< .
+struct Printable
+{
+    int value;
+};
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const Printable& printable)
+{
+    os << "Printable{" << printable.value << "}";
+    return os;
+}
+
+enum Color
+{
+    red,
+    green
+};
+
+//! Check that \c val is written as a default stream does.
+template<class Val>
+void check_same_as_stream(
+        const Val& val)
+{
+    std::stringstream ss;
+    ss << val;
+    ASSERT_EQ((Formatter() << val).to_string(), ss.str());
+}
+
+} /* namespace test */
+} /* namespace utils */
+} /* namespace eprosima */
+
+using namespace eprosima::utils;
+
+/**
+ * Values written directly in the buffer give the same text as a default stream.
+ *
+ * CASES:
+ * - Strings and characters
+ * - Limits of every integer type
+ * - Floating point numbers, special values included
+ * - Objects written with their operator<<
+ */
+TEST(FormatterTest, same_as_stream)
+{
+    // Strings and characters
+    test::check_same_as_stream("literal");
+    test::check_same_as_stream(std::string("string"));
+    test::check_same_as_stream(std::string());
+    test::check_same_as_stream('c');
+    test::check_same_as_stream(static_cast<signed char>('s'));
+    test::check_same_as_stream(static_cast<unsigned char>('u'));
+    test::check_same_as_stream(true);
+    test::check_same_as_stream(false);
+    char mutable_string[] = "mutable";
+    test::check_same_as_stream(static_cast<char*>(mutable_string));
+
+    // Integers
+    test::check_same_as_stream(std::numeric_limits<short>::min());
+    test::check_same_as_stream(std::numeric_limits<unsigned short>::max());
+    test::check_same_as_stream(0);
+    test::check_same_as_stream(-7);
+    test::check_same_as_stream(std::numeric_limits<int>::min());
+    test::check_same_as_stream(std::numeric_limits<int>::max());
+    test::check_same_as_stream(std::numeric_limits<unsigned int>::max());
+    test::check_same_as_stream(std::numeric_limits<long>::min());
+    test::check_same_as_stream(std::numeric_limits<unsigned long>::max());
+    test::check_same_as_stream(std::numeric_limits<long long>::min());
+    test::check_same_as_stream(std::numeric_limits<long long>::max());
+    test::check_same_as_stream(std::numeric_limits<unsigned long long>::max());
+    test::check_same_as_stream(static_cast<uint16_t>(7400));
+    test::check_same_as_stream(static_cast<int64_t>(-1234567890123));
+
+    // Floating point
+    test::check_same_as_stream(0.0);
+    test::check_same_as_stream(-0.0);
+    test::check_same_as_stream(0.1);
+    test::check_same_as_stream(3.14159265358979);
+    test::check_same_as_stream(123456789.0);
+    test::check_same_as_stream(1e-300);
+    test::check_same_as_stream(-std::numeric_limits<double>::max());
+    test::check_same_as_stream(std::numeric_limits<double>::infinity());
+    test::check_same_as_stream(std::nan(""));
+    test::check_same_as_stream(2.5f);
+    test::check_same_as_stream(std::numeric_limits<float>::min());
+    test::check_same_as_stream(static_cast<long double>(1) / 3);
+    test::check_same_as_stream(-std::numeric_limits<long double>::max());
+
+    // Objects written with their operator<<
+    test::check_same_as_stream(test::Printable{42});
+    test::check_same_as_stream(test::green);
+    test::check_same_as_stream(static_cast<const void*>(mutable_string));
+
+    // Everything in the same chain
+    std::stringstream ss;
+    ss << "Value " << 42 << " of " << test::Printable{-1} << " is " << 0.5 << '.';
+    ASSERT_EQ((STR_ENTRY << "Value " << 42 << " of " << test::Printable{-1} << " is " << 0.5 << '.').to_string(),
+            ss.str());
+}
+
+/**
+ * Manipulators change the format of the values written after them, as in a stream.
+ */
+TEST(FormatterTest, manipulators)
+{
+    std::stringstream ss;
+    ss << 255 << " " << std::hex << 255 << " " << std::setw(6) << std::setfill('0') << 42 << " "
+       << std::setprecision(10) << 3.14159265358979 << " " << std::boolalpha << true;
+
+    Formatter formatter;
+    formatter << 255 << " " << std::hex << 255 << " " << std::setw(6) << std::setfill('0') << 42 << " "
+              << std::setprecision(10) << 3.14159265358979 << " " << std::boolalpha << true;
+
+    ASSERT_EQ(formatter.to_string(), ss.str());
+}
+
+/**
+ * Manipulators change the format of strings and characters too, as in a stream.
+ *
+ * CASES:
+ * - Width of a string
+ * - Width and fill of a character and a C string
+ * - Adjustment and width of signed, unsigned characters and mutable C strings
+ */
+TEST(FormatterTest, string_manipulators)
+{
+    {
+        Formatter formatter;
+        formatter << "[" << std::setw(5) << std::string("ab") << "|" << 7 << "]";
+        ASSERT_EQ(formatter.to_string(), "[   ab|7]");
+    }
+
+    {
+        Formatter formatter;
+        formatter << std::setw(4) << 'x' << std::setfill('*') << std::setw(3) << "y";
+        ASSERT_EQ(formatter.to_string(), "   x**y");
+    }
+
+    {
+        std::stringstream ss;
+        ss << std::left << std::setw(4) << static_cast<signed char>('a') << std::setw(3)
+           << static_cast<unsigned char>('b') << std::setw(4) << const_cast<char*>("cd") << "|";
+
+        Formatter formatter;
+        formatter << std::left << std::setw(4) << static_cast<signed char>('a') << std::setw(3)
+                  << static_cast<unsigned char>('b') << std::setw(4) << const_cast<char*>("cd") << "|";
+        ASSERT_EQ(formatter.to_string(), ss.str());
+    }
+}
+
+/**
+ * Texts that do not fit in the inline buffer move to the heap, keeping what was written before.
+ */
+TEST(FormatterTest, long_text)
+{
+    std::string expected;
+    Formatter formatter;
+    for (int i = 0; i < 1000; ++i)
+    {
+        formatter << "Entry " << i << ";";
+        expected += "Entry " + std::to_string(i) + ";";
+    }
+    ASSERT_GT(expected.size(), Formatter::INLINE_CAPACITY);
+    ASSERT_EQ(formatter.to_string(), expected);
+    ASSERT_EQ(std::string(formatter.data(), formatter.size()), expected);
+
+    // A text bigger than the buffer at once
+    const std::string long_string(5000, 'x');
+    ASSERT_EQ((Formatter() << long_string).to_string(), long_string);
+
+    // A formatter appended to itself
+    Formatter self;
+    self << long_string;
+    self << self;
+    ASSERT_EQ(self.to_string(), long_string + long_string);
+}
+
+/**
+ * Copy and move formatters with inline and heap texts, and write them in streams and other formatters.
+ */
+TEST(FormatterTest, copy_and_move)
+{
+    const std::string long_string(1000, 'y');
+
+    for (const std::string& text : {std::string("short"), long_string})
+    {
+        Formatter formatter;
+        formatter << text;
+
+        Formatter copy(formatter);
+        ASSERT_EQ(copy.to_string(), text);
+        ASSERT_EQ(formatter.to_string(), text);
+
+        Formatter moved(std::move(formatter));
+        ASSERT_EQ(moved.to_string(), text);
+        ASSERT_EQ(formatter.size(), 0u);
+
+        // The moved from formatter can be used again
+        formatter << "again";
+        ASSERT_EQ(formatter.to_string(), "again");
+
+        Formatter assigned;
+        assigned << "previous text";
+        assigned = std::move(moved);
+        ASSERT_EQ(assigned.to_string(), text);
+
+        assigned = copy;
+        ASSERT_EQ(assigned.to_string(), text);
+
+        std::stringstream ss;
+        ss << copy;
+        ASSERT_EQ(ss.str(), text);
+        ASSERT_EQ(static_cast<std::string>(Formatter() << "[" << copy << "]"), "[" + text + "]");
+    }
+}
+
+/**
+ * Measure the messages per second built by this formatter and by a formatter over a \c std::stringstream ,
+ * for a message like the ones of exceptions and logs.
+ * It is reported as a property of the test, and printed.
+ */
+TEST(FormatterTest, format_rate)
+{
+    constexpr unsigned int N_MESSAGES = 200000;
+
+    const std::string topic = "rt/chatter";
+    std::size_t total_size = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < N_MESSAGES; ++i)
+    {
+        const std::string message = (test::StreamFormatter() << "Reader " << i << " of topic " << topic
+                                                             << " lost " << (i % 7) << " samples in " << 0.25
+                                                             << " s.").to_string();
+        total_size += message.size();
+    }
+    const std::chrono::duration<double> stream_elapsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < N_MESSAGES; ++i)
+    {
+        const std::string message = (STR_ENTRY << "Reader " << i << " of topic " << topic
+                                               << " lost " << (i % 7) << " samples in " << 0.25
+                                               << " s.").to_string();
+        total_size -= message.size();
+    }
+    const std::chrono::duration<double> formatter_elapsed = std::chrono::steady_clock::now() - start;
+
+    // Both give the same messages
+    ASSERT_EQ(total_size, 0u);
+
+    const double stream_rate = N_MESSAGES / std::max(stream_elapsed.count(), 1e-9);
+    const double formatter_rate = N_MESSAGES / std::max(formatter_elapsed.count(), 1e-9);
+    RecordProperty("messages_per_second_stringstream", static_cast<int>(stream_rate));
+    RecordProperty("messages_per_second_formatter", static_cast<int>(formatter_rate));
+    std::cout << "std::stringstream: " << static_cast<uint64_t>(stream_rate) << " messages/s" << std::endl;
+    std::cout << "Formatter: " << static_cast<uint64_t>(formatter_rate) << " messages/s" << std::endl;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
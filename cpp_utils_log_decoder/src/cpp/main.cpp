@@ -0,0 +1,118 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main.cpp
+ *
+ * Render a binary log written by \c eprosima::utils::BinaryLog , or a flight recorder ring written by
+ * \c eprosima::utils::FlightRecorderLogConsumer , as text lines.
+ */
+
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include <cpp_utils/exception/Exception.hpp>
+#include <cpp_utils/logging/BinaryLogReader.hpp>
+#include <cpp_utils/logging/FlightRecorderReader.hpp>
+
+namespace {
+
+void print_usage(
+        const char* program)
+{
+    std::cerr << "Usage: " << program << " [--sort] <binary_log_file | flight_recorder_file>" << std::endl
+              << std::endl
+              << "Print each record of the binary log, or each entry of the flight recorder ring from the oldest,"
+              << " as a text log line." << std::endl
+              << "  --sort  Sort the records of a binary log by timestamp, instead of printing them in file order."
+              << std::endl;
+}
+
+} /* namespace */
+
+int main(
+        int argc,
+        char** argv)
+{
+    bool sort = false;
+    std::string file_path;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--sort") == 0)
+        {
+            sort = true;
+        }
+        else if (std::strcmp(argv[i], "-h") == 0 || std::strcmp(argv[i], "--help") == 0)
+        {
+            print_usage(argv[0]);
+            return 0;
+        }
+        else if (file_path.empty())
+        {
+            file_path = argv[i];
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (file_path.empty())
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    try
+    {
+        if (eprosima::utils::FlightRecorderReader::is_flight_recorder_file(file_path))
+        {
+            eprosima::utils::FlightRecorderReader reader(file_path);
+            eprosima::utils::FlightRecorderEntry entry;
+            while (reader.next(entry))
+            {
+                std::cout << entry << '\n';
+            }
+            return 0;
+        }
+
+        eprosima::utils::BinaryLogReader reader(file_path);
+
+        if (sort)
+        {
+            for (const eprosima::utils::BinaryLogEntry& entry : reader.read_all_sorted())
+            {
+                std::cout << entry << '\n';
+            }
+        }
+        else
+        {
+            eprosima::utils::BinaryLogEntry entry;
+            while (reader.next(entry))
+            {
+                std::cout << entry << '\n';
+            }
+        }
+    }
+    catch (const eprosima::utils::Exception& e)
+    {
+        std::cerr << "Error decoding " << file_path << ": " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}